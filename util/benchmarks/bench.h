@@ -0,0 +1,102 @@
+/**
+ * @file      bench.h
+ * @brief     This file contains helpers shared by the host benchmarks.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+namespace bench {
+
+/**
+ * @brief Prevent the compiler from optimizing away a value.
+ *
+ * @param[in]  value
+ *             The value which must be considered used.
+ */
+template <typename T>
+inline void doNotOptimize(const T& value)
+{
+    asm volatile("" : : "g"(&value) : "memory");
+}
+
+/**
+ * @brief Time a function over a number of operations.
+ *
+ * @param[in]  ops
+ *             The number of operations performed by a single call to *fn*.
+ * @param[in]  fn
+ *             The function to time.
+ * @return The average time per operation in nanoseconds.
+ */
+template <typename F>
+double nsPerOp(size_t ops, F fn)
+{
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(ops);
+}
+
+/**
+ * @brief Print a single benchmark result.
+ *
+ * @param[in]  name
+ *             The name of the benchmark.
+ * @param[in]  ns_per_op
+ *             The average time per operation in nanoseconds.
+ */
+inline void report(const char* name, double ns_per_op)
+{
+    std::printf("%-48s %10.2f ns/op\n", name, ns_per_op);
+}
+
+/**
+ * @brief Print a single benchmark result along with an extra per-operation counter.
+ *
+ * @param[in]  name
+ *             The name of the benchmark.
+ * @param[in]  ns_per_op
+ *             The average time per operation in nanoseconds.
+ * @param[in]  counter
+ *             The name of the extra counter.
+ * @param[in]  per_op
+ *             The value of the extra counter per operation.
+ */
+inline void report(const char* name, double ns_per_op, const char* counter, double per_op)
+{
+    std::printf("%-48s %10.2f ns/op %10.2f %s/op\n", name, ns_per_op, per_op, counter);
+}
+
+/**
+ * @brief Small, fast pseudo-random generator so benchmark inputs are repeatable.
+ */
+class XorShift
+{
+public:
+    explicit XorShift(uint32_t seed = 2463534242U) : m_state(seed) {}
+
+    uint32_t next()
+    {
+        m_state ^= m_state << 13;
+        m_state ^= m_state >> 17;
+        m_state ^= m_state << 5;
+        return m_state;
+    }
+
+private:
+    uint32_t m_state;
+};
+
+} // namespace bench
+
+#endif // BENCH_H
@@ -0,0 +1,177 @@
+/**
+ * @file      bench_blocking_queue.cpp
+ * @brief     This file contains benchmarks comparing BlockingQueue with polling a Queue.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <mutex>
+#include <thread>
+
+#include "bench.h"
+
+#include "junk/containers/blocking_queue.h"
+#include "junk/containers/queue.h"
+
+using namespace junk;
+
+namespace {
+
+constexpr size_t kQueueSize = 64U;
+/// Items sent one at a time, with a pause between them, so the consumer is usually waiting.
+constexpr uint32_t kNumTrickleItems = 500U;
+/// Items sent back to back, so the consumer rarely has to wait.
+constexpr uint32_t kNumStreamItems = 50000U;
+constexpr std::chrono::microseconds kTricklePause(200);
+
+using Clock = std::chrono::steady_clock;
+
+/// An item carrying the time at which it was sent.
+struct Stamped
+{
+    Clock::time_point sent;
+};
+
+/// The CPU time used so far by the calling thread, in microseconds.
+double threadCpuUs()
+{
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<double>(ts.tv_sec) * 1e6 + static_cast<double>(ts.tv_nsec) / 1e3;
+}
+
+/// A Queue guarded by a mutex, which the consumer polls.
+class PolledQueue
+{
+public:
+    bool enqueue(const Stamped& item)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_queue.enqueue(item);
+    }
+
+    bool dequeue(Stamped& item)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_queue.dequeue(item);
+    }
+
+private:
+    std::mutex m_mutex;
+    Queue<Stamped, kQueueSize> m_queue;
+};
+
+/// Poll by sleeping for a millisecond whenever the queue is empty.
+struct SleepPoll
+{
+    PolledQueue queue;
+
+    void enqueue(const Stamped& item)
+    {
+        while (!queue.enqueue(item)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    void dequeue(Stamped& item)
+    {
+        while (!queue.dequeue(item)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+};
+
+/// Poll by yielding whenever the queue is empty.
+struct SpinPoll
+{
+    PolledQueue queue;
+
+    void enqueue(const Stamped& item)
+    {
+        while (!queue.enqueue(item)) {
+            std::this_thread::yield();
+        }
+    }
+
+    void dequeue(Stamped& item)
+    {
+        while (!queue.dequeue(item)) {
+            std::this_thread::yield();
+        }
+    }
+};
+
+/// Wait on a BlockingQueue.
+struct Blocking
+{
+    BlockingQueue<Stamped, kQueueSize> queue;
+
+    void enqueue(const Stamped& item)
+    {
+        queue.enqueueWait(item);
+    }
+
+    void dequeue(Stamped& item)
+    {
+        queue.dequeueWait(item);
+    }
+};
+
+/**
+ * @brief Send *num_items* from a producer thread to the calling thread.
+ *
+ * @param[in]  name
+ *             The name to report the result under.
+ * @param[in]  num_items
+ *             The number of items to send.
+ * @param[in]  pause
+ *             Whether the producer pauses between items.
+ */
+template <class Handoff>
+void benchHandoff(const char* name, uint32_t num_items, bool pause)
+{
+    static Handoff handoff;
+
+    std::thread producer([&]() {
+        for (uint32_t i = 0; i < num_items; i++) {
+            if (pause) {
+                std::this_thread::sleep_for(kTricklePause);
+            }
+            handoff.enqueue(Stamped {Clock::now()});
+        }
+    });
+
+    // The latency of a trickle is what matters, the time per item of a stream
+    const double cpu_start = threadCpuUs();
+    const auto start = Clock::now();
+    double latency_ns = 0.0;
+    for (uint32_t i = 0; i < num_items; i++) {
+        Stamped item;
+        handoff.dequeue(item);
+        latency_ns += std::chrono::duration<double, std::nano>(Clock::now() - item.sent).count();
+    }
+    const double elapsed_ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    const double cpu_us = threadCpuUs() - cpu_start;
+    producer.join();
+
+    const double ns = pause ? latency_ns : elapsed_ns;
+    bench::report(name, ns / num_items, "consumer cpu us", cpu_us / num_items);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    benchHandoff<SleepPoll>("trickle latency, sleep poll", kNumTrickleItems, true);
+    benchHandoff<SpinPoll>("trickle latency, yield poll", kNumTrickleItems, true);
+    benchHandoff<Blocking>("trickle latency, BlockingQueue", kNumTrickleItems, true);
+    benchHandoff<SleepPoll>("stream, sleep poll", kNumStreamItems, false);
+    benchHandoff<SpinPoll>("stream, yield poll", kNumStreamItems, false);
+    benchHandoff<Blocking>("stream, BlockingQueue", kNumStreamItems, false);
+
+    return 0;
+}
@@ -0,0 +1,142 @@
+/**
+ * @file      bench_broadcast_ring.cpp
+ * @brief     This file contains benchmarks comparing BroadcastRing with one SpscQueue per consumer.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <cstdio>
+
+#include "bench.h"
+
+#include "junk/containers/broadcast_ring.h"
+#include "junk/containers/spsc_queue.h"
+
+using namespace junk;
+
+namespace {
+
+constexpr size_t kNumItems = 1U << 22;
+constexpr size_t kBatch = 32U;
+constexpr size_t kNumConsumers = 3U;
+
+/// A sensor sample, fanned out to a logger, a filter and an uplink.
+struct Sample
+{
+    uint32_t timestamp;
+    int16_t axes[6];
+};
+
+/**
+ * @brief Time a stream fanned out through one SpscQueue per consumer.
+ *
+ * The producer writes a batch into every queue, then each consumer drains its queue.
+ *
+ * @return The time per sample delivered to every consumer in nanoseconds.
+ */
+double benchQueues()
+{
+    static SpscQueue<Sample, 64> queues[kNumConsumers];
+    uint32_t sum = 0;
+    const double ns = bench::nsPerOp(kNumItems, [&]() {
+        for (size_t n = 0; n < kNumItems; n += kBatch) {
+            for (size_t i = 0; i < kBatch; i++) {
+                const Sample sample = {static_cast<uint32_t>(n + i), {1, 2, 3, 4, 5, 6}};
+                for (size_t c = 0; c < kNumConsumers; c++) {
+                    queues[c].enqueue(sample);
+                }
+            }
+            for (size_t c = 0; c < kNumConsumers; c++) {
+                Sample sample;
+                while (queues[c].dequeue(sample)) {
+                    sum += sample.timestamp;
+                }
+            }
+        }
+    });
+    bench::doNotOptimize(sum);
+
+    return ns;
+}
+
+/**
+ * @brief Time a stream fanned out through a BroadcastRing, read one sample at a time.
+ *
+ * @return The time per sample delivered to every consumer in nanoseconds.
+ */
+double benchRing()
+{
+    static BroadcastRing<Sample, 64, kNumConsumers> ring;
+    BroadcastRing<Sample, 64, kNumConsumers>::ConsumerId ids[kNumConsumers];
+    for (size_t c = 0; c < kNumConsumers; c++) {
+        ids[c] = ring.subscribe();
+    }
+
+    uint32_t sum = 0;
+    const double ns = bench::nsPerOp(kNumItems, [&]() {
+        for (size_t n = 0; n < kNumItems; n += kBatch) {
+            for (size_t i = 0; i < kBatch; i++) {
+                ring.publish(Sample {static_cast<uint32_t>(n + i), {1, 2, 3, 4, 5, 6}});
+            }
+            for (size_t c = 0; c < kNumConsumers; c++) {
+                Sample sample;
+                while (ring.read(ids[c], sample)) {
+                    sum += sample.timestamp;
+                }
+            }
+        }
+    });
+    bench::doNotOptimize(sum);
+
+    return ns;
+}
+
+/**
+ * @brief Time a stream fanned out through a BroadcastRing, read in place a batch at a time.
+ *
+ * @return The time per sample delivered to every consumer in nanoseconds.
+ */
+double benchRingInPlace()
+{
+    static BroadcastRing<Sample, 64, kNumConsumers> ring;
+    BroadcastRing<Sample, 64, kNumConsumers>::ConsumerId ids[kNumConsumers];
+    for (size_t c = 0; c < kNumConsumers; c++) {
+        ids[c] = ring.subscribe();
+    }
+
+    uint32_t sum = 0;
+    const double ns = bench::nsPerOp(kNumItems, [&]() {
+        for (size_t n = 0; n < kNumItems; n += kBatch) {
+            for (size_t i = 0; i < kBatch; i++) {
+                ring.publish(Sample {static_cast<uint32_t>(n + i), {1, 2, 3, 4, 5, 6}});
+            }
+            for (size_t c = 0; c < kNumConsumers; c++) {
+                Span<const Sample> region = ring.peekContiguous(ids[c]);
+                while (region.length() > 0) {
+                    for (size_t i = 0; i < region.length(); i++) {
+                        sum += region[i].timestamp;
+                    }
+                    ring.release(ids[c], region.length());
+                    region = ring.peekContiguous(ids[c]);
+                }
+            }
+        }
+    });
+    bench::doNotOptimize(sum);
+
+    return ns;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::printf("%zu consumers, batches of %zu samples\n", kNumConsumers, kBatch);
+
+    bench::report("one SpscQueue per consumer", benchQueues());
+    bench::report("BroadcastRing, read()", benchRing());
+    bench::report("BroadcastRing, peekContiguous + release", benchRingInPlace());
+
+    return 0;
+}
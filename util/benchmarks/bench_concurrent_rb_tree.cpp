@@ -0,0 +1,165 @@
+/**
+ * @file      bench_concurrent_rb_tree.cpp
+ * @brief     This file contains the reader scaling benchmark for ConcurrentRbTree.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <pthread.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+#include "bench.h"
+
+#include "junk/containers/concurrent_rb_tree.h"
+#include "junk/containers/rb_tree.h"
+
+using namespace junk;
+
+namespace {
+
+constexpr size_t kNumItems = 4096U;
+constexpr size_t kLookupsPerReader = 1U << 20;
+constexpr size_t kMaxReaders = 8U;
+
+/// Readers and one writer sharing a ConcurrentRbTree, readers never block.
+class SeqlockTable
+{
+public:
+    bool find(uint32_t key, uint32_t& value) const
+    {
+        return m_tree.find(key, value);
+    }
+
+    void insert(uint32_t key)
+    {
+        m_tree.insert(key);
+    }
+
+    void erase(uint32_t key)
+    {
+        m_tree.erase(key);
+    }
+
+private:
+    ConcurrentRbTree<kNumItems + 1U, uint32_t> m_tree;
+};
+
+/// Readers and one writer sharing an RbTree behind a reader-writer lock.
+class RwLockTable
+{
+public:
+    RwLockTable()
+    {
+        pthread_rwlock_init(&m_lock, nullptr);
+    }
+
+    ~RwLockTable()
+    {
+        pthread_rwlock_destroy(&m_lock);
+    }
+
+    bool find(uint32_t key, uint32_t& value) const
+    {
+        pthread_rwlock_rdlock(&m_lock);
+        const uint32_t* item = m_tree.search(key);
+        if (item != nullptr) {
+            value = *item;
+        }
+        pthread_rwlock_unlock(&m_lock);
+        return (item != nullptr);
+    }
+
+    void insert(uint32_t key)
+    {
+        pthread_rwlock_wrlock(&m_lock);
+        m_tree.insert(key);
+        pthread_rwlock_unlock(&m_lock);
+    }
+
+    void erase(uint32_t key)
+    {
+        pthread_rwlock_wrlock(&m_lock);
+        m_tree.erase(key);
+        pthread_rwlock_unlock(&m_lock);
+    }
+
+private:
+    mutable pthread_rwlock_t m_lock;
+    RbTree<kNumItems + 1U, uint32_t> m_tree;
+};
+
+/**
+ * @brief Time lookups from a number of reader threads while a writer updates the table.
+ *
+ * The writer replaces one entry every 50 us, the rare update rate of a routing table.
+ *
+ * @return The wall time per lookup, across all readers, in nanoseconds.
+ */
+template <typename Table>
+double benchReaders(Table& table, size_t num_readers)
+{
+    std::atomic<bool> done {false};
+    std::thread writer([&]() {
+        uint32_t key = kNumItems;
+        while (!done.load(std::memory_order_relaxed)) {
+            table.insert(key);
+            table.erase(key);
+            key = (key == kNumItems) ? (kNumItems + 1U) : kNumItems;
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    });
+
+    std::thread readers[kMaxReaders];
+    const double ns = bench::nsPerOp(num_readers * kLookupsPerReader, [&]() {
+        for (size_t r = 0; r < num_readers; r++) {
+            readers[r] = std::thread([&table, r]() {
+                bench::XorShift rng(static_cast<uint32_t>(r + 1U));
+                uint32_t value = 0;
+                for (size_t i = 0; i < kLookupsPerReader; i++) {
+                    table.find(rng.next() % kNumItems, value);
+                }
+                bench::doNotOptimize(value);
+            });
+        }
+        for (size_t r = 0; r < num_readers; r++) {
+            readers[r].join();
+        }
+    });
+
+    done = true;
+    writer.join();
+
+    return ns;
+}
+
+template <typename Table>
+void benchTable(const char* name)
+{
+    static Table table;
+    for (uint32_t i = 0; i < kNumItems; i++) {
+        table.insert(i);
+    }
+
+    for (size_t num_readers = 1; num_readers <= kMaxReaders; num_readers *= 2U) {
+        char label[64];
+        std::snprintf(label, sizeof(label), "%s, %zu reader(s)", name, num_readers);
+        bench::report(label, benchReaders(table, num_readers));
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::printf("Hardware threads: %u\n", std::thread::hardware_concurrency());
+
+    benchTable<SeqlockTable>("lookup seqlock");
+    benchTable<RwLockTable>("lookup rwlock");
+
+    return 0;
+}
@@ -0,0 +1,138 @@
+/**
+ * @file      bench_deque.cpp
+ * @brief     This file contains benchmarks comparing Deque with std::deque.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <cstdio>
+#include <deque>
+
+#include "bench.h"
+
+#include "junk/containers/deque.h"
+
+using namespace junk;
+
+namespace {
+
+constexpr size_t kNumOps = 1U << 24;
+constexpr size_t kWindow = 256U;
+
+/**
+ * @brief Time a sliding window: each new sample is added at the back and the oldest dropped.
+ *
+ * @return The time per sample in nanoseconds.
+ */
+double benchWindowDeque()
+{
+    static Deque<uint32_t, kWindow> window;
+    uint32_t sum = 0;
+    const double ns = bench::nsPerOp(kNumOps, [&]() {
+        for (size_t i = 0; i < kNumOps; i++) {
+            if (window.isFull()) {
+                sum -= window.front();
+                window.popFront();
+            }
+            window.pushBack(static_cast<uint32_t>(i));
+            sum += static_cast<uint32_t>(i);
+        }
+    });
+    bench::doNotOptimize(sum);
+
+    return ns;
+}
+
+/// @copydoc benchWindowDeque()
+double benchWindowStd()
+{
+    std::deque<uint32_t> window;
+    uint32_t sum = 0;
+    const double ns = bench::nsPerOp(kNumOps, [&]() {
+        for (size_t i = 0; i < kNumOps; i++) {
+            if (window.size() >= kWindow) {
+                sum -= window.front();
+                window.pop_front();
+            }
+            window.push_back(static_cast<uint32_t>(i));
+            sum += static_cast<uint32_t>(i);
+        }
+    });
+    bench::doNotOptimize(sum);
+
+    return ns;
+}
+
+/**
+ * @brief Time a work-stealing local queue: the owner pushes and pops at the back, a thief steals
+ *        from the front every few tasks.
+ *
+ * @return The time per task in nanoseconds.
+ */
+double benchWorkDeque()
+{
+    static Deque<uint32_t, kWindow> tasks;
+    bench::XorShift rng;
+    uint32_t sum = 0;
+    const double ns = bench::nsPerOp(kNumOps, [&]() {
+        for (size_t i = 0; i < kNumOps; i++) {
+            const uint32_t r = rng.next();
+            uint32_t task = 0;
+            if ((r & 3U) != 0U) {
+                tasks.pushBack(r);
+            } else if ((r & 4U) != 0U) {
+                tasks.popBack(task);
+            } else {
+                tasks.popFront(task);
+            }
+            sum += task;
+        }
+    });
+    bench::doNotOptimize(sum);
+
+    return ns;
+}
+
+/// @copydoc benchWorkDeque()
+double benchWorkStd()
+{
+    std::deque<uint32_t> tasks;
+    bench::XorShift rng;
+    uint32_t sum = 0;
+    const double ns = bench::nsPerOp(kNumOps, [&]() {
+        for (size_t i = 0; i < kNumOps; i++) {
+            const uint32_t r = rng.next();
+            uint32_t task = 0;
+            if ((r & 3U) != 0U) {
+                if (tasks.size() < kWindow) {
+                    tasks.push_back(r);
+                }
+            } else if (!tasks.empty()) {
+                if ((r & 4U) != 0U) {
+                    task = tasks.back();
+                    tasks.pop_back();
+                } else {
+                    task = tasks.front();
+                    tasks.pop_front();
+                }
+            }
+            sum += task;
+        }
+    });
+    bench::doNotOptimize(sum);
+
+    return ns;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    bench::report("sliding window, Deque", benchWindowDeque());
+    bench::report("sliding window, std::deque", benchWindowStd());
+    bench::report("work queue, Deque", benchWorkDeque());
+    bench::report("work queue, std::deque", benchWorkStd());
+
+    return 0;
+}
@@ -0,0 +1,133 @@
+/**
+ * @file      bench_fixed_hash_map.cpp
+ * @brief     This file contains benchmarks comparing FixedHashMap with FixedMap and
+ *            std::unordered_map.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <cstdio>
+#include <unordered_map>
+
+#include "bench.h"
+
+#include "junk/containers/fixed_hash_map.h"
+#include "junk/containers/fixed_map.h"
+
+using namespace junk;
+
+namespace {
+
+constexpr size_t kNumItems = 4096U;
+constexpr size_t kRounds = 32U;
+
+uint32_t g_keys[kNumItems];
+uint32_t g_misses[kNumItems];
+
+void makeKeys()
+{
+    // Even keys are inserted, odd keys are never present
+    bench::XorShift rng;
+    for (size_t i = 0; i < kNumItems; i++) {
+        const uint32_t key = rng.next() & ~1U;
+        g_keys[i] = key;
+        g_misses[i] = key | 1U;
+    }
+}
+
+/// The same minimal interface over each map under test.
+struct HashMapOps
+{
+    using Map = FixedHashMap<uint32_t, uint32_t, kNumItems>;
+
+    static bool insert(Map& map, uint32_t key) { return map.tryEmplace(key, key); }
+    static bool find(const Map& map, uint32_t key) { return map.find(key) != nullptr; }
+    static bool erase(Map& map, uint32_t key) { return map.erase(key); }
+};
+
+struct TreeMapOps
+{
+    using Map = FixedMap<uint32_t, uint32_t, kNumItems>;
+
+    static bool insert(Map& map, uint32_t key) { return map.tryEmplace(key, key); }
+    static bool find(const Map& map, uint32_t key) { return map.find(key) != nullptr; }
+    static bool erase(Map& map, uint32_t key) { return map.erase(key); }
+};
+
+struct StdMapOps
+{
+    using Map = std::unordered_map<uint32_t, uint32_t>;
+
+    static bool insert(Map& map, uint32_t key) { return map.emplace(key, key).second; }
+    static bool find(const Map& map, uint32_t key) { return map.find(key) != map.end(); }
+    static bool erase(Map& map, uint32_t key) { return map.erase(key) != 0; }
+};
+
+template <typename Ops>
+void benchMap(const char* name)
+{
+    using Map = typename Ops::Map;
+
+    double insert_ns = 0.0;
+    double hit_ns = 0.0;
+    double miss_ns = 0.0;
+    double erase_ns = 0.0;
+    size_t found = 0;
+
+    for (size_t r = 0; r < kRounds; r++) {
+        Map* map = new Map();
+
+        insert_ns += bench::nsPerOp(kNumItems, [&]() {
+            for (size_t i = 0; i < kNumItems; i++) {
+                Ops::insert(*map, g_keys[i]);
+            }
+        });
+
+        hit_ns += bench::nsPerOp(kNumItems, [&]() {
+            for (size_t i = 0; i < kNumItems; i++) {
+                found += Ops::find(*map, g_keys[i]) ? 1U : 0U;
+            }
+        });
+
+        miss_ns += bench::nsPerOp(kNumItems, [&]() {
+            for (size_t i = 0; i < kNumItems; i++) {
+                found += Ops::find(*map, g_misses[i]) ? 1U : 0U;
+            }
+        });
+
+        erase_ns += bench::nsPerOp(kNumItems, [&]() {
+            for (size_t i = 0; i < kNumItems; i++) {
+                Ops::erase(*map, g_keys[i]);
+            }
+        });
+
+        delete map;
+    }
+    bench::doNotOptimize(found);
+
+    char label[64];
+    std::snprintf(label, sizeof(label), "%s insert", name);
+    bench::report(label, insert_ns / kRounds);
+    std::snprintf(label, sizeof(label), "%s lookup hit", name);
+    bench::report(label, hit_ns / kRounds);
+    std::snprintf(label, sizeof(label), "%s lookup miss", name);
+    bench::report(label, miss_ns / kRounds);
+    std::snprintf(label, sizeof(label), "%s erase", name);
+    bench::report(label, erase_ns / kRounds);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    makeKeys();
+
+    std::printf("Control group width: %zu slots\n", ControlGroup::kWidth);
+
+    benchMap<HashMapOps>("FixedHashMap");
+    benchMap<TreeMapOps>("FixedMap");
+    benchMap<StdMapOps>("std::unordered_map");
+
+    return 0;
+}
@@ -0,0 +1,139 @@
+/**
+ * @file      bench_flat_map.cpp
+ * @brief     This file contains benchmarks comparing FlatMap with FixedMap.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <cstdio>
+
+#include "bench.h"
+
+#include "junk/containers/fixed_map.h"
+#include "junk/containers/flat_map.h"
+
+using namespace junk;
+
+namespace {
+
+constexpr size_t kNumItems = 4096U;
+constexpr size_t kRounds = 16U;
+
+using Flat = FlatMap<uint32_t, uint32_t, kNumItems>;
+using Tree = FixedMap<uint32_t, uint32_t, kNumItems>;
+
+Flat::Entry g_entries[kNumItems];
+
+void makeEntries()
+{
+    bench::XorShift rng;
+    for (size_t i = 0; i < kNumItems; i++) {
+        const uint32_t key = rng.next();
+        g_entries[i] = Flat::Entry(key, key);
+    }
+}
+
+/// Fill a table in batches of the given size, the way a table is loaded from a config stream.
+double benchFlatBatches(size_t batch_size)
+{
+    double total = 0.0;
+    for (size_t r = 0; r < kRounds; r++) {
+        Flat* map = new Flat();
+        total += bench::nsPerOp(kNumItems, [&]() {
+            for (size_t i = 0; i < kNumItems; i += batch_size) {
+                map->insertBatch(&g_entries[i], batch_size);
+            }
+        });
+        bench::doNotOptimize(map->size());
+        delete map;
+    }
+
+    return total / kRounds;
+}
+
+void benchInsert()
+{
+    double total = 0.0;
+    for (size_t r = 0; r < kRounds; r++) {
+        Tree* map = new Tree();
+        total += bench::nsPerOp(kNumItems, [&]() {
+            for (size_t i = 0; i < kNumItems; i++) {
+                map->tryEmplace(g_entries[i].key, g_entries[i].value);
+            }
+        });
+        delete map;
+    }
+    bench::report("FixedMap insert one at a time", total / kRounds);
+
+    total = 0.0;
+    for (size_t r = 0; r < kRounds; r++) {
+        Flat* map = new Flat();
+        total += bench::nsPerOp(kNumItems, [&]() {
+            for (size_t i = 0; i < kNumItems; i++) {
+                map->tryEmplace(g_entries[i].key, g_entries[i].value);
+            }
+        });
+        delete map;
+    }
+    bench::report("FlatMap insert one at a time", total / kRounds);
+
+    for (size_t batch_size = 64U; batch_size <= kNumItems; batch_size *= 8U) {
+        char label[64];
+        std::snprintf(label, sizeof(label), "FlatMap insertBatch, %zu per batch", batch_size);
+        bench::report(label, benchFlatBatches(batch_size));
+    }
+}
+
+template <typename Map>
+double benchLookup(const Map& map)
+{
+    uint32_t sum = 0;
+    const double ns = bench::nsPerOp(kNumItems * kRounds, [&]() {
+        for (size_t r = 0; r < kRounds; r++) {
+            for (size_t i = 0; i < kNumItems; i++) {
+                sum += *map.find(g_entries[i].key);
+            }
+        }
+    });
+    bench::doNotOptimize(sum);
+
+    return ns;
+}
+
+void benchLookups()
+{
+    static Tree tree;
+    static Flat flat;
+    for (size_t i = 0; i < kNumItems; i++) {
+        tree.tryEmplace(g_entries[i].key, g_entries[i].value);
+    }
+    flat.insertBatch(g_entries);
+
+    bench::report("FixedMap lookup", benchLookup(tree));
+    bench::report("FlatMap lookup", benchLookup(flat));
+
+    uint64_t sum = 0;
+    const double ns = bench::nsPerOp(kNumItems * kRounds, [&]() {
+        for (size_t r = 0; r < kRounds; r++) {
+            const Span<const Flat::Entry> entries = flat.entries();
+            for (size_t i = 0; i < entries.length(); i++) {
+                sum += entries[i].value;
+            }
+        }
+    });
+    bench::doNotOptimize(sum);
+    bench::report("FlatMap iterate entries", ns);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    makeEntries();
+
+    benchInsert();
+    benchLookups();
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+/**
+ * @file      bench_key_value_table.cpp
+ * @brief     This file contains benchmarks comparing KeyValueTable with an array of KeyPair.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <cstdio>
+
+#include "bench.h"
+
+#include "junk/containers/flat_map.h"
+#include "junk/containers/key_value_table.h"
+
+using namespace junk;
+
+namespace {
+
+constexpr size_t kNumItems = 16384U;
+constexpr size_t kNumLookups = 1U << 20;
+
+/// A value of a given size, standing in for a configuration record.
+template <size_t Size>
+struct Blob
+{
+    Blob() = default;
+    explicit Blob(uint32_t v) : first(v) {}
+
+    uint32_t first = 0;
+    uint8_t rest[Size - sizeof(uint32_t)];
+};
+
+uint32_t g_keys[kNumItems];
+uint32_t g_lookups[kNumLookups];
+
+void makeKeys()
+{
+    bench::XorShift rng;
+    for (size_t i = 0; i < kNumItems; i++) {
+        g_keys[i] = rng.next();
+    }
+    for (size_t i = 0; i < kNumLookups; i++) {
+        g_lookups[i] = g_keys[rng.next() % kNumItems];
+    }
+}
+
+template <typename Map>
+double benchLookup(const Map& map)
+{
+    uint32_t sum = 0;
+    const double ns = bench::nsPerOp(kNumLookups, [&]() {
+        for (size_t i = 0; i < kNumLookups; i++) {
+            sum += map.find(g_lookups[i])->first;
+        }
+    });
+    bench::doNotOptimize(sum);
+
+    return ns;
+}
+
+template <size_t Size>
+void benchValueSize()
+{
+    using Value = Blob<Size>;
+    static FlatMap<uint32_t, Value, kNumItems> pairs;
+    static KeyValueTable<uint32_t, Value, kNumItems> table;
+
+    for (size_t i = 0; i < kNumItems; i++) {
+        pairs.tryEmplace(g_keys[i], g_keys[i]);
+        table.tryEmplace(g_keys[i], g_keys[i]);
+    }
+
+    char label[64];
+    std::snprintf(label, sizeof(label), "array of KeyPair, %zu byte values", Size);
+    bench::report(label, benchLookup(pairs));
+    std::snprintf(label, sizeof(label), "KeyValueTable, %zu byte values", Size);
+    bench::report(label, benchLookup(table));
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    makeKeys();
+
+    std::printf("Random lookups in %zu entries\n", kNumItems);
+    benchValueSize<4U>();
+    benchValueSize<16U>();
+    benchValueSize<64U>();
+    benchValueSize<256U>();
+
+    return 0;
+}
@@ -0,0 +1,118 @@
+/**
+ * @file      bench_lru_cache.cpp
+ * @brief     This file contains benchmarks comparing LruCache with a std::list based LRU cache.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <cstdio>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+#include "bench.h"
+
+#include "junk/containers/lru_cache.h"
+
+using namespace junk;
+
+namespace {
+
+constexpr size_t kCapacity = 1024U;
+constexpr size_t kNumOps = 1U << 20;
+
+uint32_t g_keys[kNumOps];
+
+/// The textbook LRU cache: a std::list in recency order indexed by a std::unordered_map.
+class StdLruCache
+{
+public:
+    uint32_t* get(uint32_t key)
+    {
+        auto it = m_index.find(key);
+        if (it == m_index.end()) {
+            return nullptr;
+        }
+        m_order.splice(m_order.begin(), m_order, it->second);
+        return &(it->second->second);
+    }
+
+    void put(uint32_t key, uint32_t value)
+    {
+        if (m_order.size() == kCapacity) {
+            m_index.erase(m_order.back().first);
+            m_order.pop_back();
+        }
+        m_order.emplace_front(key, value);
+        m_index[key] = m_order.begin();
+    }
+
+private:
+    std::list<std::pair<uint32_t, uint32_t>> m_order;
+    std::unordered_map<uint32_t, std::list<std::pair<uint32_t, uint32_t>>::iterator> m_index;
+};
+
+/// Keys drawn from a working set of the given size, with a skew towards low keys.
+void makeKeys(uint32_t working_set)
+{
+    bench::XorShift rng;
+    for (size_t i = 0; i < kNumOps; i++) {
+        const uint32_t a = rng.next() % working_set;
+        const uint32_t b = rng.next() % working_set;
+        g_keys[i] = (a < b) ? a : b;
+    }
+}
+
+/// Look up each key and fill the cache on a miss, the usual read-through pattern.
+template <typename Cache>
+double benchReadThrough(Cache& cache)
+{
+    uint32_t sum = 0;
+    const double ns = bench::nsPerOp(kNumOps, [&]() {
+        for (size_t i = 0; i < kNumOps; i++) {
+            const uint32_t key = g_keys[i];
+            uint32_t* value = cache.get(key);
+            if (value == nullptr) {
+                cache.put(key, key);
+            } else {
+                sum += *value;
+            }
+        }
+    });
+    bench::doNotOptimize(sum);
+
+    return ns;
+}
+
+void benchWorkingSet(uint32_t working_set)
+{
+    makeKeys(working_set);
+
+    static LruCache<uint32_t, uint32_t, kCapacity> cache;
+    cache.clear();
+    cache.resetStats();
+    char label[64];
+    std::snprintf(label, sizeof(label), "LruCache, working set %u", working_set);
+    const double ns = benchReadThrough(cache);
+    const LruCacheStats& stats = cache.stats();
+    bench::report(label, ns, "hit",
+                  static_cast<double>(stats.hits) / static_cast<double>(stats.hits + stats.misses));
+
+    StdLruCache std_cache;
+    std::snprintf(label, sizeof(label), "std::list LRU, working set %u", working_set);
+    bench::report(label, benchReadThrough(std_cache));
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::printf("Cache capacity: %zu entries\n", kCapacity);
+
+    benchWorkingSet(1536U);
+    benchWorkingSet(4096U);
+    benchWorkingSet(65536U);
+
+    return 0;
+}
@@ -0,0 +1,127 @@
+/**
+ * @file      bench_mpmc_queue.cpp
+ * @brief     This file contains contention benchmarks comparing MpmcQueue with a locked Queue.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+#include "bench.h"
+
+#include "junk/containers/mpmc_queue.h"
+#include "junk/containers/queue.h"
+
+using namespace junk;
+
+namespace {
+
+constexpr size_t kCapacity = 1024U;
+constexpr size_t kNumItems = 1U << 21;
+constexpr size_t kMaxThreads = 8U;
+
+/// A Queue shared by all producers and consumers, every call takes the lock.
+class LockedQueue
+{
+public:
+    bool enqueue(uint32_t item)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_queue.enqueue(item);
+    }
+
+    bool dequeue(uint32_t& item)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_queue.dequeue(item);
+    }
+
+private:
+    std::mutex m_mutex;
+    Queue<uint32_t, kCapacity> m_queue;
+};
+
+/**
+ * @brief Time a number of producer threads passing items to a number of consumer threads.
+ *
+ * The items are split evenly between the producers. Both sides yield when the queue is full or
+ * empty, so the benchmark also completes with more threads than cores.
+ *
+ * @return The wall time per item in nanoseconds.
+ */
+template <typename Q>
+double benchContention(Q& queue, size_t num_producers, size_t num_consumers)
+{
+    const size_t items_per_producer = kNumItems / num_producers;
+    const size_t total = items_per_producer * num_producers;
+    std::atomic<size_t> consumed {0};
+    std::atomic<uint32_t> sum {0};
+
+    std::thread producers[kMaxThreads];
+    std::thread consumers[kMaxThreads];
+    const double ns = bench::nsPerOp(total, [&]() {
+        for (size_t c = 0; c < num_consumers; c++) {
+            consumers[c] = std::thread([&]() {
+                uint32_t local_sum = 0;
+                while (consumed.load(std::memory_order_relaxed) < total) {
+                    uint32_t item = 0;
+                    if (queue.dequeue(item)) {
+                        local_sum += item;
+                        consumed.fetch_add(1U, std::memory_order_relaxed);
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+                sum += local_sum;
+            });
+        }
+        for (size_t p = 0; p < num_producers; p++) {
+            producers[p] = std::thread([&]() {
+                for (size_t i = 0; i < items_per_producer; i++) {
+                    while (!queue.enqueue(static_cast<uint32_t>(i))) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        for (size_t p = 0; p < num_producers; p++) {
+            producers[p].join();
+        }
+        for (size_t c = 0; c < num_consumers; c++) {
+            consumers[c].join();
+        }
+    });
+    bench::doNotOptimize(sum);
+
+    return ns;
+}
+
+template <typename Q>
+void benchQueue(const char* name)
+{
+    static const size_t kShapes[][2] = {{1U, 1U}, {2U, 2U}, {4U, 4U}, {1U, 4U}, {4U, 1U}};
+
+    for (const auto& shape : kShapes) {
+        static Q queue;
+        char label[64];
+        std::snprintf(label, sizeof(label), "%s, %zuP/%zuC", name, shape[0], shape[1]);
+        bench::report(label, benchContention(queue, shape[0], shape[1]));
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::printf("Hardware threads: %u\n", std::thread::hardware_concurrency());
+
+    benchQueue<MpmcQueue<uint32_t, kCapacity>>("MpmcQueue");
+    benchQueue<LockedQueue>("Queue + std::mutex");
+
+    return 0;
+}
@@ -0,0 +1,122 @@
+/**
+ * @file      bench_priority_queue.cpp
+ * @brief     This file contains benchmarks comparing PriorityQueue with std::priority_queue and
+ *            RbTree.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <cstdio>
+#include <functional>
+#include <queue>
+#include <vector>
+
+#include "bench.h"
+
+#include "junk/containers/priority_queue.h"
+#include "junk/containers/rb_tree.h"
+
+using namespace junk;
+
+namespace {
+
+constexpr size_t kNumItems = 4096U;
+constexpr size_t kNumOps = 1U << 21;
+
+/// A PriorityQueue with the pop-min interface shared by the benchmarks.
+template <size_t Arity>
+class HeapQueue
+{
+public:
+    void push(uint32_t deadline)
+    {
+        m_queue.push(deadline);
+    }
+
+    uint32_t popMin()
+    {
+        uint32_t deadline = 0;
+        m_queue.pop(deadline);
+        return deadline;
+    }
+
+private:
+    PriorityQueue<uint32_t, kNumItems, util::ThreeWayCompare, Arity> m_queue;
+};
+
+/// The standard library binary heap.
+class StdQueue
+{
+public:
+    void push(uint32_t deadline)
+    {
+        m_queue.push(deadline);
+    }
+
+    uint32_t popMin()
+    {
+        const uint32_t deadline = m_queue.top();
+        m_queue.pop();
+        return deadline;
+    }
+
+private:
+    std::priority_queue<uint32_t, std::vector<uint32_t>, std::greater<uint32_t>> m_queue;
+};
+
+/// An RbTree used as a priority queue, the smallest node is cached by the tree.
+class TreeQueue : private RbTree<kNumItems, uint32_t>
+{
+public:
+    void push(uint32_t deadline)
+    {
+        this->insert(deadline);
+    }
+
+    uint32_t popMin()
+    {
+        const uint32_t deadline = this->m_min->item;
+        this->eraseNode(this->m_min);
+        return deadline;
+    }
+};
+
+/**
+ * @brief Time the hold model of a timer queue: pop the earliest deadline, schedule a later one.
+ *
+ * @return The time per pop and push pair in nanoseconds.
+ */
+template <typename Q>
+double benchHold()
+{
+    static Q queue;
+    bench::XorShift rng;
+    for (size_t i = 0; i < kNumItems; i++) {
+        queue.push(rng.next() & 0xFFFFU);
+    }
+
+    const double ns = bench::nsPerOp(kNumOps, [&]() {
+        for (size_t i = 0; i < kNumOps; i++) {
+            const uint32_t now = queue.popMin();
+            queue.push(now + (rng.next() & 0xFFFFU));
+        }
+    });
+    bench::doNotOptimize(queue);
+
+    return ns;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::printf("Hold model, %zu pending deadlines\n", kNumItems);
+
+    bench::report("PriorityQueue, 4-ary", benchHold<HeapQueue<4>>());
+    bench::report("PriorityQueue, 2-ary", benchHold<HeapQueue<2>>());
+    bench::report("std::priority_queue", benchHold<StdQueue>());
+    bench::report("RbTree", benchHold<TreeQueue>());
+
+    return 0;
+}
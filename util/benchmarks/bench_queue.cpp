@@ -0,0 +1,314 @@
+/**
+ * @file      bench_queue.cpp
+ * @brief     This file contains throughput benchmarks for Queue.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <cstdio>
+
+#include "bench.h"
+
+#include "junk/containers/queue.h"
+
+using namespace junk;
+
+namespace {
+
+constexpr size_t kNumOps = 1U << 24;
+constexpr size_t kInFlight = 500U;
+
+/**
+ * @brief Time one enqueue and one dequeue per operation, with a steady number of items queued.
+ *
+ * @return The time per enqueue and dequeue pair in nanoseconds.
+ */
+template <typename Q>
+double benchThroughput(Q& queue)
+{
+    for (uint32_t i = 0; i < kInFlight; i++) {
+        queue.enqueue(i);
+    }
+
+    uint32_t sum = 0;
+    const double ns = bench::nsPerOp(kNumOps, [&]() {
+        for (size_t i = 0; i < kNumOps; i++) {
+            queue.enqueue(static_cast<uint32_t>(i));
+            uint32_t item = 0;
+            queue.dequeue(item);
+            sum += item;
+        }
+    });
+    bench::doNotOptimize(sum);
+
+    return ns;
+}
+
+constexpr size_t kStreamBytes = 1U << 24;
+constexpr size_t kChunk = 64U;
+
+uint8_t g_chunk[kChunk];
+
+/**
+ * @brief Time a byte stream passed through the queue in chunks, one byte per call.
+ *
+ * @return The time per byte in nanoseconds.
+ */
+template <typename Q>
+double benchBytes(Q& queue)
+{
+    uint8_t sum = 0;
+    const double ns = bench::nsPerOp(kStreamBytes, [&]() {
+        for (size_t n = 0; n < kStreamBytes; n += kChunk) {
+            for (size_t i = 0; i < kChunk; i++) {
+                queue.enqueue(g_chunk[i]);
+            }
+            for (size_t i = 0; i < kChunk; i++) {
+                uint8_t byte = 0;
+                queue.dequeue(byte);
+                sum += byte;
+            }
+        }
+    });
+    bench::doNotOptimize(sum);
+
+    return ns;
+}
+
+/**
+ * @brief Time a byte stream passed through the queue in chunks, one bulk call per chunk.
+ *
+ * @return The time per byte in nanoseconds.
+ */
+template <typename Q>
+double benchBytesBulk(Q& queue)
+{
+    uint8_t out[kChunk];
+    uint8_t sum = 0;
+    const double ns = bench::nsPerOp(kStreamBytes, [&]() {
+        for (size_t n = 0; n < kStreamBytes; n += kChunk) {
+            queue.enqueueBulk(Span<const uint8_t>(g_chunk));
+            queue.dequeueBulk(Span<uint8_t>(out));
+            sum += out[n % kChunk];
+        }
+    });
+    bench::doNotOptimize(sum);
+
+    return ns;
+}
+
+/// Stands in for a driver call such as `Spi::write(const uint8_t*, size_t)`.
+uint32_t fakeDriverWrite(const uint8_t* data, size_t length)
+{
+    bench::doNotOptimize(data);
+    return static_cast<uint32_t>(length);
+}
+
+/**
+ * @brief Time feeding a driver from the queue through a scratch buffer.
+ *
+ * @return The time per byte in nanoseconds.
+ */
+template <typename Q>
+double benchDriverCopy(Q& queue)
+{
+    uint8_t scratch[kChunk];
+    uint32_t sent = 0;
+    const double ns = bench::nsPerOp(kStreamBytes, [&]() {
+        for (size_t n = 0; n < kStreamBytes; n += kChunk) {
+            queue.enqueueBulk(Span<const uint8_t>(g_chunk));
+            const size_t length = queue.dequeueBulk(Span<uint8_t>(scratch));
+            sent += fakeDriverWrite(scratch, length);
+        }
+    });
+    bench::doNotOptimize(sent);
+
+    return ns;
+}
+
+/**
+ * @brief Time feeding a driver straight from the queue storage.
+ *
+ * @return The time per byte in nanoseconds.
+ */
+template <typename Q>
+double benchDriverZeroCopy(Q& queue)
+{
+    uint32_t sent = 0;
+    const double ns = bench::nsPerOp(kStreamBytes, [&]() {
+        for (size_t n = 0; n < kStreamBytes; n += kChunk) {
+            queue.enqueueBulk(Span<const uint8_t>(g_chunk));
+            while (!queue.isEmpty()) {
+                Span<const uint8_t> region = queue.peekContiguous();
+                sent += fakeDriverWrite(region.cget(), region.length());
+                queue.release(region.length());
+            }
+        }
+    });
+    bench::doNotOptimize(sent);
+
+    return ns;
+}
+
+/**
+ * @brief Time a producer keeping the latest samples in a full queue by dequeuing to make room.
+ *
+ * @return The time per sample in nanoseconds.
+ */
+template <typename Q>
+double benchLatestDequeue(Q& queue)
+{
+    const double ns = bench::nsPerOp(kNumOps, [&]() {
+        for (size_t i = 0; i < kNumOps; i++) {
+            if (queue.isFull()) {
+                uint32_t oldest = 0;
+                queue.dequeue(oldest);
+            }
+            queue.enqueue(static_cast<uint32_t>(i));
+        }
+    });
+    bench::doNotOptimize(queue);
+
+    return ns;
+}
+
+/**
+ * @brief Time a producer keeping the latest samples in a full overwriting queue.
+ *
+ * @return The time per sample in nanoseconds.
+ */
+template <typename Q>
+double benchLatestOverwrite(Q& queue)
+{
+    const double ns = bench::nsPerOp(kNumOps, [&]() {
+        for (size_t i = 0; i < kNumOps; i++) {
+            queue.enqueue(static_cast<uint32_t>(i));
+        }
+    });
+    bench::doNotOptimize(queue);
+
+    return ns;
+}
+
+/// A message too large to copy for free, such as a radio frame.
+struct Frame
+{
+    uint32_t id;
+    uint8_t payload[252];
+};
+
+constexpr size_t kNumFrames = 1U << 20;
+
+/**
+ * @brief Time passing frames through the queue, peeking and dequeuing into a caller's frame.
+ *
+ * @return The time per frame in nanoseconds.
+ */
+template <typename Q>
+double benchFramesCopy(Q& queue)
+{
+    Frame in = {};
+    uint32_t sum = 0;
+    const double ns = bench::nsPerOp(kNumFrames, [&]() {
+        for (size_t i = 0; i < kNumFrames; i++) {
+            in.id = static_cast<uint32_t>(i);
+            queue.enqueue(in);
+            Frame item = {};
+            queue.peek(item);
+            sum += item.payload[i % sizeof(item.payload)];
+            queue.dequeue(item);
+            sum += item.id;
+        }
+    });
+    bench::doNotOptimize(sum);
+
+    return ns;
+}
+
+/**
+ * @brief Time passing frames through the queue, looking at the front and taking it out.
+ *
+ * @return The time per frame in nanoseconds.
+ */
+template <typename Q>
+double benchFramesTry(Q& queue)
+{
+    Frame in = {};
+    uint32_t sum = 0;
+    const double ns = bench::nsPerOp(kNumFrames, [&]() {
+        for (size_t i = 0; i < kNumFrames; i++) {
+            in.id = static_cast<uint32_t>(i);
+            queue.enqueue(in);
+            sum += queue.front().payload[i % sizeof(in.payload)];
+            Optional<Frame> item = queue.tryDequeue();
+            sum += item->id;
+        }
+    });
+    bench::doNotOptimize(sum);
+
+    return ns;
+}
+
+/**
+ * @brief Time passing frames through the queue, handling each one in place.
+ *
+ * @return The time per frame in nanoseconds.
+ */
+template <typename Q>
+double benchFramesConsume(Q& queue)
+{
+    Frame in = {};
+    uint32_t sum = 0;
+    const double ns = bench::nsPerOp(kNumFrames, [&]() {
+        for (size_t i = 0; i < kNumFrames; i++) {
+            in.id = static_cast<uint32_t>(i);
+            queue.enqueue(in);
+            queue.consume([&](const Frame& item) {
+                sum += item.payload[i % sizeof(item.payload)] + item.id;
+            });
+        }
+    });
+    bench::doNotOptimize(sum);
+
+    return ns;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    static Queue<uint32_t, 1000> general;
+    bench::report("enqueue + dequeue, 1000 slots", benchThroughput(general));
+
+    static Queue<uint32_t, 1024> pow2;
+    bench::report("enqueue + dequeue, 1024 slots (masked)", benchThroughput(pow2));
+
+    // A UART receive buffer, drained in chunks by the main loop
+    for (size_t i = 0; i < kChunk; i++) {
+        g_chunk[i] = static_cast<uint8_t>(i);
+    }
+    static Queue<uint8_t, 200> bytes;
+    bench::report("byte stream, per byte, 200 slots", benchBytes(bytes));
+    bench::report("byte stream, bulk, 200 slots", benchBytesBulk(bytes));
+    static Queue<uint8_t, 256> bytes_pow2;
+    bench::report("byte stream, per byte, 256 slots", benchBytes(bytes_pow2));
+    bench::report("byte stream, bulk, 256 slots", benchBytesBulk(bytes_pow2));
+
+    bench::report("driver feed, dequeueBulk + scratch", benchDriverCopy(bytes));
+    bench::report("driver feed, peekContiguous + release", benchDriverZeroCopy(bytes));
+
+    // Telemetry keeping the latest samples
+    static Queue<uint32_t, 1024> latest;
+    bench::report("latest samples, dequeue + enqueue", benchLatestDequeue(latest));
+    static Queue<uint32_t, 1024, QueueFullPolicy::kOverwrite> overwrite;
+    bench::report("latest samples, overwrite", benchLatestOverwrite(overwrite));
+
+    // Large items, where each copy out of the queue costs
+    static Queue<Frame, 16> frames;
+    bench::report("frames, peek + dequeue(T&)", benchFramesCopy(frames));
+    bench::report("frames, front + tryDequeue", benchFramesTry(frames));
+    bench::report("frames, consume", benchFramesConsume(frames));
+
+    return 0;
+}
@@ -0,0 +1,286 @@
+/**
+ * @file      bench_rb_tree.cpp
+ * @brief     This file contains benchmarks for RbTree.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <cstdio>
+#include <cstring>
+
+#include "bench.h"
+
+#include "junk/containers/rb_tree.h"
+#include "junk/containers/rb_tree_image.h"
+
+using namespace junk;
+
+namespace {
+
+constexpr size_t kNumItems = 4096U;
+
+uint64_t g_strcmp_calls = 0;
+
+/// An expensive key: a string with a long common prefix so every comparison scans most of it.
+struct StringKey
+{
+    char str[48];
+};
+
+int compareKeys(const StringKey& a, const StringKey& b)
+{
+    g_strcmp_calls++;
+    return std::strcmp(a.str, b.str);
+}
+
+bool operator <(const StringKey& a, const StringKey& b)
+{
+    return compareKeys(a, b) < 0;
+}
+
+bool operator ==(const StringKey& a, const StringKey& b)
+{
+    return compareKeys(a, b) == 0;
+}
+
+/// Single pass three-way predicate for StringKey.
+struct StringKeyCompare
+{
+    int operator()(const StringKey& a, const StringKey& b) const
+    {
+        return compareKeys(a, b);
+    }
+};
+
+StringKey g_keys[kNumItems];
+
+void makeKeys()
+{
+    bench::XorShift rng;
+    for (size_t i = 0; i < kNumItems; i++) {
+        std::snprintf(g_keys[i].str, sizeof(g_keys[i].str),
+                      "/devices/platform/soc/sensor/%08x", static_cast<unsigned>(rng.next()));
+    }
+}
+
+template <typename Tree>
+void benchTree(const char* insert_name, const char* search_name)
+{
+    static Tree tree;
+
+    g_strcmp_calls = 0;
+    double ns = bench::nsPerOp(kNumItems, [&]() {
+        for (size_t i = 0; i < kNumItems; i++) {
+            tree.insert(g_keys[i]);
+        }
+    });
+    bench::report(insert_name, ns, "cmp", static_cast<double>(g_strcmp_calls) / kNumItems);
+
+    constexpr size_t kRounds = 16U;
+    g_strcmp_calls = 0;
+    ns = bench::nsPerOp(kNumItems * kRounds, [&]() {
+        for (size_t r = 0; r < kRounds; r++) {
+            for (size_t i = 0; i < kNumItems; i++) {
+                bench::doNotOptimize(tree.search(g_keys[i]));
+            }
+        }
+    });
+    bench::report(search_name, ns, "cmp",
+                  static_cast<double>(g_strcmp_calls) / (kNumItems * kRounds));
+}
+
+uint64_t g_int_compares = 0;
+
+/// Three-way predicate for integers which counts its calls.
+struct CountingCompare
+{
+    int operator()(const uint32_t& a, const uint32_t& b) const
+    {
+        g_int_compares++;
+        return (a < b) ? -1 : ((a > b) ? 1 : 0);
+    }
+};
+
+using IntTree = RbTree<kNumItems, uint32_t, CountingCompare>;
+
+uint32_t g_sorted[kNumItems];
+uint32_t g_reversed[kNumItems];
+uint32_t g_random[kNumItems];
+
+void makeStreams()
+{
+    bench::XorShift rng;
+    for (size_t i = 0; i < kNumItems; i++) {
+        g_sorted[i] = static_cast<uint32_t>(i);
+        g_reversed[i] = static_cast<uint32_t>(kNumItems - i);
+        g_random[i] = rng.next();
+    }
+}
+
+void benchStream(const char* name, const uint32_t (&stream)[kNumItems])
+{
+    constexpr size_t kRounds = 64U;
+    double total = 0.0;
+
+    g_int_compares = 0;
+    for (size_t r = 0; r < kRounds; r++) {
+        IntTree* tree = new IntTree();
+        total += bench::nsPerOp(kNumItems, [&]() {
+            for (size_t i = 0; i < kNumItems; i++) {
+                tree->insert(stream[i]);
+            }
+        });
+        delete tree;
+    }
+
+    bench::report(name, total / kRounds, "cmp",
+                  static_cast<double>(g_int_compares) / (kNumItems * kRounds));
+}
+
+void benchStreamHinted(const char* name, const uint32_t (&stream)[kNumItems])
+{
+    constexpr size_t kRounds = 64U;
+    double total = 0.0;
+
+    g_int_compares = 0;
+    for (size_t r = 0; r < kRounds; r++) {
+        IntTree* tree = new IntTree();
+        total += bench::nsPerOp(kNumItems, [&]() {
+            const uint32_t* hint = nullptr;
+            for (size_t i = 0; i < kNumItems; i++) {
+                hint = tree->insert(hint, stream[i]);
+            }
+        });
+        delete tree;
+    }
+
+    bench::report(name, total / kRounds, "cmp",
+                  static_cast<double>(g_int_compares) / (kNumItems * kRounds));
+}
+
+void benchSplitJoin()
+{
+    constexpr size_t kRounds = 1024U;
+    static IntTree tree;
+    static PooledRbTree<kNumItems, uint32_t, CountingCompare> upper(tree.pool());
+    static IntTree copy;
+
+    for (size_t i = 0; i < kNumItems; i++) {
+        tree.insert(g_random[i]);
+    }
+
+    bench::XorShift rng;
+    g_int_compares = 0;
+    double ns = bench::nsPerOp(kRounds, [&]() {
+        for (size_t r = 0; r < kRounds; r++) {
+            tree.split(rng.next(), upper);
+            tree.join(upper);
+        }
+    });
+    bench::report("split + join 4096 items", ns, "cmp",
+                  static_cast<double>(g_int_compares) / kRounds);
+
+    // The alternative: erase the upper range and insert it into another tree
+    constexpr size_t kCopyRounds = 16U;
+    ns = bench::nsPerOp(kCopyRounds, [&]() {
+        for (size_t r = 0; r < kCopyRounds; r++) {
+            const uint32_t key = rng.next();
+            for (size_t i = 0; i < kNumItems; i++) {
+                if (g_random[i] >= key) {
+                    tree.erase(g_random[i]);
+                    copy.insert(g_random[i]);
+                }
+            }
+            for (size_t i = 0; i < kNumItems; i++) {
+                if (g_random[i] >= key) {
+                    copy.erase(g_random[i]);
+                    tree.insert(g_random[i]);
+                }
+            }
+        }
+    });
+    bench::report("split + join 4096 items by reinsertion", ns);
+}
+
+void benchImage()
+{
+    using Tree = RbTree<kNumItems, uint32_t>;
+    using Image = RbTreeImage<uint32_t>;
+    constexpr size_t kRounds = 64U;
+
+    alignas(8) static uint8_t buffer[Image::imageSize(kNumItems)];
+    static Tree source;
+    for (size_t i = 0; i < kNumItems; i++) {
+        source.insert(g_random[i]);
+    }
+    const size_t size = Image::write(source, buffer, sizeof(buffer));
+
+    // Startup by rebuilding the tree from its items
+    double total = 0.0;
+    for (size_t r = 0; r < kRounds; r++) {
+        Tree* tree = new Tree();
+        total += bench::nsPerOp(1U, [&]() {
+            for (size_t i = 0; i < kNumItems; i++) {
+                tree->insert(g_random[i]);
+            }
+        });
+        delete tree;
+    }
+    bench::report("startup: rebuild 4096 item tree", total / kRounds);
+
+    // Startup by opening an image in place
+    Image image;
+    double ns = bench::nsPerOp(kRounds, [&]() {
+        for (size_t r = 0; r < kRounds; r++) {
+            image.open(buffer, size);
+            bench::doNotOptimize(image);
+        }
+    });
+    bench::report("startup: open 4096 item image", ns);
+
+    constexpr size_t kSearchRounds = 16U;
+    ns = bench::nsPerOp(kNumItems * kSearchRounds, [&]() {
+        for (size_t r = 0; r < kSearchRounds; r++) {
+            for (size_t i = 0; i < kNumItems; i++) {
+                bench::doNotOptimize(source.search(g_random[i]));
+            }
+        }
+    });
+    bench::report("search 4096 item tree", ns);
+
+    ns = bench::nsPerOp(kNumItems * kSearchRounds, [&]() {
+        for (size_t r = 0; r < kSearchRounds; r++) {
+            for (size_t i = 0; i < kNumItems; i++) {
+                bench::doNotOptimize(image.search(g_random[i]));
+            }
+        }
+    });
+    bench::report("search 4096 item image", ns);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    makeKeys();
+
+    benchTree<RbTree<kNumItems, StringKey>>("insert string key (operator < / ==)",
+                                            "search string key (operator < / ==)");
+    benchTree<RbTree<kNumItems, StringKey, StringKeyCompare>>("insert string key (three-way)",
+                                                              "search string key (three-way)");
+
+    makeStreams();
+
+    benchStream("insert sorted stream", g_sorted);
+    benchStream("insert reverse-sorted stream", g_reversed);
+    benchStream("insert random stream", g_random);
+    benchStreamHinted("insert sorted stream (hint = last insert)", g_sorted);
+    benchStreamHinted("insert reverse-sorted stream (hint = last insert)", g_reversed);
+    benchStreamHinted("insert random stream (hint = last insert)", g_random);
+
+    benchSplitJoin();
+    benchImage();
+
+    return 0;
+}
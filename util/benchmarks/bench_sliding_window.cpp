@@ -0,0 +1,94 @@
+/**
+ * @file      bench_sliding_window.cpp
+ * @brief     This file contains benchmarks comparing SlidingWindow with scanning a Queue.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <cstdio>
+
+#include "bench.h"
+
+#include "junk/containers/queue.h"
+#include "junk/containers/sliding_window.h"
+
+using namespace junk;
+
+namespace {
+
+constexpr size_t kNumSamples = 1U << 20;
+
+/// Statistics of the window after each sample, kept so they are not optimized away.
+struct Stats
+{
+    int32_t sum;
+    int16_t min;
+    int16_t max;
+};
+
+/**
+ * @brief Time the sum, minimum and maximum of the last *S* samples, scanning the window each time.
+ *
+ * @return The time per sample in nanoseconds.
+ */
+template <size_t S>
+double benchScan()
+{
+    static Queue<int16_t, S, QueueFullPolicy::kOverwrite> window;
+    bench::XorShift rng;
+    Stats stats = {};
+    const double ns = bench::nsPerOp(kNumSamples, [&]() {
+        for (size_t n = 0; n < kNumSamples; n++) {
+            window.enqueue(static_cast<int16_t>(rng.next()));
+
+            Span<const int16_t> segments[2];
+            window.segments(segments[0], segments[1]);
+            stats = {0, segments[0][0], segments[0][0]};
+            for (const Span<const int16_t>& segment : segments) {
+                for (size_t i = 0; i < segment.length(); i++) {
+                    stats.sum += segment[i];
+                    stats.min = util::min(stats.min, segment[i]);
+                    stats.max = util::max(stats.max, segment[i]);
+                }
+            }
+            bench::doNotOptimize(stats);
+        }
+    });
+
+    return ns;
+}
+
+/**
+ * @brief Time the sum, minimum and maximum of the last *S* samples kept by a SlidingWindow.
+ *
+ * @return The time per sample in nanoseconds.
+ */
+template <size_t S>
+double benchWindow()
+{
+    static SlidingWindow<int16_t, S, int32_t> window;
+    bench::XorShift rng;
+    Stats stats = {};
+    const double ns = bench::nsPerOp(kNumSamples, [&]() {
+        for (size_t n = 0; n < kNumSamples; n++) {
+            window.push(static_cast<int16_t>(rng.next()));
+            stats = {window.sum(), window.min(), window.max()};
+            bench::doNotOptimize(stats);
+        }
+    });
+
+    return ns;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    bench::report("sum/min/max, 16 samples, scan", benchScan<16>());
+    bench::report("sum/min/max, 16 samples, SlidingWindow", benchWindow<16>());
+    bench::report("sum/min/max, 256 samples, scan", benchScan<256>());
+    bench::report("sum/min/max, 256 samples, SlidingWindow", benchWindow<256>());
+
+    return 0;
+}
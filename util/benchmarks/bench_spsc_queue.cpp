@@ -0,0 +1,95 @@
+/**
+ * @file      bench_spsc_queue.cpp
+ * @brief     This file contains benchmarks comparing SpscQueue with a Queue behind a mutex.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+#include "bench.h"
+
+#include "junk/containers/queue.h"
+#include "junk/containers/spsc_queue.h"
+
+using namespace junk;
+
+namespace {
+
+constexpr size_t kCapacity = 1024U;
+constexpr size_t kNumItems = 1U << 22;
+
+/// A Queue shared by a producer and a consumer thread, every call takes the lock.
+class LockedQueue
+{
+public:
+    bool enqueue(uint32_t item)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_queue.enqueue(item);
+    }
+
+    bool dequeue(uint32_t& item)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_queue.dequeue(item);
+    }
+
+private:
+    std::mutex m_mutex;
+    Queue<uint32_t, kCapacity> m_queue;
+};
+
+/**
+ * @brief Time a producer thread passing items to a consumer thread.
+ *
+ * Both sides yield when the queue is full or empty, so the benchmark also completes on a single
+ * core.
+ *
+ * @return The wall time per item in nanoseconds.
+ */
+template <typename Q>
+double benchThreadPair(Q& queue)
+{
+    uint32_t sum = 0;
+    const double ns = bench::nsPerOp(kNumItems, [&]() {
+        std::thread consumer([&]() {
+            for (size_t i = 0; i < kNumItems; i++) {
+                uint32_t item = 0;
+                while (!queue.dequeue(item)) {
+                    std::this_thread::yield();
+                }
+                sum += item;
+            }
+        });
+
+        for (size_t i = 0; i < kNumItems; i++) {
+            while (!queue.enqueue(static_cast<uint32_t>(i))) {
+                std::this_thread::yield();
+            }
+        }
+
+        consumer.join();
+    });
+    bench::doNotOptimize(sum);
+
+    return ns;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::printf("Hardware threads: %u\n", std::thread::hardware_concurrency());
+
+    static SpscQueue<uint32_t, kCapacity> spsc;
+    bench::report("thread pair SpscQueue", benchThreadPair(spsc));
+
+    static LockedQueue locked;
+    bench::report("thread pair Queue + std::mutex", benchThreadPair(locked));
+
+    return 0;
+}
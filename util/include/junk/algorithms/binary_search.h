@@ -179,6 +179,54 @@ T* binarySearch(T (&array)[N], const T& match, Compare comp)
     return binarySearch(&array[0], N, match, comp);
 }
 
+/**
+ * @brief Find the first item of a sorted array which is not less than a key.
+ *
+ * Unlike binarySearch() the key may be of a different type than the items, and the index where
+ * the key would be inserted is returned when there is no match. Compare predicate must have a
+ * signature similar to: `int comp(const K& key, const T& item)`, following the same convention as
+ * binarySearch().
+ *
+ * @pre The given array must be sorted from lowest (at zero index) to highest (at `length-1` index).
+ *
+ * @tparam     T
+ *             The type stored in the array.
+ * @tparam     K
+ *             The type of the key.
+ * @tparam     Compare
+ *             The type of the predicate used to compare the key with an item.
+ * @param[in]  array
+ *             A pointer to the array to be searched.
+ * @param[in]  length
+ *             The length of the array to be searched.
+ * @param[in]  key
+ *             The key to search for.
+ * @param[in]  comp
+ *             The predicate used to compare the key with an item.
+ *
+ * @return The index of the first item which is not less than *key*, or *length* if every item is
+ *         less than *key*.
+ */
+template <typename T, typename K, typename Compare>
+size_t lowerBound(T* const array, const size_t length, const K& key, Compare comp)
+{
+    if (length == 0) {
+        return 0;
+    }
+
+    // Halve the range without branching on the comparison, so the loop can compile to conditional
+    // moves instead of a hard to predict branch
+    size_t base = 0;
+    size_t remaining = length;
+    while (remaining > 1) {
+        const size_t half = remaining / 2;
+        base = (comp(key, array[base + half]) > 0) ? (base + half) : base;
+        remaining -= half;
+    }
+
+    return base + ((comp(key, array[base]) > 0) ? 1 : 0);
+}
+
 } // namespace algorithms
 } // namespace junk
 
@@ -0,0 +1,377 @@
+/**
+ * @file   blocking_queue.h
+ * @brief  This file contains the definition of the BlockingQueue container.
+ * @author Liam Bucci <liam.bucci@gmail.com>
+ * @date   2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#ifndef BLOCKING_QUEUE_H
+#define BLOCKING_QUEUE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "junk/containers/queue.h"
+
+namespace junk {
+
+/**
+ * @brief A Queue which threads can wait on, instead of polling it.
+ *
+ * Any number of producer and consumer threads may use it. enqueueWait() waits while the queue is
+ * full and dequeueWait() waits while it is empty, each with an optional timeout.
+ *
+ * A waiting thread first spins for a while, watching an atomic copy of the item count without
+ * taking the lock, and yields between checks. A short gap between a consumer asking and a producer
+ * delivering never reaches the kernel this way. Only then does it park on a condition variable,
+ * which on Linux sleeps on a futex.
+ *
+ * The waiting threads are counted, and a thread is only woken when the queue goes from empty to
+ * not empty (for a consumer) or from full to not full (for a producer), and only if somebody is
+ * parked. A woken thread passes the wake-up on if there is still work for another parked thread,
+ * so a burst of items wakes every waiting consumer without each enqueue making a system call.
+ *
+ * @warning Needs `<thread>`, `<mutex>` and `<condition_variable>`, so this container is intended
+ *          for host builds.
+ *
+ * @tparam T
+ *         The type stored by this container.
+ * @tparam S
+ *         The maximum number of items that may be stored in this container.
+ * @tparam SpinCount
+ *         The number of times a waiting thread checks the queue before it parks. Defaults to 100.
+ */
+template <class T, size_t S, size_t SpinCount = 100U>
+class BlockingQueue
+{
+public:
+    BlockingQueue() = default;
+
+    BlockingQueue(const BlockingQueue&) = delete;
+    BlockingQueue& operator=(const BlockingQueue&) = delete;
+
+    /**
+     * @brief Enqueue a given item if there is room, without waiting.
+     *
+     * @param[in]  item
+     *             The item to store in the queue.
+     * @return A boolean:
+     *         - `true`:  The item was stored successfully in the queue.
+     *         - `false`: The queue was full.
+     */
+    bool enqueue(const T& item)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return push(lock, item);
+    }
+
+    /**
+     * @brief Enqueue a given item if there is room, without waiting.
+     *
+     * @param[in]  item
+     *             The item to move into the queue. Left untouched if the queue was full.
+     * @return A boolean:
+     *         - `true`:  The item was moved successfully into the queue.
+     *         - `false`: The queue was full.
+     */
+    bool enqueue(T&& item)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return push(lock, std::move(item));
+    }
+
+    /**
+     * @brief Enqueue a given item, waiting for room until the timeout runs out.
+     *
+     * @param[in]  item
+     *             The item to store in the queue.
+     * @param[in]  timeout
+     *             The longest time to wait for room.
+     * @return A boolean:
+     *         - `true`:  The item was stored successfully in the queue.
+     *         - `false`: The queue stayed full for the whole timeout.
+     */
+    template <class Rep, class Period>
+    bool enqueueWait(const T& item, const std::chrono::duration<Rep, Period>& timeout)
+    {
+        std::unique_lock<std::mutex> lock = waitForRoom(deadlineAfter(timeout));
+        return lock.owns_lock() && push(lock, item);
+    }
+
+    /**
+     * @brief Enqueue a given item, waiting for room until the timeout runs out.
+     *
+     * @param[in]  item
+     *             The item to move into the queue. Left untouched if the timeout ran out.
+     * @param[in]  timeout
+     *             The longest time to wait for room.
+     * @return A boolean:
+     *         - `true`:  The item was moved successfully into the queue.
+     *         - `false`: The queue stayed full for the whole timeout.
+     */
+    template <class Rep, class Period>
+    bool enqueueWait(T&& item, const std::chrono::duration<Rep, Period>& timeout)
+    {
+        std::unique_lock<std::mutex> lock = waitForRoom(deadlineAfter(timeout));
+        return lock.owns_lock() && push(lock, std::move(item));
+    }
+
+    /**
+     * @brief Enqueue a given item, waiting for as long as it takes to find room.
+     *
+     * @param[in]  item
+     *             The item to store in the queue.
+     */
+    void enqueueWait(const T& item)
+    {
+        std::unique_lock<std::mutex> lock = waitForRoom(kNoDeadline);
+        push(lock, item);
+    }
+
+    /**
+     * @brief Enqueue a given item, waiting for as long as it takes to find room.
+     *
+     * @param[in]  item
+     *             The item to move into the queue.
+     */
+    void enqueueWait(T&& item)
+    {
+        std::unique_lock<std::mutex> lock = waitForRoom(kNoDeadline);
+        push(lock, std::move(item));
+    }
+
+    /**
+     * @brief Retrieve the oldest item from the queue if there is one, without waiting.
+     *
+     * @param[out] item
+     *             The retrieved item.
+     * @return A boolean:
+     *         - `true`:  An item was successfully retrieved.
+     *         - `false`: The queue was empty.
+     */
+    bool dequeue(T& item)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return pop(lock, item);
+    }
+
+    /**
+     * @brief Retrieve the oldest item from the queue, waiting for one until the timeout runs out.
+     *
+     * @param[out] item
+     *             The retrieved item.
+     * @param[in]  timeout
+     *             The longest time to wait for an item.
+     * @return A boolean:
+     *         - `true`:  An item was successfully retrieved.
+     *         - `false`: The queue stayed empty for the whole timeout.
+     */
+    template <class Rep, class Period>
+    bool dequeueWait(T& item, const std::chrono::duration<Rep, Period>& timeout)
+    {
+        std::unique_lock<std::mutex> lock = waitForItem(deadlineAfter(timeout));
+        return lock.owns_lock() && pop(lock, item);
+    }
+
+    /**
+     * @brief Retrieve the oldest item from the queue, waiting for as long as it takes.
+     *
+     * @param[out] item
+     *             The retrieved item.
+     */
+    void dequeueWait(T& item)
+    {
+        std::unique_lock<std::mutex> lock = waitForItem(kNoDeadline);
+        pop(lock, item);
+    }
+
+    /**
+     * @brief Check if the queue is full.
+     *
+     * @return A boolean:
+     *         - `true`:  The queue is full.
+     *         - `false`: The queue is not full.
+     */
+    bool isFull() const
+    {
+        return (size() >= S);
+    }
+
+    /**
+     * @brief Check if the queue is empty.
+     *
+     * @return A boolean:
+     *         - `true`:  The queue is empty.
+     *         - `false`: The queue is not empty.
+     */
+    bool isEmpty() const
+    {
+        return (size() == 0);
+    }
+
+    /**
+     * @brief Get the current number of items in the queue.
+     *
+     * @return The current number of items in the queue, which may be stale by the time it is used.
+     */
+    size_t size() const
+    {
+        return m_size.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Get the maximum number of items that can be stored by the queue.
+     *
+     * @return The maximum number of items that can be stored by the queue.
+     */
+    size_t capacity() const
+    {
+        return S;
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    /// Stands for no timeout.
+    static constexpr Clock::time_point kNoDeadline = Clock::time_point::max();
+
+    template <class Rep, class Period>
+    static Clock::time_point deadlineAfter(const std::chrono::duration<Rep, Period>& timeout)
+    {
+        return Clock::now() + std::chrono::duration_cast<Clock::duration>(timeout);
+    }
+
+    /**
+     * @brief Spin, then park, until the queue has room or the deadline passes.
+     *
+     * @return The held lock, or a lock which does not own the mutex if the deadline passed.
+     */
+    std::unique_lock<std::mutex> waitForRoom(Clock::time_point deadline)
+    {
+        return waitUntil(true, deadline);
+    }
+
+    /**
+     * @brief Spin, then park, until the queue has an item or the deadline passes.
+     *
+     * @return The held lock, or a lock which does not own the mutex if the deadline passed.
+     */
+    std::unique_lock<std::mutex> waitForItem(Clock::time_point deadline)
+    {
+        return waitUntil(false, deadline);
+    }
+
+    /**
+     * @brief Wait for the queue to have room (for a producer) or an item (for a consumer).
+     */
+    std::unique_lock<std::mutex> waitUntil(bool for_room, Clock::time_point deadline)
+    {
+        // Spin on the unlocked item count first, most waits are short
+        for (size_t i = 0; i < SpinCount; i++) {
+            const size_t size = m_size.load(std::memory_order_relaxed);
+            if (for_room ? (size < S) : (size > 0)) {
+                break;
+            }
+            std::this_thread::yield();
+        }
+
+        std::condition_variable& cv = for_room ? m_not_full : m_not_empty;
+        size_t& waiting = for_room ? m_waiting_producers : m_waiting_consumers;
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (for_room ? m_queue.isFull() : m_queue.isEmpty()) {
+            if (Clock::now() >= deadline) {
+                lock.unlock();
+                break;
+            }
+
+            waiting++;
+            if (deadline == kNoDeadline) {
+                cv.wait(lock);
+            } else {
+                cv.wait_until(lock, deadline);
+            }
+            waiting--;
+        }
+
+        return lock;
+    }
+
+    template <typename U>
+    bool push(std::unique_lock<std::mutex>& lock, U&& item)
+    {
+        const bool was_empty = m_queue.isEmpty();
+        if (!m_queue.enqueue(std::forward<U>(item))) {
+            return false;
+        }
+        m_size.store(m_queue.size(), std::memory_order_relaxed);
+
+        // Wake a consumer only when there was nothing for it before, and pass the wake-up on to
+        // the next producer if this one was woken into a queue which still has room
+        const bool wake_consumer = was_empty && (m_waiting_consumers > 0);
+        const bool wake_producer = !m_queue.isFull() && (m_waiting_producers > 0);
+        lock.unlock();
+        if (wake_consumer) {
+            m_not_empty.notify_one();
+        }
+        if (wake_producer) {
+            m_not_full.notify_one();
+        }
+
+        return true;
+    }
+
+    bool pop(std::unique_lock<std::mutex>& lock, T& item)
+    {
+        // The rvalue overload moves the item out, so move-only types work too
+        const bool was_full = m_queue.isFull();
+        if (!m_queue.dequeue(std::move(item))) {
+            return false;
+        }
+        m_size.store(m_queue.size(), std::memory_order_relaxed);
+
+        // Wake a producer only when there was no room before, and pass the wake-up on to the next
+        // consumer if this one was woken into a queue which still has items
+        const bool wake_producer = was_full && (m_waiting_producers > 0);
+        const bool wake_consumer = !m_queue.isEmpty() && (m_waiting_consumers > 0);
+        lock.unlock();
+        if (wake_producer) {
+            m_not_full.notify_one();
+        }
+        if (wake_consumer) {
+            m_not_empty.notify_one();
+        }
+
+        return true;
+    }
+
+    /// Guards the queue and the waiter counts.
+    std::mutex m_mutex;
+    /// Signalled when the queue stops being empty.
+    std::condition_variable m_not_empty;
+    /// Signalled when the queue stops being full.
+    std::condition_variable m_not_full;
+    /// The number of consumers parked on m_not_empty.
+    size_t m_waiting_consumers = 0;
+    /// The number of producers parked on m_not_full.
+    size_t m_waiting_producers = 0;
+    /// A copy of the item count which waiting threads can spin on without the lock.
+    std::atomic<size_t> m_size {0};
+
+    /// The underlying queue.
+    Queue<T, S> m_queue;
+};
+
+template <class T, size_t S, size_t SpinCount>
+constexpr typename BlockingQueue<T, S, SpinCount>::Clock::time_point
+BlockingQueue<T, S, SpinCount>::kNoDeadline;
+
+} // namespace junk
+
+#endif // BLOCKING_QUEUE_H
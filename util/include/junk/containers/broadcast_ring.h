@@ -0,0 +1,649 @@
+/**
+ * @file   broadcast_ring.h
+ * @brief  This file contains the definition of the BroadcastRing container.
+ * @author Liam Bucci <liam.bucci@gmail.com>
+ * @date   2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#ifndef BROADCAST_RING_H
+#define BROADCAST_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "junk/containers/queue.h"
+#include "junk/containers/span.h"
+#include "junk/util/junk_assert.h"
+#include "junk/util/util.h"
+
+namespace junk {
+
+/**
+ * @brief A ring buffer which one producer publishes into and every subscribed consumer reads.
+ *
+ * Each item is written once and read in place by every consumer, so fanning a stream out to *N*
+ * consumers costs one write per item instead of the *N* copies separate queues would need. Items
+ * are numbered by a free running sequence. The producer publishes by storing the next sequence
+ * with release ordering, and each consumer owns a cursor with the sequence of the next item it
+ * will read. Cursors sit on their own cache lines, next to private state of their consumer.
+ *
+ * With QueueFullPolicy::kReject the producer is gated by the slowest consumer: it may run at most
+ * *S* items ahead of any cursor. It keeps the slowest cursor it last saw and only scans the
+ * cursors again once that runs out, so it does not touch consumer cache lines on every item.
+ *
+ * With QueueFullPolicy::kOverwrite the producer never waits and a consumer which falls more than
+ * *S* items behind skips ahead, counting the skipped items in lost(). The producer announces each
+ * slot it is about to overwrite, a consumer copies an item out and then checks the announcement,
+ * retrying if the slot was overwritten during the copy. Both sides copy lossy slots as relaxed
+ * atomic words, so *T* must be trivially copyable.
+ *
+ * Consumers take items in batches with readBulk(), or read them in place with peekContiguous()
+ * and release(). Either way the cursor is stored once per batch.
+ *
+ * @warning Only one context may call the producer functions (publish(), emplace(), publishBulk(),
+ *          subscribe()) and only one context per consumer may call the functions taking its id.
+ *          Needs `<atomic>`, so this container is intended for host builds.
+ *
+ * @tparam T
+ *         The type stored by this container. Must be copyable.
+ * @tparam S
+ *         The number of items kept in the ring.
+ * @tparam MaxConsumers
+ *         The maximum number of consumers which may be subscribed at once.
+ * @tparam Policy
+ *         Whether a full ring gates the producer or drops the oldest items. Defaults to
+ *         QueueFullPolicy::kReject.
+ */
+template <class T, size_t S, size_t MaxConsumers, QueueFullPolicy Policy = QueueFullPolicy::kReject>
+class BroadcastRing
+{
+    static_assert(S > 0U, "BroadcastRing needs a capacity of at least 1");
+    static_assert(MaxConsumers > 0U, "BroadcastRing needs room for at least one consumer");
+    static_assert((Policy == QueueFullPolicy::kReject) || std::is_trivially_copyable<T>::value,
+                  "A lossy BroadcastRing copies items that may be overwritten, T must be trivially "
+                  "copyable");
+
+public:
+    /// Identifies a subscribed consumer.
+    using ConsumerId = size_t;
+
+    /// The id returned when every consumer slot is taken.
+    static constexpr ConsumerId kInvalidConsumer = ~static_cast<ConsumerId>(0);
+
+    BroadcastRing() = default;
+
+    /**
+     * @brief Destructor for BroadcastRing container.
+     *
+     * The destructor ensures all items still held in the ring are destructed. Neither the producer
+     * nor any consumer may be running when the ring is destructed.
+     */
+    ~BroadcastRing()
+    {
+        const size_t published = m_published.load(std::memory_order_relaxed);
+        for (size_t seq = published - util::min(published, S); seq != published; seq++) {
+            item(seq)->~T();
+        }
+    }
+
+    BroadcastRing(const BroadcastRing&) = delete;
+    BroadcastRing& operator=(const BroadcastRing&) = delete;
+
+    /**
+     * @brief Register a new consumer. Producer only.
+     *
+     * The consumer starts at the next item to be published, it does not see items published
+     * before it subscribed.
+     *
+     * @return The id of the consumer, or kInvalidConsumer if every consumer slot is taken.
+     */
+    ConsumerId subscribe()
+    {
+        for (ConsumerId id = 0; id < MaxConsumers; id++) {
+            Consumer& consumer = m_consumers[id];
+            if (!consumer.active.load(std::memory_order_relaxed)) {
+                const size_t published = m_published.load(std::memory_order_relaxed);
+                consumer.cursor.store(published, std::memory_order_relaxed);
+                consumer.cached_published = published;
+                consumer.lost = 0;
+                consumer.active.store(true, std::memory_order_release);
+                return id;
+            }
+        }
+
+        return kInvalidConsumer;
+    }
+
+    /**
+     * @brief Unregister a consumer, it no longer gates the producer.
+     *
+     * May be called by the consumer itself, or by the producer.
+     *
+     * @param[in]  id
+     *             The id of the consumer.
+     * @return A boolean:
+     *         - `true`:  The consumer was unregistered.
+     *         - `false`: *id* is not a subscribed consumer.
+     */
+    bool unsubscribe(ConsumerId id)
+    {
+        JUNK_ASSERT_RETURN(isSubscribed(id), false);
+
+        m_consumers[id].active.store(false, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Check if an id refers to a subscribed consumer.
+     *
+     * @param[in]  id
+     *             The id to check.
+     * @return `true` if the consumer is subscribed, otherwise `false`.
+     */
+    bool isSubscribed(ConsumerId id) const
+    {
+        return (id < MaxConsumers) && m_consumers[id].active.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Publish an item to every consumer (by copying). Producer only.
+     *
+     * @param[in]  item
+     *             The item to publish.
+     * @return A boolean:
+     *         - `true`:  The item was published.
+     *         - `false`: The slowest consumer is *S* items behind. Never returned by a lossy ring.
+     */
+    bool publish(const T& item)
+    {
+        return emplace(item);
+    }
+
+    /**
+     * @brief Publish an item to every consumer (by moving). Producer only.
+     *
+     * @param[in]  item
+     *             The item to publish.
+     * @return A boolean:
+     *         - `true`:  The item was published.
+     *         - `false`: The slowest consumer is *S* items behind. Never returned by a lossy ring.
+     */
+    bool publish(T&& item)
+    {
+        return emplace(std::move(item));
+    }
+
+    /**
+     * @brief Construct an item in place and publish it to every consumer. Producer only.
+     *
+     * @param[in]  args
+     *             The parameter pack of template arguments that will be forwarded to the type *T*
+     *             constructor.
+     * @return A boolean:
+     *         - `true`:  The item was published.
+     *         - `false`: The slowest consumer is *S* items behind. Never returned by a lossy ring.
+     */
+    template <typename ... Args>
+    bool emplace(Args&&... args)
+    {
+        const size_t seq = m_published.load(std::memory_order_relaxed);
+        if (room(seq, 1U) == 0) {
+            return false;
+        }
+
+        announce(seq + 1U);
+        construct(seq, Lossy(), std::forward<Args>(args)...);
+        m_published.store(seq + 1U, std::memory_order_release);
+
+        return true;
+    }
+
+    /**
+     * @brief Publish as many of the given items as there is room for, with one store. Producer
+     *        only.
+     *
+     * The items are copied in at most two contiguous runs. A lossy ring takes all of *items*, and
+     * if *items* holds more than *S* only its last *S* items are kept.
+     *
+     * @param[in]  items
+     *             The items to publish, in order.
+     * @return The number of items taken from the front of *items*.
+     */
+    size_t publishBulk(Span<const T> items)
+    {
+        const size_t seq = m_published.load(std::memory_order_relaxed);
+        const size_t count = util::min(items.length(), room(seq, items.length()));
+        const size_t kept = util::min(count, S);
+
+        // Items that would be overwritten within the batch are never written
+        announce(seq + count);
+        size_t done = count - kept;
+        while (done < count) {
+            const size_t slot = (seq + done) % S;
+            const size_t run = util::min(count - done, S - slot);
+            copyIn(seq + done, items.cget() + done, run, Lossy(), std::is_trivially_copyable<T>());
+            done += run;
+        }
+        m_published.store(seq + count, std::memory_order_release);
+
+        return count;
+    }
+
+    /**
+     * @brief Read the next item for a consumer.
+     *
+     * @param[in]  id
+     *             The id of the consumer.
+     * @param[out] out
+     *             The item read.
+     * @return A boolean:
+     *         - `true`:  An item was read.
+     *         - `false`: The consumer has read every published item.
+     */
+    bool read(ConsumerId id, T& out)
+    {
+        return readBulk(id, Span<T>(&out, 1U)) == 1U;
+    }
+
+    /**
+     * @brief Read as many items as are published, up to the length of *items*, for a consumer.
+     *
+     * The items are copied out in at most two contiguous runs and the cursor is stored once.
+     *
+     * @param[in]  id
+     *             The id of the consumer.
+     * @param[out] items
+     *             The items read, oldest first.
+     * @return The number of items read into the front of *items*.
+     */
+    size_t readBulk(ConsumerId id, Span<T> items)
+    {
+        JUNK_ASSERT_RETURN(isSubscribed(id), 0);
+
+        Consumer& consumer = m_consumers[id];
+        size_t cursor = consumer.cursor.load(std::memory_order_relaxed);
+        size_t count = 0;
+
+        for (;;) {
+            const size_t available = refresh(consumer, cursor, items.length());
+            if (Policy == QueueFullPolicy::kOverwrite) {
+                cursor = skipLost(consumer, cursor, consumer.cached_published);
+            }
+
+            count = util::min(items.length(), util::min(available, S));
+            size_t done = 0;
+            while (done < count) {
+                const size_t slot = (cursor + done) % S;
+                const size_t run = util::min(count - done, S - slot);
+                copyOut(items.get() + done, cursor + done, run, Lossy(),
+                        std::is_trivially_copyable<T>());
+                done += run;
+            }
+
+            if ((Policy == QueueFullPolicy::kReject) || (count == 0)) {
+                break;
+            }
+
+            // Keep the copy only if the producer did not start overwriting it in the meantime
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const size_t claimed = m_claimed.load(std::memory_order_relaxed);
+            if ((claimed - cursor) <= S) {
+                break;
+            }
+            cursor = skipLost(consumer, cursor, claimed);
+        }
+
+        consumer.cursor.store(cursor + count, std::memory_order_release);
+        return count;
+    }
+
+    /**
+     * @brief Get the items a consumer has not read yet which are stored contiguously.
+     *
+     * The items stay in the ring, and keep the producer gated, until release() is called, so a
+     * batch can be processed in place. Only for a ring which gates the producer, since a lossy
+     * ring may overwrite the items at any time.
+     *
+     * @param[in]  id
+     *             The id of the consumer.
+     * @return A Span over the readable region. Empty if the consumer has read every item.
+     */
+    Span<const T> peekContiguous(ConsumerId id)
+    {
+        static_assert(Policy == QueueFullPolicy::kReject,
+                      "A lossy BroadcastRing may overwrite items in place, use readBulk()");
+        JUNK_ASSERT_RETURN(isSubscribed(id), Span<const T>());
+
+        Consumer& consumer = m_consumers[id];
+        const size_t cursor = consumer.cursor.load(std::memory_order_relaxed);
+        const size_t slot = cursor % S;
+        const size_t length = util::min(refresh(consumer, cursor, S - slot), S - slot);
+        if (length == 0) {
+            return Span<const T>();
+        }
+
+        return Span<const T>(item(cursor), length);
+    }
+
+    /**
+     * @brief Advance a consumer past items it has read in place.
+     *
+     * @param[in]  id
+     *             The id of the consumer.
+     * @param[in]  count
+     *             The number of items to advance past.
+     * @return A boolean:
+     *         - `true`:  The cursor was advanced.
+     *         - `false`: Fewer than *count* items are published past the cursor, nothing changed.
+     */
+    bool release(ConsumerId id, size_t count)
+    {
+        JUNK_ASSERT_RETURN(isSubscribed(id), false);
+
+        Consumer& consumer = m_consumers[id];
+        const size_t cursor = consumer.cursor.load(std::memory_order_relaxed);
+        JUNK_ASSERT_RETURN(count <= refresh(consumer, cursor, count), false);
+
+        consumer.cursor.store(cursor + count, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Get the number of published items a consumer has not read yet.
+     *
+     * For a lossy ring this may be more than *S*, the excess will be lost.
+     *
+     * @param[in]  id
+     *             The id of the consumer.
+     * @return The number of items the consumer is behind the producer.
+     */
+    size_t available(ConsumerId id) const
+    {
+        JUNK_ASSERT_RETURN(isSubscribed(id), 0);
+
+        const size_t published = m_published.load(std::memory_order_acquire);
+        const size_t cursor = m_consumers[id].cursor.load(std::memory_order_relaxed);
+        return isBehind(cursor, published) ? (published - cursor) : 0;
+    }
+
+    /**
+     * @brief Get the number of items a consumer skipped because it fell too far behind.
+     *
+     * Only a lossy ring loses items. Consumer only.
+     *
+     * @param[in]  id
+     *             The id of the consumer.
+     * @return The number of items lost since the consumer subscribed.
+     */
+    size_t lost(ConsumerId id) const
+    {
+        JUNK_ASSERT_RETURN(id < MaxConsumers, 0);
+
+        return m_consumers[id].lost;
+    }
+
+    /**
+     * @brief Get the number of items which can be held in the ring.
+     *
+     * @return The number of items which can be held in the ring.
+     */
+    size_t capacity() const
+    {
+        return S;
+    }
+
+private:
+    /**
+     * @brief A storage container which simulates the type *T*.
+     *
+     * Each StorageHelper instance has the same alignment and storage requirements as an object of
+     * type *T*.
+     */
+    struct alignas(T) StorageHelper {
+        uint8_t mem[sizeof(T)];
+    };
+
+    /// The widest word which divides an item evenly.
+    using Word = typename std::conditional<(sizeof(T) % 8U) == 0, uint64_t,
+                 typename std::conditional<(sizeof(T) % 4U) == 0, uint32_t,
+                 typename std::conditional<(sizeof(T) % 2U) == 0, uint16_t,
+                                           uint8_t>::type>::type>::type;
+
+    static constexpr size_t kNumWords = sizeof(T) / sizeof(Word);
+
+    /**
+     * @brief A slot of a lossy ring, which consumers may copy while the producer overwrites it.
+     *
+     * The item is kept as relaxed atomic words, like SeqlockItem, so a racing copy may be torn but
+     * is not a data race. The announcement check discards a torn copy.
+     */
+    struct alignas(T) AtomicStorageHelper {
+        std::atomic<Word> words[kNumWords];
+    };
+
+    /// Whether the ring overwrites items consumers may be copying.
+    using Lossy = std::integral_constant<bool, Policy == QueueFullPolicy::kOverwrite>;
+
+    /// The type of a slot in the ring.
+    using Slot = typename std::conditional<Lossy::value, AtomicStorageHelper, StorageHelper>::type;
+
+    /**
+     * @brief The state of one consumer, on a cache line of its own.
+     */
+    struct alignas(util::kCacheLineSize) Consumer {
+        /// The sequence of the next item to read. Written by the consumer, read by the producer.
+        std::atomic<size_t> cursor {0};
+        /// Whether the slot is in use.
+        std::atomic<bool> active {false};
+        /// The consumer's copy of the published sequence, refreshed when it runs out of items.
+        size_t cached_published = 0;
+        /// The number of items the consumer skipped.
+        size_t lost = 0;
+    };
+
+    T* item(size_t seq)
+    {
+        return reinterpret_cast<T*>(&m_storage[seq % S]);
+    }
+
+    /**
+     * @brief Get the number of items the producer may publish, scanning the cursors if the last
+     *        known slowest one does not leave room for *wanted*.
+     */
+    size_t room(size_t seq, size_t wanted)
+    {
+        if (Policy == QueueFullPolicy::kOverwrite) {
+            return wanted;
+        }
+
+        if ((S - (seq - m_gate)) < wanted) {
+            m_gate = seq;
+            for (size_t id = 0; id < MaxConsumers; id++) {
+                const Consumer& consumer = m_consumers[id];
+                if (consumer.active.load(std::memory_order_acquire)) {
+                    // Acquire, so the consumer is done with a slot before it is overwritten
+                    const size_t cursor = consumer.cursor.load(std::memory_order_acquire);
+                    if ((seq - cursor) > (seq - m_gate)) {
+                        m_gate = cursor;
+                    }
+                }
+            }
+        }
+
+        return S - (seq - m_gate);
+    }
+
+    /**
+     * @brief Announce that slots up to sequence *claimed* are about to be overwritten.
+     */
+    void announce(size_t claimed)
+    {
+        if (Policy == QueueFullPolicy::kOverwrite) {
+            m_claimed.store(claimed, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+        }
+    }
+
+    /**
+     * @brief Get the number of items past *cursor*, refreshing the published sequence only if the
+     *        consumer's copy says there are fewer than *wanted*.
+     */
+    size_t refresh(Consumer& consumer, size_t cursor, size_t wanted)
+    {
+        size_t available = isBehind(cursor, consumer.cached_published) ?
+                           (consumer.cached_published - cursor) : 0;
+        if (available < wanted) {
+            consumer.cached_published = m_published.load(std::memory_order_acquire);
+            available = isBehind(cursor, consumer.cached_published) ?
+                        (consumer.cached_published - cursor) : 0;
+        }
+        return available;
+    }
+
+    /**
+     * @brief Check if sequence *a* comes before sequence *b*.
+     *
+     * A lossy consumer which skipped items lost in the middle of a batch may have its cursor
+     * ahead of the published sequence until the batch is published.
+     */
+    static bool isBehind(size_t a, size_t b)
+    {
+        return static_cast<ptrdiff_t>(b - a) > 0;
+    }
+
+    /**
+     * @brief Move a lagging cursor up to the oldest item the producer is not overwriting.
+     *
+     * A cursor already skipped ahead of the published sequence, during a batch of more than *S*
+     * items, is not lagging and is left where it is.
+     *
+     * @param[in]  limit
+     *             The published or claimed sequence, items *S* or more before it are gone.
+     */
+    size_t skipLost(Consumer& consumer, size_t cursor, size_t limit)
+    {
+        if (isBehind(cursor, limit) && ((limit - cursor) > S)) {
+            consumer.lost += (limit - S) - cursor;
+            cursor = limit - S;
+        }
+        return cursor;
+    }
+
+    template <typename ... Args>
+    void construct(size_t seq, std::false_type /* lossy */, Args&&... args)
+    {
+        T* slot = item(seq);
+        if (seq >= S) {
+            slot->~T();
+        }
+        new (slot) T(std::forward<Args>(args)...);
+    }
+
+    template <typename ... Args>
+    void construct(size_t seq, std::true_type /* lossy */, Args&&... args)
+    {
+        const T value(std::forward<Args>(args)...);
+        store(seq, value);
+    }
+
+    void copyIn(size_t seq, const T* src, size_t count, std::true_type /* lossy */,
+                std::true_type /* trivial */)
+    {
+        for (size_t i = 0; i < count; i++) {
+            store(seq + i, src[i]);
+        }
+    }
+
+    void copyIn(size_t seq, const T* src, size_t count, std::false_type /* lossy */,
+                std::true_type /* trivial */)
+    {
+        std::memcpy(item(seq), src, count * sizeof(T));
+    }
+
+    void copyIn(size_t seq, const T* src, size_t count, std::false_type /* lossy */,
+                std::false_type /* trivial */)
+    {
+        for (size_t i = 0; i < count; i++) {
+            T* slot = item(seq + i);
+            if ((seq + i) >= S) {
+                slot->~T();
+            }
+            new (slot) T(src[i]);
+        }
+    }
+
+    void copyOut(T* dst, size_t seq, size_t count, std::true_type /* lossy */,
+                 std::true_type /* trivial */)
+    {
+        for (size_t i = 0; i < count; i++) {
+            load(seq + i, dst[i]);
+        }
+    }
+
+    void copyOut(T* dst, size_t seq, size_t count, std::false_type /* lossy */,
+                 std::true_type /* trivial */)
+    {
+        std::memcpy(dst, item(seq), count * sizeof(T));
+    }
+
+    void copyOut(T* dst, size_t seq, size_t count, std::false_type /* lossy */,
+                 std::false_type /* trivial */)
+    {
+        for (size_t i = 0; i < count; i++) {
+            dst[i] = *item(seq + i);
+        }
+    }
+
+    /**
+     * @brief Store an item into a lossy slot, word by word.
+     */
+    void store(size_t seq, const T& value)
+    {
+        Word words[kNumWords];
+        std::memcpy(words, &value, sizeof(T));
+        AtomicStorageHelper& slot = m_storage[seq % S];
+        for (size_t i = 0; i < kNumWords; i++) {
+            slot.words[i].store(words[i], std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Copy an item out of a lossy slot, word by word. The copy may be torn.
+     */
+    void load(size_t seq, T& value) const
+    {
+        Word words[kNumWords];
+        const AtomicStorageHelper& slot = m_storage[seq % S];
+        for (size_t i = 0; i < kNumWords; i++) {
+            words[i] = slot.words[i].load(std::memory_order_relaxed);
+        }
+        std::memcpy(&value, words, sizeof(T));
+    }
+
+    /// The sequence of the next item to publish. Written by the producer.
+    alignas(util::kCacheLineSize) std::atomic<size_t> m_published {0};
+    /// The sequence up to which slots may be being overwritten, only used by a lossy ring.
+    std::atomic<size_t> m_claimed {0};
+    /// The producer's copy of the slowest cursor, refreshed when it runs out of room.
+    size_t m_gate = 0;
+
+    /// The consumer slots.
+    Consumer m_consumers[MaxConsumers];
+
+    /// The actual storage for the ring.
+    alignas(util::kCacheLineSize) alignas(Slot) Slot m_storage[S] {};
+};
+
+template <class T, size_t S, size_t MaxConsumers, QueueFullPolicy Policy>
+constexpr typename BroadcastRing<T, S, MaxConsumers, Policy>::ConsumerId
+BroadcastRing<T, S, MaxConsumers, Policy>::kInvalidConsumer;
+
+} // namespace junk
+
+#endif // BROADCAST_RING_H
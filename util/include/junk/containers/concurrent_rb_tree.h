@@ -0,0 +1,400 @@
+/**
+ * @file   concurrent_rb_tree.h
+ * @brief  This file contains the definition of the ConcurrentRbTree container.
+ * @author Liam Bucci <liam.bucci@gmail.com>
+ * @date   2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#ifndef CONCURRENT_RB_TREE_H
+#define CONCURRENT_RB_TREE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "junk/containers/rb_tree.h"
+#include "junk/util/util.h"
+
+namespace junk {
+
+/**
+ * @brief A link between tree nodes which reader threads follow while the writer changes it.
+ *
+ * Behaves like a plain pointer, but every load and store is a relaxed atomic access. A reader
+ * racing the writer then reads some pointer the writer stored, never a torn one, and the compiler
+ * may not cache or hoist the loads. Ordering comes from the sequence lock in ConcurrentRbTree.
+ *
+ * @tparam N
+ *         The type of the node linked to.
+ */
+template <typename N>
+class RelaxedLink
+{
+public:
+    RelaxedLink(N* node = nullptr)
+    {
+        store(node);
+    }
+
+    RelaxedLink(const RelaxedLink& other)
+    {
+        store(other);
+    }
+
+    RelaxedLink& operator=(const RelaxedLink& other)
+    {
+        store(other);
+        return *this;
+    }
+
+    RelaxedLink& operator=(N* node)
+    {
+        store(node);
+        return *this;
+    }
+
+    operator N*() const
+    {
+        return m_node.load(std::memory_order_relaxed);
+    }
+
+    N* operator->() const
+    {
+        return *this;
+    }
+
+private:
+    void store(N* node)
+    {
+        m_node.store(node, std::memory_order_relaxed);
+    }
+
+    /// Left uninitialized by its constructor, the first store is atomic too.
+    std::atomic<N*> m_node;
+};
+
+/**
+ * @brief An item which reader threads copy out while the writer may be storing it.
+ *
+ * The item is kept as an array of words, each stored and loaded as a relaxed atomic. A copy racing
+ * the writer may mix old and new words, which the sequence lock in ConcurrentRbTree detects, but it
+ * is never undefined behaviour.
+ *
+ * @tparam T
+ *         The type of the item. Must be trivially copyable.
+ */
+template <typename T>
+class SeqlockItem
+{
+public:
+    /**
+     * @brief Construct the item from the given arguments and store it.
+     *
+     * @param[in]  args
+     *             The arguments forwarded to the *T* constructor.
+     */
+    template <typename ... Args>
+    explicit SeqlockItem(Args&&... args)
+    {
+        const T item(std::forward<Args>(args)...);
+        Word words[kNumWords];
+        std::memcpy(words, &item, sizeof(T));
+        for (size_t i = 0; i < kNumWords; i++) {
+            m_words[i].store(words[i], std::memory_order_relaxed);
+        }
+    }
+
+    SeqlockItem(const SeqlockItem&) = delete;
+    SeqlockItem& operator=(const SeqlockItem&) = delete;
+
+    /**
+     * @brief Copy the item out.
+     *
+     * @return A copy of the item, possibly torn if the writer is storing it.
+     */
+    T load() const
+    {
+        Word words[kNumWords];
+        for (size_t i = 0; i < kNumWords; i++) {
+            words[i] = m_words[i].load(std::memory_order_relaxed);
+        }
+        T item;
+        std::memcpy(&item, words, sizeof(T));
+        return item;
+    }
+
+private:
+    /// The widest word which divides the item evenly.
+    using Word = typename std::conditional<(sizeof(T) % 8U) == 0, uint64_t,
+                 typename std::conditional<(sizeof(T) % 4U) == 0, uint32_t,
+                 typename std::conditional<(sizeof(T) % 2U) == 0, uint16_t,
+                                           uint8_t>::type>::type>::type;
+
+    static constexpr size_t kNumWords = sizeof(T) / sizeof(Word);
+
+    std::atomic<Word> m_words[kNumWords];
+};
+
+/**
+ * @brief Extracts the key of an item stored in a SeqlockItem, or of a plain item.
+ *
+ * @tparam T
+ *         The type of the item.
+ * @tparam KeyOf
+ *         The functor which extracts the key of a plain item.
+ */
+template <typename T, typename KeyOf>
+struct SeqlockKeyOf
+{
+    /// The key of an item, held by value since a SeqlockItem can only be copied out.
+    using Key = typename std::decay<decltype(KeyOf()(std::declval<const T&>()))>::type;
+
+    const Key& operator()(const T& item) const
+    {
+        return KeyOf()(item);
+    }
+
+    Key operator()(const SeqlockItem<T>& item) const
+    {
+        return KeyOf()(item.load());
+    }
+};
+
+/**
+ * @brief A Red-Black Tree with one writer thread and any number of lock-free reader threads.
+ *
+ * Readers are validated with a sequence lock. The writer makes the sequence odd before changing the
+ * tree and even again afterwards. A reader notes the sequence, descends the tree and copies out the
+ * item it finds, then checks that the sequence did not change. If it changed the reader retries.
+ * Readers never write shared memory, so they do not contend with each other and lookups scale with
+ * the number of reader threads.
+ *
+ * Nodes are never freed to the system, only returned to the pool, so a reader racing the writer
+ * always reads pool memory, even if the node it holds was erased and reused. Any such read is
+ * discarded by the sequence check. A descent is also cut off at the largest possible tree height,
+ * so pointers caught mid-rotation cannot trap a reader in a cycle.
+ *
+ * Everything a reader touches is accessed atomically, with relaxed ordering, on both sides: the
+ * root and child links are RelaxedLinks and items are kept in SeqlockItems. A racing read may be
+ * stale or torn, but is never undefined behaviour, and the sequence check discards it.
+ *
+ * @warning Only one thread may call the writer functions (insert(), emplace(), erase()) at a time.
+ *          Readers may call find() and contains() at any time from any thread. Needs `<atomic>`,
+ *          so this container is intended for host builds.
+ *
+ * @tparam NumNodes
+ *         Maximum number of nodes that may be stored in the tree.
+ * @tparam T
+ *         The type stored in each node. Must be default constructible and trivially copyable,
+ *         readers copy items out while the writer may be changing them.
+ * @tparam Compare
+ *         The three-way predicate used to order keys. Must tolerate the torn keys a reader may see
+ *         during a write, and must not have side effects. See RbTree.
+ * @tparam KeyOf
+ *         The functor which extracts the key of an item. See RbTree.
+ */
+template <size_t NumNodes,
+          typename T,
+          typename Compare = util::ThreeWayCompare,
+          typename KeyOf = util::Identity>
+class ConcurrentRbTree : private RbTree<NumNodes, SeqlockItem<T>, Compare, SeqlockKeyOf<T, KeyOf>,
+                                        NoAugmentation, RelaxedLink>
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "ConcurrentRbTree readers copy items, T must be trivially copyable");
+
+    using Base = RbTree<NumNodes, SeqlockItem<T>, Compare, SeqlockKeyOf<T, KeyOf>,
+                        NoAugmentation, RelaxedLink>;
+    using Node = typename Base::Node;
+
+public:
+    using Base::Base;
+    using Base::capacity;
+
+    /**
+     * @brief Insert an item. Writer only.
+     *
+     * @param[in]  item
+     *             The item to copy into the tree.
+     * @return A boolean:
+     *         - `true`:  The item was inserted.
+     *         - `false`: The tree was full.
+     */
+    bool insert(const T& item)
+    {
+        WriteSection section(m_sequence);
+        return Base::emplace(item);
+    }
+
+    /**
+     * @brief Construct an item in place. Writer only.
+     *
+     * @param[in]  args
+     *             The arguments forwarded to the *T* constructor.
+     * @return A boolean:
+     *         - `true`:  The item was constructed in the tree.
+     *         - `false`: The tree was full.
+     */
+    template <typename ... Args>
+    bool emplace(Args&&... args)
+    {
+        WriteSection section(m_sequence);
+        return Base::emplace(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Remove the item matching a key. Writer only.
+     *
+     * @param[in]  key
+     *             The key to remove.
+     * @return A boolean:
+     *         - `true`:  A matching item was removed.
+     *         - `false`: No match was found.
+     */
+    template <typename K>
+    bool erase(const K& key)
+    {
+        WriteSection section(m_sequence);
+        return Base::erase(key);
+    }
+
+    /**
+     * @brief Get the current number of items in the tree. Writer only.
+     *
+     * @return The current number of items in the tree.
+     */
+    size_t size() const
+    {
+        return Base::size();
+    }
+
+    /**
+     * @brief Search for a key and copy out the matching item. Safe from any thread.
+     *
+     * @param[in]  key
+     *             The key to search for.
+     * @param[out] item
+     *             Set to a copy of the matching item. Unchanged if there is no match.
+     * @return A boolean:
+     *         - `true`:  A matching item was found and copied.
+     *         - `false`: No match was found.
+     */
+    template <typename K>
+    bool find(const K& key, T& item) const
+    {
+        T copy;
+        while (true) {
+            const uint32_t sequence = m_sequence.load(std::memory_order_acquire);
+            if ((sequence & 1U) != 0) {
+                // A write is in progress, let the writer run
+                std::this_thread::yield();
+                continue;
+            }
+
+            const bool found = readItem(key, copy);
+
+            // Order the reads of the tree before the validating read of the sequence
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (m_sequence.load(std::memory_order_relaxed) == sequence) {
+                if (found) {
+                    item = copy;
+                }
+                return found;
+            }
+        }
+    }
+
+    /**
+     * @brief Check if the tree contains a key. Safe from any thread.
+     *
+     * @param[in]  key
+     *             The key to search for.
+     * @return `true` if a matching item was found, otherwise `false`.
+     */
+    template <typename K>
+    bool contains(const K& key) const
+    {
+        T item;
+        return find(key, item);
+    }
+
+private:
+    /**
+     * @brief Marks the tree as changing for as long as it is in scope.
+     */
+    class WriteSection
+    {
+    public:
+        explicit WriteSection(std::atomic<uint32_t>& sequence) : m_sequence(sequence)
+        {
+            // Only the writer changes the sequence, so it needs no read-modify-write
+            m_sequence.store(m_sequence.load(std::memory_order_relaxed) + 1U,
+                             std::memory_order_relaxed);
+            // Order the odd sequence before any write to the tree
+            std::atomic_thread_fence(std::memory_order_release);
+        }
+
+        ~WriteSection()
+        {
+            m_sequence.store(m_sequence.load(std::memory_order_relaxed) + 1U,
+                             std::memory_order_release);
+        }
+
+        WriteSection(const WriteSection&) = delete;
+        WriteSection& operator=(const WriteSection&) = delete;
+
+    private:
+        std::atomic<uint32_t>& m_sequence;
+    };
+
+    /**
+     * @brief Get an upper bound on the height of a red-black tree, `2 * log2(n + 1)`.
+     *
+     * @param[in]  n
+     *             The number of nodes in the tree.
+     * @return The maximum number of nodes on any path from the root.
+     */
+    static constexpr size_t maxHeight(size_t n)
+    {
+        return (n == 0) ? 0 : (2U + maxHeight(n / 2U));
+    }
+
+    /**
+     * @brief Descend the tree once and copy out the matching item, without validation.
+     *
+     * @param[in]  key
+     *             The key to search for.
+     * @param[out] item
+     *             Set to a copy of the matching item, if found.
+     * @return `true` if a matching item was found, otherwise `false`.
+     */
+    template <typename K>
+    bool readItem(const K& key, T& item) const
+    {
+        const Node* current = this->m_root;
+        for (size_t depth = 0; (current != nullptr) && (depth < maxHeight(NumNodes)); depth++) {
+            // Compare on a copy, the item in the node may change at any time
+            const T candidate = current->item.load();
+            const int result = this->m_compare(key, KeyOf()(candidate));
+            if (result == 0) {
+                item = candidate;
+                return true;
+            }
+            current = (result < 0) ? current->left : current->right;
+        }
+
+        return false;
+    }
+
+    /// Even while the tree is stable, odd while the writer is changing it.
+    mutable std::atomic<uint32_t> m_sequence {0};
+};
+
+} // namespace junk
+
+#endif // CONCURRENT_RB_TREE_H
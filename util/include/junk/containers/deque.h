@@ -0,0 +1,586 @@
+/**
+ * @file   deque.h
+ * @brief  This file contains the definition of the Deque container.
+ * @author Liam Bucci <liam.bucci@gmail.com>
+ * @date   2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#ifndef DEQUE_H
+#define DEQUE_H
+
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "junk/containers/span.h"
+#include "junk/util/junk_assert.h"
+#include "junk/util/util.h"
+
+namespace junk {
+
+/**
+ * @brief Deque container class.
+ *
+ * This class is a container which acts as a double-ended circular buffer. Items are added and
+ * removed at either end in O(1), and any item can be reached by its index from the front in O(1).
+ * It can be used with any type as long as the type is either copyable or movable.
+ *
+ * The items are kept in one ring of inline storage, so they occupy at most two contiguous
+ * segments: one up to the end of the storage and one from its start. The bulk operations copy each
+ * segment in one go. A power-of-two capacity wraps indices with a mask instead of a branch.
+ *
+ * @tparam T
+ *         The type stored by this container.
+ * @tparam N
+ *         The maximum number of items that may be stored in this container.
+ */
+template <class T, size_t N>
+class Deque
+{
+    static_assert(N > 0U, "Deque needs a capacity of at least 1");
+
+public:
+    Deque() = default;
+
+    /**
+     * @brief Destructor for Deque container.
+     *
+     * The destructor ensures all remaining internal items are destructed.
+     */
+    ~Deque()
+    {
+        clear();
+    }
+
+    Deque(const Deque&) = delete;
+    Deque& operator=(const Deque&) = delete;
+
+    /**
+     * @brief Add an item at the back of the deque (by copying).
+     *
+     * @param[in]  item
+     *             The item to store in the deque.
+     * @return A boolean:
+     *         - `true`:  The item was stored successfully in the deque.
+     *         - `false`: The deque was full.
+     */
+    bool pushBack(const T& item)
+    {
+        return emplaceBack(item);
+    }
+
+    /**
+     * @brief Add an item at the back of the deque (by moving).
+     *
+     * @param[in]  item
+     *             The item to move into the deque.
+     * @return A boolean:
+     *         - `true`:  The item was moved successfully into the deque.
+     *         - `false`: The deque was full.
+     */
+    bool pushBack(T&& item)
+    {
+        return emplaceBack(std::move(item));
+    }
+
+    /**
+     * @brief Add an item at the front of the deque (by copying).
+     *
+     * @param[in]  item
+     *             The item to store in the deque.
+     * @return A boolean:
+     *         - `true`:  The item was stored successfully in the deque.
+     *         - `false`: The deque was full.
+     */
+    bool pushFront(const T& item)
+    {
+        return emplaceFront(item);
+    }
+
+    /**
+     * @brief Add an item at the front of the deque (by moving).
+     *
+     * @param[in]  item
+     *             The item to move into the deque.
+     * @return A boolean:
+     *         - `true`:  The item was moved successfully into the deque.
+     *         - `false`: The deque was full.
+     */
+    bool pushFront(T&& item)
+    {
+        return emplaceFront(std::move(item));
+    }
+
+    /**
+     * @brief Construct an item in place at the back of the deque.
+     *
+     * @param[in]  args
+     *             The parameter pack of template arguments that will be forwarded to the type *T*
+     *             constructor.
+     * @return A boolean:
+     *         - `true`:  The item was emplaced at the back of the deque.
+     *         - `false`: The deque was full.
+     */
+    template <typename ... Args>
+    bool emplaceBack(Args&&... args)
+    {
+        if (isFull()) {
+            return false;
+        }
+
+        new (item(slotOf(m_size))) T(std::forward<Args>(args)...);
+        m_size++;
+        return true;
+    }
+
+    /**
+     * @brief Construct an item in place at the front of the deque.
+     *
+     * @param[in]  args
+     *             The parameter pack of template arguments that will be forwarded to the type *T*
+     *             constructor.
+     * @return A boolean:
+     *         - `true`:  The item was emplaced at the front of the deque.
+     *         - `false`: The deque was full.
+     */
+    template <typename ... Args>
+    bool emplaceFront(Args&&... args)
+    {
+        if (isFull()) {
+            return false;
+        }
+
+        // One step back from the head, wrapping to the end of the storage
+        const size_t slot = slotOf(N - 1U);
+        new (item(slot)) T(std::forward<Args>(args)...);
+        m_head = slot;
+        m_size++;
+        return true;
+    }
+
+    /**
+     * @brief Retrieve the item at the back of the deque.
+     *
+     * The item is moved into *out* and then removed from the deque.
+     *
+     * @param[out] out
+     *             The retrieved item.
+     * @return A boolean:
+     *         - `true`:  An item was successfully retrieved.
+     *         - `false`: The deque was empty.
+     */
+    bool popBack(T& out)
+    {
+        if (isEmpty()) {
+            return false;
+        }
+
+        T* last = item(slotOf(m_size - 1U));
+        out = std::move(*last);
+        last->~T();
+        m_size--;
+        return true;
+    }
+
+    /**
+     * @brief Remove the item at the back of the deque.
+     *
+     * @return A boolean:
+     *         - `true`:  An item was removed.
+     *         - `false`: The deque was empty.
+     */
+    bool popBack()
+    {
+        if (isEmpty()) {
+            return false;
+        }
+
+        item(slotOf(m_size - 1U))->~T();
+        m_size--;
+        return true;
+    }
+
+    /**
+     * @brief Retrieve the item at the front of the deque.
+     *
+     * The item is moved into *out* and then removed from the deque.
+     *
+     * @param[out] out
+     *             The retrieved item.
+     * @return A boolean:
+     *         - `true`:  An item was successfully retrieved.
+     *         - `false`: The deque was empty.
+     */
+    bool popFront(T& out)
+    {
+        if (isEmpty()) {
+            return false;
+        }
+
+        out = std::move(*item(m_head));
+        return popFront();
+    }
+
+    /**
+     * @brief Remove the item at the front of the deque.
+     *
+     * @return A boolean:
+     *         - `true`:  An item was removed.
+     *         - `false`: The deque was empty.
+     */
+    bool popFront()
+    {
+        if (isEmpty()) {
+            return false;
+        }
+
+        item(m_head)->~T();
+        m_head = slotOf(1U);
+        m_size--;
+        return true;
+    }
+
+    /**
+     * @brief Get the item at the front of the deque.
+     *
+     * @pre  The deque must not be empty.
+     *
+     * @return A reference to the front item.
+     */
+    T& front()
+    {
+        return at(0);
+    }
+
+    /// @copydoc front()
+    const T& front() const
+    {
+        return at(0);
+    }
+
+    /**
+     * @brief Get the item at the back of the deque.
+     *
+     * @pre  The deque must not be empty.
+     *
+     * @return A reference to the back item.
+     */
+    T& back()
+    {
+        return at(m_size - 1U);
+    }
+
+    /// @copydoc back()
+    const T& back() const
+    {
+        return at(m_size - 1U);
+    }
+
+    /**
+     * @brief Array subscript operator.
+     *
+     * @pre  *i* must be strictly less than the size of the deque.
+     *
+     * @param[in]  i
+     *             The index of the item to return, counted from the front.
+     * @return The item at index *i*.
+     */
+    T& operator[](const size_t i)
+    {
+        return at(i);
+    }
+
+    /**
+     * @brief Const array subscript operator.
+     *
+     * @pre  *i* must be strictly less than the size of the deque.
+     *
+     * @param[in]  i
+     *             The index of the item to return, counted from the front.
+     * @return The item at index *i*.
+     */
+    const T& operator[](const size_t i) const
+    {
+        return at(i);
+    }
+
+    /**
+     * @brief Retrieve an item of the deque.
+     *
+     * @pre  *i* must be strictly less than the size of the deque.
+     *
+     * @param[in]  i
+     *             The index of the item to return, counted from the front.
+     * @return The item at index *i*.
+     */
+    T& at(const size_t i)
+    {
+        JUNK_ASSERT(i < m_size);
+        return *item(slotOf(i));
+    }
+
+    /**
+     * @brief Retrieve an item of the const deque.
+     *
+     * @pre  *i* must be strictly less than the size of the deque.
+     *
+     * @param[in]  i
+     *             The index of the item to return, counted from the front.
+     * @return The item at index *i*.
+     */
+    const T& at(const size_t i) const
+    {
+        JUNK_ASSERT(i < m_size);
+        return *item(slotOf(i));
+    }
+
+    /**
+     * @brief Add as many of the given items at the back of the deque as fit.
+     *
+     * The items are copied in at most two contiguous runs. Trivially copyable items are copied with
+     * `memcpy`, others are copy constructed in place.
+     *
+     * @param[in]  items
+     *             The items to store, in order. The first item follows the current back.
+     * @return The number of items taken from the front of *items*. Less than the length of *items*
+     *         if the deque became full.
+     */
+    size_t pushBackBulk(Span<const T> items)
+    {
+        const size_t count = util::min(items.length(), N - m_size);
+        const T* src = items.cget();
+
+        size_t done = 0;
+        while (done < count) {
+            const size_t slot = slotOf(m_size);
+            const size_t run = util::min(count - done, N - slot);
+            copyIn(slot, src + done, run, std::is_trivially_copyable<T>());
+            m_size += run;
+            done += run;
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief Add as many of the given items at the front of the deque as fit.
+     *
+     * The items keep their order, so the first item taken becomes the new front. The items are
+     * copied in at most two contiguous runs.
+     *
+     * @param[in]  items
+     *             The items to store, in order. The last item taken precedes the current front.
+     * @return The number of items taken from the front of *items*. Less than the length of *items*
+     *         if the deque became full.
+     */
+    size_t pushFrontBulk(Span<const T> items)
+    {
+        const size_t count = util::min(items.length(), N - m_size);
+        const T* src = items.cget();
+        const size_t head = slotOf(N - count);
+
+        size_t done = 0;
+        while (done < count) {
+            const size_t slot = wrap(head + done);
+            const size_t run = util::min(count - done, N - slot);
+            copyIn(slot, src + done, run, std::is_trivially_copyable<T>());
+            done += run;
+        }
+        m_head = head;
+        m_size += count;
+
+        return count;
+    }
+
+    /**
+     * @brief Remove as many items from the front of the deque as fit in *items*.
+     *
+     * The items are copied out in at most two contiguous runs. Trivially copyable items are copied
+     * with `memcpy`, others are moved into *items* and then destructed in the deque.
+     *
+     * @param[out] items
+     *             The retrieved items, front first.
+     * @return The number of items retrieved into the front of *items*. Less than the length of
+     *         *items* if the deque became empty.
+     */
+    size_t popFrontBulk(Span<T> items)
+    {
+        const size_t count = util::min(items.length(), m_size);
+        T* dst = items.get();
+
+        size_t done = 0;
+        while (done < count) {
+            const size_t run = util::min(count - done, N - m_head);
+            moveOut(m_head, dst + done, run, std::is_trivially_copyable<T>());
+            m_head = wrap(m_head + run);
+            m_size -= run;
+            done += run;
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief Remove as many items from the back of the deque as fit in *items*.
+     *
+     * The items keep their order, so the last item of the deque ends up last in *items*. The items
+     * are copied out in at most two contiguous runs.
+     *
+     * @param[out] items
+     *             The retrieved items, in deque order.
+     * @return The number of items retrieved into the front of *items*. Less than the length of
+     *         *items* if the deque became empty.
+     */
+    size_t popBackBulk(Span<T> items)
+    {
+        const size_t count = util::min(items.length(), m_size);
+        const size_t first = m_size - count;
+        T* dst = items.get();
+
+        size_t done = 0;
+        while (done < count) {
+            const size_t slot = slotOf(first + done);
+            const size_t run = util::min(count - done, N - slot);
+            moveOut(slot, dst + done, run, std::is_trivially_copyable<T>());
+            done += run;
+        }
+        m_size = first;
+
+        return count;
+    }
+
+    /**
+     * @brief Remove all items from the deque.
+     */
+    void clear()
+    {
+        while (popBack()) {}
+        m_head = 0;
+    }
+
+    /**
+     * @brief Check if the deque is full.
+     *
+     * @return A boolean:
+     *         - `true`:  The deque is full.
+     *         - `false`: The deque is not full.
+     */
+    bool isFull() const
+    {
+        return (m_size >= N);
+    }
+
+    /**
+     * @brief Check if the deque is empty.
+     *
+     * @return A boolean:
+     *         - `true`:  The deque is empty.
+     *         - `false`: The deque is not empty.
+     */
+    bool isEmpty() const
+    {
+        return (m_size == 0);
+    }
+
+    /**
+     * @brief Get the current number of items in the deque.
+     *
+     * @return The current number of items in the deque.
+     */
+    size_t size() const
+    {
+        return m_size;
+    }
+
+    /**
+     * @brief Get the maximum number of items that can be stored by the deque.
+     *
+     * @return The maximum number of items that can be stored by the deque.
+     */
+    size_t capacity() const
+    {
+        return N;
+    }
+
+private:
+    /**
+     * @brief A storage container which simulates the type *T*.
+     *
+     * Each StorageHelper instance has the same alignment and storage requirements as an object of
+     * type *T*.
+     */
+    struct alignas(T) StorageHelper {
+        uint8_t mem[sizeof(T)];
+    };
+
+    /**
+     * @brief Wrap a position less than twice the capacity back into the storage.
+     */
+    static size_t wrap(size_t position)
+    {
+        if (util::isPow2(N)) {
+            return position & (N - 1U);
+        }
+        return (position >= N) ? (position - N) : position;
+    }
+
+    /**
+     * @brief Get the slot of the item at an index from the front.
+     *
+     * An index of `N - 1` is the slot just before the front.
+     */
+    size_t slotOf(size_t index) const
+    {
+        return wrap(m_head + index);
+    }
+
+    T* item(size_t slot)
+    {
+        return reinterpret_cast<T*>(&m_storage[slot]);
+    }
+
+    const T* item(size_t slot) const
+    {
+        return reinterpret_cast<const T*>(&m_storage[slot]);
+    }
+
+    void copyIn(size_t slot, const T* src, size_t count, std::true_type /* trivial */)
+    {
+        std::memcpy(&m_storage[slot], src, count * sizeof(T));
+    }
+
+    void copyIn(size_t slot, const T* src, size_t count, std::false_type /* trivial */)
+    {
+        for (size_t i = 0; i < count; i++) {
+            new (item(slot + i)) T(src[i]);
+        }
+    }
+
+    void moveOut(size_t slot, T* dst, size_t count, std::true_type /* trivial */)
+    {
+        std::memcpy(dst, &m_storage[slot], count * sizeof(T));
+    }
+
+    void moveOut(size_t slot, T* dst, size_t count, std::false_type /* trivial */)
+    {
+        for (size_t i = 0; i < count; i++) {
+            dst[i] = std::move(*item(slot + i));
+            item(slot + i)->~T();
+        }
+    }
+
+    /// The slot of the item at the front of the deque.
+    size_t m_head = 0;
+    /// The current number of items in the deque.
+    size_t m_size = 0;
+
+    /// The actual storage for the deque.
+    StorageHelper m_storage[N] {};
+};
+
+} // namespace junk
+
+#endif // DEQUE_H
@@ -0,0 +1,558 @@
+/**
+ * @file   fixed_hash_map.h
+ * @brief  This file contains the definition of the FixedHashMap container.
+ * @author Liam Bucci <liam.bucci@gmail.com>
+ * @date   2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#ifndef FIXED_HASH_MAP_H
+#define FIXED_HASH_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <utility>
+
+#if !defined(JUNK_DISABLE_SIMD) && defined(__SSE2__)
+#define JUNK_HASH_MAP_SSE2 1
+#include <emmintrin.h>
+#elif !defined(JUNK_DISABLE_SIMD) && defined(__ARM_NEON)
+#define JUNK_HASH_MAP_NEON 1
+#include <arm_neon.h>
+#endif
+
+#include "junk/containers/key_pair.h"
+#include "junk/util/junk_assert.h"
+#include "junk/util/util.h"
+
+namespace junk {
+
+/**
+ * @brief A group of control bytes which are probed together.
+ *
+ * Each control byte describes one slot: kEmpty, or the low 7 bits of the hash of the key stored in
+ * the slot. A probe compares a whole group against a hash fragment at once and returns a bit mask
+ * with one bit (SSE2 and scalar) or one nibble (NEON) per matching slot. SSE2 and NEON probe 16
+ * slots per instruction, the scalar fallback used on AVR probes 8 slots one byte at a time.
+ * Defining `JUNK_DISABLE_SIMD` forces the scalar fallback.
+ */
+struct ControlGroup
+{
+    /// The control byte of an empty slot. Full slots never have the high bit set.
+    static constexpr uint8_t kEmpty = 0x80U;
+
+#if defined(JUNK_HASH_MAP_SSE2)
+    /// The type of a match mask.
+    using Mask = uint32_t;
+    /// The number of slots in a group.
+    static constexpr size_t kWidth = 16U;
+    /// log2 of the number of mask bits per slot.
+    static constexpr unsigned kShift = 0U;
+
+    static Mask match(const uint8_t* ctrl, uint8_t fragment)
+    {
+        const __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+        const __m128i eq = _mm_cmpeq_epi8(group, _mm_set1_epi8(static_cast<char>(fragment)));
+        return static_cast<Mask>(_mm_movemask_epi8(eq));
+    }
+
+    static Mask matchEmpty(const uint8_t* ctrl)
+    {
+        // Only empty slots have the high bit set
+        const __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+        return static_cast<Mask>(_mm_movemask_epi8(group));
+    }
+#elif defined(JUNK_HASH_MAP_NEON)
+    using Mask = uint64_t;
+    static constexpr size_t kWidth = 16U;
+    static constexpr unsigned kShift = 2U;
+
+    static Mask toMask(uint8x16_t eq)
+    {
+        // Narrow each 0x00/0xFF byte to a nibble, NEON has no movemask
+        const uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(eq), 4);
+        return vget_lane_u64(vreinterpret_u64_u8(nibbles), 0);
+    }
+
+    static Mask match(const uint8_t* ctrl, uint8_t fragment)
+    {
+        return toMask(vceqq_u8(vld1q_u8(ctrl), vdupq_n_u8(fragment)));
+    }
+
+    static Mask matchEmpty(const uint8_t* ctrl)
+    {
+        return toMask(vtstq_u8(vld1q_u8(ctrl), vdupq_n_u8(kEmpty)));
+    }
+#else
+    using Mask = uint8_t;
+    static constexpr size_t kWidth = 8U;
+    static constexpr unsigned kShift = 0U;
+
+    static Mask match(const uint8_t* ctrl, uint8_t fragment)
+    {
+        Mask mask = 0;
+        for (size_t i = 0; i < kWidth; i++) {
+            if (ctrl[i] == fragment) {
+                mask |= static_cast<Mask>(1U << i);
+            }
+        }
+        return mask;
+    }
+
+    static Mask matchEmpty(const uint8_t* ctrl)
+    {
+        return match(ctrl, kEmpty);
+    }
+#endif
+
+    /**
+     * @brief Get the slot offset of the lowest set bit of a non-zero mask.
+     *
+     * @param[in]  mask
+     *             The match mask. Must not be `0`.
+     * @return The offset of the slot within the group.
+     */
+    static size_t lowest(Mask mask)
+    {
+        return static_cast<size_t>(__builtin_ctzll(mask)) >> kShift;
+    }
+
+    /**
+     * @brief Clear the lowest matching slot of a mask.
+     *
+     * @param[in]  mask
+     *             The match mask. Must not be `0`.
+     * @return The mask without its lowest matching slot.
+     */
+    static Mask clearLowest(Mask mask)
+    {
+        const Mask slot_bits = static_cast<Mask>((1U << (1U << kShift)) - 1U);
+        return static_cast<Mask>(mask & ~static_cast<Mask>(slot_bits << (lowest(mask) << kShift)));
+    }
+
+    /**
+     * @brief Keep only the matches before a slot offset.
+     *
+     * @param[in]  mask
+     *             The match mask.
+     * @param[in]  offset
+     *             The slot offset, at most kWidth.
+     * @return The mask with every match at or after *offset* cleared.
+     */
+    static Mask before(Mask mask, size_t offset)
+    {
+        return (offset >= kWidth) ? mask :
+               static_cast<Mask>(mask & ((static_cast<Mask>(1U) << (offset << kShift)) - 1U));
+    }
+};
+
+/**
+ * @brief A fixed-capacity unordered map using open addressing.
+ *
+ * Entries live in a single array of slots, with no heap and no per-entry pointers. A parallel array
+ * of one-byte control codes holds 7 bits of each key's hash, so a lookup compares a whole group of
+ * control bytes at once (see ControlGroup) and only touches slots whose fragment matches. Keys are
+ * placed by linear probing, so an entry always sits between its home slot and the next empty slot.
+ * Erasing shifts the following entries of the run back instead of leaving tombstones, so lookups
+ * never slow down as entries come and go.
+ *
+ * The slot count is a power of two with at least 1/8 of the slots always empty, which bounds probe
+ * lengths and guarantees every probe ends.
+ *
+ * @tparam Key
+ *         The key type. Must be EqualityComparable.
+ * @tparam Value
+ *         The mapped value type.
+ * @tparam N
+ *         The maximum number of entries that may be stored in the map.
+ * @tparam Hash
+ *         The hash function, with a signature similar to `size_t hash(const Key& key)`. Defaults
+ *         to util::Hash, which supports integer and enum keys.
+ */
+template <typename Key, typename Value, size_t N, typename Hash = util::Hash>
+class FixedHashMap
+{
+public:
+    /// The type of an entry.
+    using Entry = KeyPair<Key,Value>;
+
+    FixedHashMap()
+    {
+        std::memset(m_ctrl, ControlGroup::kEmpty, sizeof(m_ctrl));
+    }
+
+    /**
+     * @brief Destructor. Destructs all remaining entries.
+     */
+    ~FixedHashMap()
+    {
+        clear();
+    }
+
+    FixedHashMap(const FixedHashMap&) = delete;
+    FixedHashMap& operator=(const FixedHashMap&) = delete;
+
+    /**
+     * @brief Find the value mapped to the given key.
+     *
+     * @param[in]  key
+     *             The key to search for.
+     * @return A pointer to the mapped value, or `nullptr` if the key is not in the map.
+     */
+    Value* find(const Key& key)
+    {
+        const size_t slot = findSlot(key, m_hash(key));
+        return (slot != kNotFound) ? &(entry(slot)->value) : nullptr;
+    }
+
+    /**
+     * @brief Const overload of find().
+     * @overload
+     */
+    const Value* find(const Key& key) const
+    {
+        const size_t slot = findSlot(key, m_hash(key));
+        return (slot != kNotFound) ? &(entry(slot)->value) : nullptr;
+    }
+
+    /**
+     * @brief Check if the map contains the given key.
+     *
+     * @param[in]  key
+     *             The key to search for.
+     * @return `true` if the key is in the map, otherwise `false`.
+     */
+    bool contains(const Key& key) const
+    {
+        return (findSlot(key, m_hash(key)) != kNotFound);
+    }
+
+    /**
+     * @brief Construct a value in place if the key is not already present.
+     *
+     * @param[in]  key
+     *             The key to insert.
+     * @param[in]  args
+     *             The arguments forwarded to the *Value* constructor.
+     * @return A boolean:
+     *         - `true`:  A new entry was constructed.
+     *         - `false`: The key was already present, or the map was full.
+     */
+    template <typename ... Args>
+    bool tryEmplace(const Key& key, Args&&... args)
+    {
+        bool inserted = false;
+        findOrEmplace(key, inserted, std::forward<Args>(args)...);
+        return inserted;
+    }
+
+    /**
+     * @brief Insert a new entry, or assign the value of an existing entry.
+     *
+     * Hashes the key and probes once. A missing key is constructed in the first empty slot seen
+     * while probing. A present key has its value assigned in its slot, its control byte unchanged.
+     *
+     * @param[in]  key
+     *             The key to insert or update.
+     * @param[in]  value
+     *             The value to copy or move into the map.
+     * @return A boolean:
+     *         - `true`:  The entry was inserted or assigned.
+     *         - `false`: The key was not present and the map was full.
+     */
+    template <typename V>
+    bool insertOrAssign(const Key& key, V&& value)
+    {
+        bool inserted = false;
+        Value* mapped = findOrEmplace(key, inserted, std::forward<V>(value));
+        if (mapped == nullptr) {
+            return false;
+        }
+
+        // The key was found while probing, so value is still intact and can be assigned
+        if (!inserted) {
+            *mapped = std::forward<V>(value);
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Access the value mapped to a key, default constructing it if not present.
+     *
+     * @pre  The key must be present or the map must not be full.
+     *
+     * @param[in]  key
+     *             The key to access.
+     * @return A reference to the mapped value.
+     */
+    Value& operator[](const Key& key)
+    {
+        bool inserted = false;
+        Value* mapped = findOrEmplace(key, inserted);
+        JUNK_ASSERT(mapped != nullptr);
+        return *mapped;
+    }
+
+    /**
+     * @brief Remove the entry with the given key.
+     *
+     * The entries following it in its probe run are shifted back, so no tombstone is left.
+     *
+     * @param[in]  key
+     *             The key to remove.
+     * @return A boolean:
+     *         - `true`:  The entry was removed.
+     *         - `false`: The key was not in the map.
+     */
+    bool erase(const Key& key)
+    {
+        size_t hole = findSlot(key, m_hash(key));
+        if (hole == kNotFound) {
+            return false;
+        }
+
+        size_t slot = hole;
+        while (true) {
+            slot = (slot + 1U) & kSlotMask;
+            if (m_ctrl[slot] == ControlGroup::kEmpty) {
+                break;
+            }
+
+            // An entry may fill the hole only if its home is not between the hole and its slot
+            const size_t home = homeSlot(m_hash(entry(slot)->key));
+            const bool stays = (hole <= slot) ? ((hole < home) && (home <= slot)) :
+                                                ((hole < home) || (home <= slot));
+            if (!stays) {
+                entry(hole)->~Entry();
+                new (entry(hole)) Entry(std::move(*entry(slot)));
+                setCtrl(hole, m_ctrl[slot]);
+                hole = slot;
+            }
+        }
+
+        entry(hole)->~Entry();
+        setCtrl(hole, ControlGroup::kEmpty);
+        m_size--;
+
+        return true;
+    }
+
+    /**
+     * @brief Remove all entries.
+     */
+    void clear()
+    {
+        for (size_t slot = 0; slot < kNumSlots; slot++) {
+            if (m_ctrl[slot] != ControlGroup::kEmpty) {
+                entry(slot)->~Entry();
+            }
+        }
+        std::memset(m_ctrl, ControlGroup::kEmpty, sizeof(m_ctrl));
+        m_size = 0;
+    }
+
+    /**
+     * @brief Call a function for every entry in the map, in no particular order.
+     *
+     * @param[in]  fn
+     *             The function to call. Must have a signature similar to
+     *             `void fn(const Key& key, Value& value)`.
+     */
+    template <typename F>
+    void forEach(F fn)
+    {
+        for (size_t slot = 0; slot < kNumSlots; slot++) {
+            if (m_ctrl[slot] != ControlGroup::kEmpty) {
+                fn(static_cast<const Key&>(entry(slot)->key), entry(slot)->value);
+            }
+        }
+    }
+
+    /**
+     * @brief Get the current number of entries in the map.
+     *
+     * @return The current number of entries in the map.
+     */
+    size_t size() const
+    {
+        return m_size;
+    }
+
+    /**
+     * @brief Get the maximum number of entries that can be stored in the map.
+     *
+     * @return The maximum number of entries that can be stored in the map.
+     */
+    size_t capacity() const
+    {
+        return N;
+    }
+
+    /**
+     * @brief Check if the map is empty.
+     *
+     * @return `true` if the map is empty, otherwise `false`.
+     */
+    bool isEmpty() const
+    {
+        return (m_size == 0);
+    }
+
+    /**
+     * @brief Check if the map is full.
+     *
+     * @return `true` if the map is full, otherwise `false`.
+     */
+    bool isFull() const
+    {
+        return (m_size >= N);
+    }
+
+private:
+    /// The number of slots, leaving at least 1/8 of them empty when the map is full.
+    static constexpr size_t kNumSlots = util::roundUpPow2(N + (N / 8U) + 1U, ControlGroup::kWidth);
+    /// Mask which wraps a slot index.
+    static constexpr size_t kSlotMask = kNumSlots - 1U;
+    /// Returned by findSlot() when the key is not present.
+    static constexpr size_t kNotFound = ~static_cast<size_t>(0);
+
+    /**
+     * @brief A storage container which simulates an Entry.
+     */
+    struct alignas(Entry) StorageHelper {
+        uint8_t mem[sizeof(Entry)];
+    };
+
+    static size_t homeSlot(size_t hash)
+    {
+        return (hash >> 7) & kSlotMask;
+    }
+
+    static uint8_t fragment(size_t hash)
+    {
+        return static_cast<uint8_t>(hash & 0x7FU);
+    }
+
+    Entry* entry(size_t slot)
+    {
+        return reinterpret_cast<Entry*>(&m_slots[slot]);
+    }
+
+    const Entry* entry(size_t slot) const
+    {
+        return reinterpret_cast<const Entry*>(&m_slots[slot]);
+    }
+
+    /**
+     * @brief Set the control byte of a slot, and of its copy past the end of the array.
+     *
+     * The first group of control bytes is repeated after the last slot, so a group can be loaded
+     * starting at any slot without wrapping.
+     */
+    void setCtrl(size_t slot, uint8_t ctrl)
+    {
+        m_ctrl[slot] = ctrl;
+        if (slot < ControlGroup::kWidth) {
+            m_ctrl[kNumSlots + slot] = ctrl;
+        }
+    }
+
+    /**
+     * @brief Probe for a key.
+     *
+     * @param[in]  key
+     *             The key to find.
+     * @param[in]  hash
+     *             The hash of *key*.
+     * @param[out] empty
+     *             If not `nullptr`, set to the first empty slot of the probe run when the key is
+     *             not found.
+     * @return The slot holding *key*, or kNotFound.
+     */
+    size_t findSlot(const Key& key, size_t hash, size_t* empty = nullptr) const
+    {
+        const uint8_t frag = fragment(hash);
+        size_t slot = homeSlot(hash);
+
+        while (true) {
+            const uint8_t* ctrl = &m_ctrl[slot];
+            const typename ControlGroup::Mask empties = ControlGroup::matchEmpty(ctrl);
+            const size_t run_end = (empties != 0) ? ControlGroup::lowest(empties) :
+                                                    ControlGroup::kWidth;
+
+            // Only slots before the first empty slot can belong to this key's run
+            typename ControlGroup::Mask matches =
+                ControlGroup::before(ControlGroup::match(ctrl, frag), run_end);
+            while (matches != 0) {
+                const size_t candidate = (slot + ControlGroup::lowest(matches)) & kSlotMask;
+                if (entry(candidate)->key == key) {
+                    return candidate;
+                }
+                matches = ControlGroup::clearLowest(matches);
+            }
+
+            if (empties != 0) {
+                if (empty != nullptr) {
+                    *empty = (slot + run_end) & kSlotMask;
+                }
+                return kNotFound;
+            }
+
+            slot = (slot + ControlGroup::kWidth) & kSlotMask;
+        }
+    }
+
+    /**
+     * @brief Find the value mapped to a key, or construct a new entry if there is no match.
+     *
+     * Probes once. Nothing is constructed if the key already exists.
+     *
+     * @param[in]  key
+     *             The key to search for.
+     * @param[out] inserted
+     *             Set to `true` if a new entry was constructed, otherwise `false`.
+     * @param[in]  args
+     *             The arguments forwarded to the *Value* constructor if there is no match.
+     * @return A pointer to the mapped value, or `nullptr` if there was no match and the map was
+     *         full.
+     */
+    template <typename ... Args>
+    Value* findOrEmplace(const Key& key, bool& inserted, Args&&... args)
+    {
+        inserted = false;
+
+        const size_t hash = m_hash(key);
+        size_t empty = kNotFound;
+        const size_t slot = findSlot(key, hash, &empty);
+        if (slot != kNotFound) {
+            return &(entry(slot)->value);
+        }
+
+        if (isFull()) {
+            return nullptr;
+        }
+
+        new (entry(empty)) Entry(kInPlaceValue, key, std::forward<Args>(args)...);
+        setCtrl(empty, fragment(hash));
+        m_size++;
+        inserted = true;
+
+        return &(entry(empty)->value);
+    }
+
+    /// The control bytes, followed by a copy of the first group.
+    uint8_t m_ctrl[kNumSlots + ControlGroup::kWidth];
+    /// The entry storage, a slot is constructed only while its control byte is not kEmpty.
+    StorageHelper m_slots[kNumSlots];
+    /// The current number of entries.
+    size_t m_size = 0;
+    /// The hash function.
+    Hash m_hash {};
+};
+
+} // namespace junk
+
+#endif // FIXED_HASH_MAP_H
@@ -0,0 +1,200 @@
+/**
+ * @file   fixed_map.h
+ * @brief  This file contains the definition of the FixedMap container.
+ * @author Liam Bucci <liam.bucci@gmail.com>
+ * @date   2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#ifndef FIXED_MAP_H
+#define FIXED_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "junk/containers/key_pair.h"
+#include "junk/containers/rb_tree.h"
+#include "junk/util/junk_assert.h"
+#include "junk/util/util.h"
+
+namespace junk {
+
+/**
+ * @brief A fixed-capacity ordered map.
+ *
+ * Stores key/value pairs in an RbTree node pool. Every operation performs a single descent of the
+ * tree and values are constructed in place inside the node, only when the key is not already
+ * present.
+ *
+ * Lookups are heterogeneous: any key type which *Compare* can compare against *Key* may be used,
+ * for example a `const char*` against a fixed-size string key.
+ *
+ * @tparam Key
+ *         The key type.
+ * @tparam Value
+ *         The mapped value type.
+ * @tparam N
+ *         The maximum number of entries that may be stored in the map.
+ * @tparam Compare
+ *         The three-way predicate used to compare keys. See RbTree.
+ */
+template <typename Key, typename Value, size_t N, typename Compare = util::ThreeWayCompare>
+class FixedMap : private RbTree<N, KeyPair<Key,Value>, Compare, KeyOfPair>
+{
+    using Base = RbTree<N, KeyPair<Key,Value>, Compare, KeyOfPair>;
+    using Node = typename Base::Node;
+public:
+    using Base::size;
+    using Base::capacity;
+
+    /**
+     * @brief Find the value mapped to the given key.
+     *
+     * @tparam K
+     *         Key type. May be *Key* or any other type that *Compare* can compare against *Key*.
+     * @param[in]  key
+     *             The key to search for.
+     * @return A pointer to the mapped value, or `nullptr` if the key is not in the map.
+     */
+    template <typename K>
+    Value* find(const K& key)
+    {
+        Node* node = this->findNode(key);
+        return (node != nullptr) ? &(node->item.value) : nullptr;
+    }
+
+    /**
+     * @brief Const overload of find().
+     * @overload
+     */
+    template <typename K>
+    const Value* find(const K& key) const
+    {
+        const Node* node = this->findNode(key);
+        return (node != nullptr) ? &(node->item.value) : nullptr;
+    }
+
+    /**
+     * @brief Check if the map contains the given key.
+     *
+     * @param[in]  key
+     *             The key to search for.
+     * @return `true` if the key is in the map, otherwise `false`.
+     */
+    template <typename K>
+    bool contains(const K& key) const
+    {
+        return (this->findNode(key) != nullptr);
+    }
+
+    /**
+     * @brief Construct a value in place if the key is not already present.
+     *
+     * If the key is already in the map nothing is constructed and the existing value is left
+     * unchanged.
+     *
+     * @param[in]  key
+     *             The key to insert.
+     * @param[in]  args
+     *             The arguments forwarded to the *Value* constructor.
+     * @return A boolean:
+     *         - `true`:  A new entry was constructed.
+     *         - `false`: The key was already present, or the map was full.
+     */
+    template <typename ... Args>
+    bool tryEmplace(const Key& key, Args&&... args)
+    {
+        bool inserted = false;
+        this->findOrEmplace(key, inserted, kInPlaceValue, key, std::forward<Args>(args)...);
+        return inserted;
+    }
+
+    /**
+     * @brief Insert a new entry, or assign the value of an existing entry.
+     *
+     * Descends the tree once. A missing key gets a new node from the pool, built from *value* and
+     * rebalanced into the tree. A present key keeps its node and only its value is assigned, so the
+     * tree is not restructured.
+     *
+     * @param[in]  key
+     *             The key to insert or update.
+     * @param[in]  value
+     *             The value to copy or move into the map.
+     * @return A boolean:
+     *         - `true`:  The entry was inserted or assigned.
+     *         - `false`: The key was not present and the map was full.
+     */
+    template <typename V>
+    bool insertOrAssign(const Key& key, V&& value)
+    {
+        bool inserted = false;
+        Node* node = this->findOrEmplace(key, inserted, kInPlaceValue, key, std::forward<V>(value));
+        if (node == nullptr) {
+            return false;
+        }
+
+        // The node was already there, findOrEmplace() did not hand value to a constructor
+        if (!inserted) {
+            node->item.value = std::forward<V>(value);
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Access the value mapped to a key, default constructing it if not present.
+     *
+     * @pre  The key must be present or the map must not be full.
+     *
+     * @param[in]  key
+     *             The key to access.
+     * @return A reference to the mapped value.
+     */
+    Value& operator[](const Key& key)
+    {
+        bool inserted = false;
+        Node* node = this->findOrEmplace(key, inserted, kInPlaceValue, key);
+        JUNK_ASSERT(node != nullptr);
+        return node->item.value;
+    }
+
+    /**
+     * @brief Remove the entry with the given key.
+     *
+     * @param[in]  key
+     *             The key to remove.
+     * @return A boolean:
+     *         - `true`:  The entry was removed.
+     *         - `false`: The key was not in the map.
+     */
+    template <typename K>
+    bool erase(const K& key)
+    {
+        return Base::erase(key);
+    }
+
+    /**
+     * @brief Check if the map is empty.
+     *
+     * @return `true` if the map is empty, otherwise `false`.
+     */
+    bool isEmpty() const
+    {
+        return (size() == 0);
+    }
+
+    /**
+     * @brief Check if the map is full.
+     *
+     * @return `true` if the map is full, otherwise `false`.
+     */
+    bool isFull() const
+    {
+        return (size() >= N);
+    }
+};
+
+} // namespace junk
+
+#endif // FIXED_MAP_H
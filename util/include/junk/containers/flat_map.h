@@ -0,0 +1,227 @@
+/**
+ * @file   flat_map.h
+ * @brief  This file contains the definition of the FlatMap container.
+ * @author Liam Bucci <liam.bucci@gmail.com>
+ * @date   2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#ifndef FLAT_MAP_H
+#define FLAT_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "junk/containers/flat_set.h"
+#include "junk/containers/key_pair.h"
+#include "junk/containers/span.h"
+#include "junk/util/junk_assert.h"
+#include "junk/util/util.h"
+
+namespace junk {
+
+/**
+ * @brief A fixed-capacity ordered map stored as a sorted array.
+ *
+ * Stores key/value pairs in a FlatSet, so lookups are a binary search over contiguous memory and
+ * tables are best filled with insertBatch(). Has the same interface as FixedMap, plus a Span view
+ * of the entries in key order. Values are constructed in place, only when the key is not already
+ * present.
+ *
+ * @tparam Key
+ *         The key type.
+ * @tparam Value
+ *         The mapped value type.
+ * @tparam N
+ *         The maximum number of entries that may be stored in the map.
+ * @tparam Compare
+ *         The three-way predicate used to compare keys. See RbTree.
+ */
+template <typename Key, typename Value, size_t N, typename Compare = util::ThreeWayCompare>
+class FlatMap : private FlatSet<KeyPair<Key,Value>, N, Compare, KeyOfPair>
+{
+    using Base = FlatSet<KeyPair<Key,Value>, N, Compare, KeyOfPair>;
+public:
+    /// The type of an entry.
+    using Entry = KeyPair<Key,Value>;
+
+    using Base::insertBatch;
+    using Base::clear;
+    using Base::size;
+    using Base::capacity;
+    using Base::isEmpty;
+    using Base::isFull;
+
+    /**
+     * @brief Find the value mapped to the given key.
+     *
+     * @tparam K
+     *         Key type. May be *Key* or any other type that *Compare* can compare against *Key*.
+     * @param[in]  key
+     *             The key to search for.
+     * @return A pointer to the mapped value, or `nullptr` if the key is not in the map.
+     */
+    template <typename K>
+    Value* find(const K& key)
+    {
+        const size_t index = this->lowerBound(key);
+        return this->isMatch(index, key) ? &(this->item(index)->value) : nullptr;
+    }
+
+    /**
+     * @brief Const overload of find().
+     * @overload
+     */
+    template <typename K>
+    const Value* find(const K& key) const
+    {
+        const Entry* entry = Base::find(key);
+        return (entry != nullptr) ? &(entry->value) : nullptr;
+    }
+
+    /**
+     * @brief Check if the map contains the given key.
+     *
+     * @param[in]  key
+     *             The key to search for.
+     * @return `true` if the key is in the map, otherwise `false`.
+     */
+    template <typename K>
+    bool contains(const K& key) const
+    {
+        return Base::contains(key);
+    }
+
+    /**
+     * @brief Construct a value in place if the key is not already present.
+     *
+     * If the key is already in the map nothing is constructed and the existing value is left
+     * unchanged.
+     *
+     * @param[in]  key
+     *             The key to insert.
+     * @param[in]  args
+     *             The arguments forwarded to the *Value* constructor.
+     * @return A boolean:
+     *         - `true`:  A new entry was constructed.
+     *         - `false`: The key was already present, or the map was full.
+     */
+    template <typename ... Args>
+    bool tryEmplace(const Key& key, Args&&... args)
+    {
+        bool inserted = false;
+        findOrEmplace(key, inserted, std::forward<Args>(args)...);
+        return inserted;
+    }
+
+    /**
+     * @brief Insert a new entry, or assign the value of an existing entry.
+     *
+     * Binary searches once. A missing key shifts every greater entry up one place to open a gap and
+     * constructs the entry there. A present key has its value assigned where it is, nothing moves.
+     *
+     * @param[in]  key
+     *             The key to insert or update.
+     * @param[in]  value
+     *             The value to copy or move into the map.
+     * @return A boolean:
+     *         - `true`:  The entry was inserted or assigned.
+     *         - `false`: The key was not present and the map was full.
+     */
+    template <typename V>
+    bool insertOrAssign(const Key& key, V&& value)
+    {
+        bool inserted = false;
+        Value* mapped = findOrEmplace(key, inserted, std::forward<V>(value));
+        if (mapped == nullptr) {
+            return false;
+        }
+
+        // No gap was opened, so value was never moved from and can be assigned now
+        if (!inserted) {
+            *mapped = std::forward<V>(value);
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Access the value mapped to a key, default constructing it if not present.
+     *
+     * @pre  The key must be present or the map must not be full.
+     *
+     * @param[in]  key
+     *             The key to access.
+     * @return A reference to the mapped value.
+     */
+    Value& operator[](const Key& key)
+    {
+        bool inserted = false;
+        Value* mapped = findOrEmplace(key, inserted);
+        JUNK_ASSERT(mapped != nullptr);
+        return *mapped;
+    }
+
+    /**
+     * @brief Remove the entry with the given key.
+     *
+     * @param[in]  key
+     *             The key to remove.
+     * @return A boolean:
+     *         - `true`:  The entry was removed.
+     *         - `false`: The key was not in the map.
+     */
+    template <typename K>
+    bool erase(const K& key)
+    {
+        return Base::erase(key);
+    }
+
+    /**
+     * @brief Get a read-only view of the entries, in key order.
+     *
+     * The view refers to the map's own storage and is invalidated by any insert or erase.
+     *
+     * @return A Span over the entries.
+     */
+    Span<const Entry> entries() const
+    {
+        return Base::view();
+    }
+
+private:
+    /**
+     * @brief Find the value mapped to a key, or construct a new entry if there is no match.
+     *
+     * @param[in]  key
+     *             The key to search for.
+     * @param[out] inserted
+     *             Set to `true` if a new entry was constructed, otherwise `false`.
+     * @param[in]  args
+     *             The arguments forwarded to the *Value* constructor if there is no match.
+     * @return A pointer to the mapped value, or `nullptr` if there was no match and the map was
+     *         full.
+     */
+    template <typename ... Args>
+    Value* findOrEmplace(const Key& key, bool& inserted, Args&&... args)
+    {
+        inserted = false;
+
+        const size_t index = this->lowerBound(key);
+        if (this->isMatch(index, key)) {
+            return &(this->item(index)->value);
+        }
+
+        if (isFull()) {
+            return nullptr;
+        }
+
+        inserted = true;
+        return &(this->emplaceAt(index, kInPlaceValue, key, std::forward<Args>(args)...)->value);
+    }
+};
+
+} // namespace junk
+
+#endif // FLAT_MAP_H
@@ -0,0 +1,565 @@
+/**
+ * @file   flat_set.h
+ * @brief  This file contains the definition of the FlatSet container.
+ * @author Liam Bucci <liam.bucci@gmail.com>
+ * @date   2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#ifndef FLAT_SET_H
+#define FLAT_SET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#include "junk/algorithms/binary_search.h"
+#include "junk/containers/span.h"
+#include "junk/util/junk_assert.h"
+#include "junk/util/util.h"
+
+namespace junk {
+
+/**
+ * @brief A fixed-capacity ordered set stored as a sorted array.
+ *
+ * Items are kept sorted in a single inline array, so a lookup is a binary search over contiguous
+ * memory and iterating is a walk over a Span. This suits read-mostly tables far better than a
+ * node based tree, at the cost of O(n) single inserts and erases.
+ *
+ * Tables are best filled with insertBatch(), which appends a whole batch, sorts it and merges it
+ * into the existing items once. Both the sort and the merge work in place without a heap.
+ *
+ * @tparam T
+ *         The type of the items. Must be movable.
+ * @tparam N
+ *         The maximum number of items that may be stored in the set.
+ * @tparam Compare
+ *         The three-way predicate used to compare keys, called as `compare(key, KeyOf()(item))`.
+ *         See RbTree.
+ * @tparam KeyOf
+ *         The functor which extracts the key of an item. See RbTree.
+ */
+template <typename T, size_t N, typename Compare = util::ThreeWayCompare,
+          typename KeyOf = util::Identity>
+class FlatSet
+{
+public:
+    /// Default constructor.
+    FlatSet() = default;
+
+    /**
+     * @brief Constructor which sets the comparison predicate.
+     *
+     * @param[in]  compare
+     *             The predicate used to order items.
+     */
+    explicit FlatSet(const Compare& compare) : m_compare(compare) {}
+
+    /**
+     * @brief Destructor. Destructs all remaining items.
+     */
+    ~FlatSet()
+    {
+        clear();
+    }
+
+    FlatSet(const FlatSet&) = delete;
+    FlatSet& operator=(const FlatSet&) = delete;
+
+    /**
+     * @brief Find the item with the given key.
+     *
+     * @tparam K
+     *         Key type. May be the key type of *T* or any other type Comparable to it using
+     *         *Compare*.
+     * @param[in]  key
+     *             The key to search for.
+     * @return A pointer to the matching item, or `nullptr` if there is no match.
+     */
+    template <typename K>
+    const T* find(const K& key) const
+    {
+        const size_t index = lowerBound(key);
+        return isMatch(index, key) ? item(index) : nullptr;
+    }
+
+    /**
+     * @brief Check if the set contains the given key.
+     *
+     * @param[in]  key
+     *             The key to search for.
+     * @return `true` if the key is in the set, otherwise `false`.
+     */
+    template <typename K>
+    bool contains(const K& key) const
+    {
+        return isMatch(lowerBound(key), key);
+    }
+
+    /**
+     * @brief Insert a copy of an item.
+     *
+     * @param[in]  new_item
+     *             The item to insert.
+     * @return A boolean:
+     *         - `true`:  The item was inserted.
+     *         - `false`: An item with the same key was already present, or the set was full.
+     */
+    bool insert(const T& new_item)
+    {
+        return insertItem(new_item);
+    }
+
+    /**
+     * @brief Insert an item by moving it.
+     * @overload
+     */
+    bool insert(T&& new_item)
+    {
+        return insertItem(std::move(new_item));
+    }
+
+    /**
+     * @brief Insert a batch of items at once.
+     *
+     * The batch is appended after the existing items, sorted, and merged into them in a single
+     * pass, which is far cheaper than inserting the items one at a time. Items whose key is already
+     * present are dropped. If the batch holds several items with the same key only one of them is
+     * kept.
+     *
+     * @param[in]  items
+     *             The items to insert.
+     * @param[in]  count
+     *             The number of items in *items*.
+     * @return A boolean:
+     *         - `true`:  The batch was inserted.
+     *         - `false`: The set does not have room for *count* more items, nothing was inserted.
+     */
+    bool insertBatch(const T* items, size_t count)
+    {
+        if (count > (N - m_size)) {
+            return false;
+        }
+        if (count == 0) {
+            return true;
+        }
+        JUNK_ASSERT(items != nullptr);
+
+        const size_t middle = m_size;
+        if ((N - middle - count) >= count) {
+            // Stage the batch at the end of the storage, clear of everything the merge writes
+            const size_t batch = N - count;
+            for (size_t i = 0; i < count; i++) {
+                new (item(batch + i)) T(items[i]);
+            }
+            heapSort(batch, N);
+
+            const size_t first = mergeBackward(middle, batch, count);
+            for (size_t i = batch; i < N; i++) {
+                item(i)->~T();
+            }
+            m_size += count;
+            removeDuplicates((first > 0) ? (first - 1U) : 0);
+        } else {
+            for (size_t i = 0; i < count; i++) {
+                new (item(middle + i)) T(items[i]);
+            }
+            m_size += count;
+            heapSort(middle, m_size);
+
+            // Appending keys past the current maximum needs no merge
+            if ((middle > 0) && (compareItems(middle, middle - 1U) <= 0)) {
+                merge(0, middle, m_size);
+                removeDuplicates(0);
+            } else {
+                removeDuplicates((middle > 0) ? (middle - 1U) : 0);
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Insert a batch of items at once.
+     * @overload
+     */
+    template <size_t M>
+    bool insertBatch(const T (&items)[M])
+    {
+        return insertBatch(&items[0], M);
+    }
+
+    /**
+     * @brief Remove the item with the given key.
+     *
+     * @param[in]  key
+     *             The key of the item to remove.
+     * @return A boolean:
+     *         - `true`:  The item was removed.
+     *         - `false`: The key was not in the set.
+     */
+    template <typename K>
+    bool erase(const K& key)
+    {
+        const size_t index = lowerBound(key);
+        if (!isMatch(index, key)) {
+            return false;
+        }
+
+        for (size_t i = index + 1U; i < m_size; i++) {
+            *item(i - 1U) = std::move(*item(i));
+        }
+        m_size--;
+        item(m_size)->~T();
+
+        return true;
+    }
+
+    /**
+     * @brief Remove all items.
+     */
+    void clear()
+    {
+        for (size_t i = 0; i < m_size; i++) {
+            item(i)->~T();
+        }
+        m_size = 0;
+    }
+
+    /**
+     * @brief Get a read-only view of the items, in order.
+     *
+     * The view refers to the set's own storage and is invalidated by any insert or erase.
+     *
+     * @return A Span over the items.
+     */
+    Span<const T> view() const
+    {
+        return Span<const T>(item(0), m_size);
+    }
+
+    /**
+     * @brief Get the current number of items in the set.
+     *
+     * @return The current number of items in the set.
+     */
+    size_t size() const
+    {
+        return m_size;
+    }
+
+    /**
+     * @brief Get the maximum number of items that can be stored in the set.
+     *
+     * @return The maximum number of items that can be stored in the set.
+     */
+    size_t capacity() const
+    {
+        return N;
+    }
+
+    /**
+     * @brief Check if the set is empty.
+     *
+     * @return `true` if the set is empty, otherwise `false`.
+     */
+    bool isEmpty() const
+    {
+        return (m_size == 0);
+    }
+
+    /**
+     * @brief Check if the set is full.
+     *
+     * @return `true` if the set is full, otherwise `false`.
+     */
+    bool isFull() const
+    {
+        return (m_size >= N);
+    }
+
+protected:
+    /**
+     * @brief A storage container which simulates a *T*.
+     */
+    struct alignas(T) StorageHelper {
+        uint8_t mem[sizeof(T)];
+    };
+
+    T* item(size_t index)
+    {
+        return reinterpret_cast<T*>(&m_storage[index]);
+    }
+
+    const T* item(size_t index) const
+    {
+        return reinterpret_cast<const T*>(&m_storage[index]);
+    }
+
+    /**
+     * @brief Find the index of the first item whose key is not less than the given key.
+     */
+    template <typename K>
+    size_t lowerBound(const K& key) const
+    {
+        const Compare& compare = m_compare;
+        return algorithms::lowerBound(item(0), m_size, key, [&compare](const K& k, const T& i) {
+            return compare(k, KeyOf()(i));
+        });
+    }
+
+    /**
+     * @brief Check if the item at an index, as returned by lowerBound(), matches a key.
+     */
+    template <typename K>
+    bool isMatch(size_t index, const K& key) const
+    {
+        return (index < m_size) && (m_compare(key, KeyOf()(*item(index))) == 0);
+    }
+
+    /**
+     * @brief Compare the keys of two items.
+     */
+    int compareItems(size_t a, size_t b) const
+    {
+        return m_compare(KeyOf()(*item(a)), KeyOf()(*item(b)));
+    }
+
+    void swapItems(size_t a, size_t b)
+    {
+        using std::swap;
+        swap(*item(a), *item(b));
+    }
+
+    /**
+     * @brief Insert an item if its key is not already present.
+     */
+    template <typename U>
+    bool insertItem(U&& new_item)
+    {
+        const size_t index = lowerBound(KeyOf()(new_item));
+        if (isMatch(index, KeyOf()(new_item)) || isFull()) {
+            return false;
+        }
+
+        emplaceAt(index, std::forward<U>(new_item));
+        return true;
+    }
+
+    /**
+     * @brief Construct a new item at an index, shifting the following items up by one.
+     *
+     * @pre  The set must not be full and *index* must keep the items sorted.
+     *
+     * @param[in]  index
+     *             The index of the new item.
+     * @param[in]  args
+     *             The arguments forwarded to the *T* constructor.
+     * @return A pointer to the new item.
+     */
+    template <typename ... Args>
+    T* emplaceAt(size_t index, Args&&... args)
+    {
+        JUNK_ASSERT(!isFull());
+
+        if (index < m_size) {
+            new (item(m_size)) T(std::move(*item(m_size - 1U)));
+            for (size_t i = m_size - 1U; i > index; i--) {
+                *item(i) = std::move(*item(i - 1U));
+            }
+            item(index)->~T();
+        }
+        new (item(index)) T(std::forward<Args>(args)...);
+        m_size++;
+
+        return item(index);
+    }
+
+    /**
+     * @brief Sort the items in [first, last) in place with heapsort.
+     */
+    void heapSort(size_t first, size_t last)
+    {
+        const size_t length = last - first;
+        for (size_t i = length / 2U; i > 0; i--) {
+            siftDown(first, i - 1U, length);
+        }
+        for (size_t end = length - 1U; end > 0; end--) {
+            swapItems(first, first + end);
+            siftDown(first, 0, end);
+        }
+    }
+
+    /**
+     * @brief Restore the max-heap rooted at *root* within the heap of *length* items at *first*.
+     */
+    void siftDown(size_t first, size_t root, size_t length)
+    {
+        while (true) {
+            size_t largest = root;
+            const size_t left = (2U * root) + 1U;
+            const size_t right = left + 1U;
+            if ((left < length) && (compareItems(first + left, first + largest) > 0)) {
+                largest = left;
+            }
+            if ((right < length) && (compareItems(first + right, first + largest) > 0)) {
+                largest = right;
+            }
+            if (largest == root) {
+                return;
+            }
+            swapItems(first + root, first + largest);
+            root = largest;
+        }
+    }
+
+    /**
+     * @brief Reverse the items in [first, last).
+     */
+    void reverse(size_t first, size_t last)
+    {
+        while ((first < last) && (first < --last)) {
+            swapItems(first++, last);
+        }
+    }
+
+    /**
+     * @brief Rotate [first, last) so the item at *middle* becomes the first.
+     */
+    void rotate(size_t first, size_t middle, size_t last)
+    {
+        reverse(first, middle);
+        reverse(middle, last);
+        reverse(first, last);
+    }
+
+    /**
+     * @brief Merge the sorted ranges [first, middle) and [middle, last) in place.
+     *
+     * Splits the longer range in half, finds the matching split point in the other range, and
+     * rotates the two inner parts past each other before merging each side. Needs no buffer and
+     * recurses O(log n) deep. Items of the left range stay before equal items of the right range.
+     */
+    void merge(size_t first, size_t middle, size_t last)
+    {
+        const size_t left_length = middle - first;
+        const size_t right_length = last - middle;
+        if ((left_length == 0) || (right_length == 0)) {
+            return;
+        }
+        if ((left_length + right_length) == 2U) {
+            if (compareItems(middle, first) < 0) {
+                swapItems(first, middle);
+            }
+            return;
+        }
+
+        size_t left_cut;
+        size_t right_cut;
+        if (left_length > right_length) {
+            left_cut = first + (left_length / 2U);
+            right_cut = searchRange(middle, last, left_cut, false);
+        } else {
+            right_cut = middle + (right_length / 2U);
+            left_cut = searchRange(first, middle, right_cut, true);
+        }
+
+        rotate(left_cut, middle, right_cut);
+        const size_t new_middle = left_cut + (right_cut - middle);
+        merge(first, left_cut, new_middle);
+        merge(new_middle, right_cut, last);
+    }
+
+    /**
+     * @brief Merge a sorted batch into the items, from the largest item down.
+     *
+     * Each item is moved at most once. Items of the batch are moved into [0, length + count),
+     * which must not overlap the batch.
+     *
+     * @param[in]  length
+     *             The number of items before the merge.
+     * @param[in]  batch
+     *             The index of the first item of the sorted batch.
+     * @param[in]  count
+     *             The number of items in the batch.
+     * @return The lowest index written, items below it were already in place.
+     */
+    size_t mergeBackward(size_t length, size_t batch, size_t count)
+    {
+        size_t existing = length;
+        size_t remaining = count;
+        size_t write = length + count;
+
+        while (remaining > 0) {
+            write--;
+            // Equal keys keep the existing item first
+            const bool take_existing =
+                (existing > 0) && (compareItems(existing - 1U, batch + remaining - 1U) > 0);
+            T* source = take_existing ? item(--existing) : item(batch + --remaining);
+            if (write < length) {
+                *item(write) = std::move(*source);
+            } else {
+                new (item(write)) T(std::move(*source));
+            }
+        }
+
+        return write;
+    }
+
+    /**
+     * @brief Binary search [first, last) for the first item not less than (or, if *upper*, greater
+     *        than) the item at *pivot*.
+     */
+    size_t searchRange(size_t first, size_t last, size_t pivot, bool upper) const
+    {
+        while (first < last) {
+            const size_t index = first + ((last - first) / 2U);
+            const int result = compareItems(index, pivot);
+            if ((result < 0) || (upper && (result == 0))) {
+                first = index + 1U;
+            } else {
+                last = index;
+            }
+        }
+
+        return first;
+    }
+
+    /**
+     * @brief Remove all but the first item of every run of equal keys, starting at *from*.
+     */
+    void removeDuplicates(size_t from)
+    {
+        if (m_size == 0) {
+            return;
+        }
+
+        size_t kept = from;
+        for (size_t i = from + 1U; i < m_size; i++) {
+            if (compareItems(i, kept) != 0) {
+                kept++;
+                if (kept != i) {
+                    *item(kept) = std::move(*item(i));
+                }
+            }
+        }
+
+        for (size_t i = kept + 1U; i < m_size; i++) {
+            item(i)->~T();
+        }
+        m_size = kept + 1U;
+    }
+
+    /// The item storage, only the first m_size items are constructed.
+    StorageHelper m_storage[N];
+    /// The current number of items.
+    size_t m_size = 0;
+    /// The predicate used to order items.
+    Compare m_compare {};
+};
+
+} // namespace junk
+
+#endif // FLAT_SET_H
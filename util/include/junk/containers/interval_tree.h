@@ -0,0 +1,238 @@
+/**
+ * @file   interval_tree.h
+ * @brief  This file contains the definition of the IntervalTree container.
+ * @author Liam Bucci <liam.bucci@gmail.com>
+ * @date   2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#ifndef INTERVAL_TREE_H
+#define INTERVAL_TREE_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "junk/containers/rb_tree.h"
+
+namespace junk {
+
+/**
+ * @brief A closed interval `[low, high]` with an associated value.
+ *
+ * @tparam Bound
+ *         The type of the interval endpoints. Must be LessThanComparable.
+ * @tparam Value
+ *         The type of the value associated with the interval.
+ */
+template <typename Bound, typename Value>
+struct Interval {
+    constexpr Interval() = default;
+    constexpr Interval(const Bound& l, const Bound& h, const Value& v) : low(l), high(h), value(v) {};
+
+    Bound low;
+    Bound high;
+    Value value;
+};
+
+/**
+ * @brief Three-way predicate which orders intervals by low endpoint, then by high endpoint.
+ */
+struct IntervalCompare
+{
+    template <typename Bound, typename Value>
+    int operator()(const Interval<Bound,Value>& a, const Interval<Bound,Value>& b) const
+    {
+        if (a.low < b.low) {
+            return -1;
+        } else if (b.low < a.low) {
+            return 1;
+        } else if (a.high < b.high) {
+            return -1;
+        } else if (b.high < a.high) {
+            return 1;
+        } else {
+            return 0;
+        }
+    }
+};
+
+/**
+ * @brief RbTree augmentation which stores the largest high endpoint in each subtree.
+ *
+ * @tparam Bound
+ *         The type of the interval endpoints.
+ */
+template <typename Bound>
+struct MaxEndpoint
+{
+    /// This augmentation must be maintained.
+    static constexpr bool kEnabled = true;
+
+    /// @copydoc NoAugmentation::update()
+    template <typename Item>
+    void update(const Item& item, const MaxEndpoint* left, const MaxEndpoint* right)
+    {
+        max_high = item.high;
+        if ((left != nullptr) && (max_high < left->max_high)) {
+            max_high = left->max_high;
+        }
+        if ((right != nullptr) && (max_high < right->max_high)) {
+            max_high = right->max_high;
+        }
+    }
+
+    /// The largest high endpoint of any interval in the subtree rooted at this node.
+    Bound max_high {};
+};
+
+/**
+ * @brief A Red-Black Tree of intervals which answers overlap queries.
+ *
+ * Intervals are ordered by their low endpoint and every node stores the largest high endpoint of
+ * its subtree (see MaxEndpoint). Whole subtrees which end before a query, or start after it, are
+ * skipped. Finding any one overlapping interval takes O(log n), and reporting all *k* overlapping
+ * intervals visits at most O(min(n, k log n)) nodes.
+ *
+ * Storage is the same fixed-capacity node pool used by RbTree.
+ *
+ * @tparam NumNodes
+ *         Maximum number of intervals that may be stored in the tree.
+ * @tparam Bound
+ *         The type of the interval endpoints. Must be LessThanComparable.
+ * @tparam Value
+ *         The type of the value associated with each interval.
+ */
+template <size_t NumNodes, typename Bound, typename Value>
+class IntervalTree : public RbTree<NumNodes, Interval<Bound,Value>, IntervalCompare, util::Identity, MaxEndpoint<Bound>>
+{
+protected:
+    using Base = RbTree<NumNodes, Interval<Bound,Value>, IntervalCompare, util::Identity, MaxEndpoint<Bound>>;
+    using Node = typename Base::Node;
+
+public:
+    /// The item type stored in the tree.
+    using Item = Interval<Bound,Value>;
+
+    using Base::Base;
+
+    /**
+     * @brief Find any one interval which overlaps the given range.
+     *
+     * @param[in]  low
+     *             The lower bound of the range, inclusive.
+     * @param[in]  high
+     *             The upper bound of the range, inclusive.
+     * @return A pointer to an overlapping interval, or `nullptr` if no interval overlaps.
+     */
+    const Item* findOverlap(const Bound& low, const Bound& high) const
+    {
+        const Node* current = this->m_root;
+        while (current != nullptr) {
+            if (overlaps(current->item, low, high)) {
+                return &(current->item);
+            }
+
+            // If anything on the left ends at or after low it either overlaps, or everything on
+            // the right starts after high.
+            if ((current->left != nullptr) && !(current->left->max_high < low)) {
+                current = current->left;
+            } else {
+                current = current->right;
+            }
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * @brief Call a function for every interval which overlaps the given range.
+     *
+     * @param[in]  low
+     *             The lower bound of the range, inclusive.
+     * @param[in]  high
+     *             The upper bound of the range, inclusive.
+     * @param[in]  fn
+     *             The function to call. Must have a signature similar to
+     *             `void fn(const Interval<Bound,Value>& interval)`.
+     * @return The number of overlapping intervals found.
+     */
+    template <typename F>
+    size_t forEachOverlap(const Bound& low, const Bound& high, F fn) const
+    {
+        return visitOverlaps(this->m_root, low, high, fn);
+    }
+
+    /**
+     * @brief Call a function for every interval which contains the given point (a stabbing query).
+     *
+     * @param[in]  point
+     *             The point to find.
+     * @param[in]  fn
+     *             The function to call. See forEachOverlap().
+     * @return The number of intervals containing the point.
+     */
+    template <typename F>
+    size_t forEachContaining(const Bound& point, F fn) const
+    {
+        return visitOverlaps(this->m_root, point, point, fn);
+    }
+
+private:
+    /**
+     * @brief Check if an interval overlaps the given range.
+     *
+     * @param[in]  item
+     *             The interval to check.
+     * @param[in]  low
+     *             The lower bound of the range, inclusive.
+     * @param[in]  high
+     *             The upper bound of the range, inclusive.
+     * @return `true` if the interval and the range share at least one point.
+     */
+    static bool overlaps(const Item& item, const Bound& low, const Bound& high)
+    {
+        return !(high < item.low) && !(item.high < low);
+    }
+
+    /**
+     * @brief Recursively report the overlapping intervals in a subtree.
+     *
+     * Recursion depth is bounded by the height of the tree, at most `2 * log2(NumNodes + 1)`.
+     *
+     * @param[in]  node
+     *             The root of the subtree. May be `nullptr`.
+     * @param[in]  low
+     *             The lower bound of the range, inclusive.
+     * @param[in]  high
+     *             The upper bound of the range, inclusive.
+     * @param[in]  fn
+     *             The function to call for every overlapping interval.
+     * @return The number of overlapping intervals found in the subtree.
+     */
+    template <typename F>
+    static size_t visitOverlaps(const Node* node, const Bound& low, const Bound& high, F& fn)
+    {
+        // Everything in this subtree ends before the range starts
+        if ((node == nullptr) || (node->max_high < low)) {
+            return 0;
+        }
+
+        size_t found = visitOverlaps(node->left, low, high, fn);
+
+        // This node and everything to its right starts after the range ends
+        if (high < node->item.low) {
+            return found;
+        }
+
+        if (!(node->item.high < low)) {
+            fn(node->item);
+            found++;
+        }
+
+        return found + visitOverlaps(node->right, low, high, fn);
+    }
+};
+
+} // namespace junk
+
+#endif // INTERVAL_TREE_H
@@ -9,18 +9,51 @@
 #ifndef KEY_PAIR_H
 #define KEY_PAIR_H
 
+#include <utility>
 
 namespace junk {
 
+/**
+ * @brief Tag which selects the KeyPair constructor that builds the value in place.
+ */
+struct InPlaceValue {};
+
+/// An instance of the InPlaceValue tag.
+constexpr InPlaceValue kInPlaceValue {};
+
 template <typename Key, typename Value>
 struct KeyPair {
     constexpr KeyPair() = default;
     constexpr KeyPair(const Key& k, const Value& v) : key(k), value(v) {};
 
+    /**
+     * @brief Constructor which constructs the value in place.
+     *
+     * @param[in]  k
+     *             The key to store.
+     * @param[in]  args
+     *             The arguments forwarded to the *Value* constructor.
+     */
+    template <typename K, typename ... Args>
+    constexpr KeyPair(InPlaceValue, K&& k, Args&&... args) :
+        key(std::forward<K>(k)), value(std::forward<Args>(args)...) {};
+
     Key key;
     Value value;
 };
 
+/**
+ * @brief Key extractor which returns the key of a KeyPair, for use as the RbTree `KeyOf`.
+ */
+struct KeyOfPair
+{
+    template <typename Key, typename Value>
+    constexpr const Key& operator()(const KeyPair<Key,Value>& p) const
+    {
+        return p.key;
+    }
+};
+
 template <typename Key, typename Value>
 constexpr bool operator ==(const KeyPair<Key,Value>& p1, const KeyPair<Key,Value>& p2)
 {
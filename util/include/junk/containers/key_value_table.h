@@ -0,0 +1,455 @@
+/**
+ * @file   key_value_table.h
+ * @brief  This file contains the definition of the KeyValueTable container.
+ * @author Liam Bucci <liam.bucci@gmail.com>
+ * @date   2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#ifndef KEY_VALUE_TABLE_H
+#define KEY_VALUE_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#include "junk/algorithms/binary_search.h"
+#include "junk/containers/span.h"
+#include "junk/util/junk_assert.h"
+#include "junk/util/util.h"
+
+namespace junk {
+
+/**
+ * @brief A fixed-capacity ordered map which stores its keys and values in separate arrays.
+ *
+ * Keys are kept sorted in one contiguous array and values in a second, parallel array, so the
+ * value of the key at index `i` is at index `i`. A lookup binary searches the key array alone and
+ * touches the value array once, at the end. An array of KeyPair (such as FlatMap) pulls every
+ * probed entry's value into the cache alongside its key, which costs far more cache lines once the
+ * values are large.
+ *
+ * @tparam Key
+ *         The key type.
+ * @tparam Value
+ *         The mapped value type.
+ * @tparam N
+ *         The maximum number of entries that may be stored in the table.
+ * @tparam Compare
+ *         The three-way predicate used to compare keys. See RbTree.
+ */
+template <typename Key, typename Value, size_t N, typename Compare = util::ThreeWayCompare>
+class KeyValueTable
+{
+public:
+    /// Returned by indexOf() when the key is not in the table.
+    static constexpr size_t kNotFound = ~static_cast<size_t>(0);
+
+    /// Default constructor.
+    KeyValueTable() = default;
+
+    /**
+     * @brief Constructor which sets the comparison predicate.
+     *
+     * @param[in]  compare
+     *             The predicate used to order keys.
+     */
+    explicit KeyValueTable(const Compare& compare) : m_compare(compare) {}
+
+    /**
+     * @brief Destructor. Destructs all remaining entries.
+     */
+    ~KeyValueTable()
+    {
+        clear();
+    }
+
+    KeyValueTable(const KeyValueTable&) = delete;
+    KeyValueTable& operator=(const KeyValueTable&) = delete;
+
+    /**
+     * @brief Find the index of the given key.
+     *
+     * @tparam K
+     *         Key type. May be *Key* or any other type that *Compare* can compare against *Key*.
+     * @param[in]  key
+     *             The key to search for.
+     * @return The index of the key, valid until the next insert or erase, or kNotFound.
+     */
+    template <typename K>
+    size_t indexOf(const K& key) const
+    {
+        const size_t index = lowerBound(key);
+        return isMatch(index, key) ? index : kNotFound;
+    }
+
+    /**
+     * @brief Find the value mapped to the given key.
+     *
+     * @param[in]  key
+     *             The key to search for.
+     * @return A pointer to the mapped value, or `nullptr` if the key is not in the table.
+     */
+    template <typename K>
+    Value* find(const K& key)
+    {
+        const size_t index = indexOf(key);
+        return (index != kNotFound) ? value(index) : nullptr;
+    }
+
+    /**
+     * @brief Const overload of find().
+     * @overload
+     */
+    template <typename K>
+    const Value* find(const K& key) const
+    {
+        const size_t index = indexOf(key);
+        return (index != kNotFound) ? value(index) : nullptr;
+    }
+
+    /**
+     * @brief Check if the table contains the given key.
+     *
+     * Only the key array is read.
+     *
+     * @param[in]  key
+     *             The key to search for.
+     * @return `true` if the key is in the table, otherwise `false`.
+     */
+    template <typename K>
+    bool contains(const K& key) const
+    {
+        return (indexOf(key) != kNotFound);
+    }
+
+    /**
+     * @brief Get the key at an index.
+     *
+     * @pre  *index* must be less than size().
+     *
+     * @param[in]  index
+     *             The index of the entry.
+     * @return The key of the entry.
+     */
+    const Key& keyAt(size_t index) const
+    {
+        JUNK_ASSERT(index < m_size);
+        return *key(index);
+    }
+
+    /**
+     * @brief Get the value at an index.
+     *
+     * @pre  *index* must be less than size().
+     *
+     * @param[in]  index
+     *             The index of the entry.
+     * @return The value of the entry.
+     */
+    Value& valueAt(size_t index)
+    {
+        JUNK_ASSERT(index < m_size);
+        return *value(index);
+    }
+
+    /**
+     * @brief Const overload of valueAt().
+     * @overload
+     */
+    const Value& valueAt(size_t index) const
+    {
+        JUNK_ASSERT(index < m_size);
+        return *value(index);
+    }
+
+    /**
+     * @brief Construct a value in place if the key is not already present.
+     *
+     * @param[in]  new_key
+     *             The key to insert.
+     * @param[in]  args
+     *             The arguments forwarded to the *Value* constructor.
+     * @return A boolean:
+     *         - `true`:  A new entry was constructed.
+     *         - `false`: The key was already present, or the table was full.
+     */
+    template <typename ... Args>
+    bool tryEmplace(const Key& new_key, Args&&... args)
+    {
+        bool inserted = false;
+        findOrEmplace(new_key, inserted, std::forward<Args>(args)...);
+        return inserted;
+    }
+
+    /**
+     * @brief Insert a new entry, or assign the value of an existing entry.
+     *
+     * Binary searches the keys once. A missing key moves every greater key and value up one place
+     * in their arrays and constructs both in the gap. A present key has only its value assigned,
+     * the key array is not touched.
+     *
+     * @param[in]  new_key
+     *             The key to insert or update.
+     * @param[in]  new_value
+     *             The value to copy or move into the table.
+     * @return A boolean:
+     *         - `true`:  The entry was inserted or assigned.
+     *         - `false`: The key was not present and the table was full.
+     */
+    template <typename V>
+    bool insertOrAssign(const Key& new_key, V&& new_value)
+    {
+        bool inserted = false;
+        Value* mapped = findOrEmplace(new_key, inserted, std::forward<V>(new_value));
+        if (mapped == nullptr) {
+            return false;
+        }
+
+        // The key matched, so new_value was not consumed by the Value constructor
+        if (!inserted) {
+            *mapped = std::forward<V>(new_value);
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Access the value mapped to a key, default constructing it if not present.
+     *
+     * @pre  The key must be present or the table must not be full.
+     *
+     * @param[in]  new_key
+     *             The key to access.
+     * @return A reference to the mapped value.
+     */
+    Value& operator[](const Key& new_key)
+    {
+        bool inserted = false;
+        Value* mapped = findOrEmplace(new_key, inserted);
+        JUNK_ASSERT(mapped != nullptr);
+        return *mapped;
+    }
+
+    /**
+     * @brief Remove the entry with the given key.
+     *
+     * @param[in]  old_key
+     *             The key to remove.
+     * @return A boolean:
+     *         - `true`:  The entry was removed.
+     *         - `false`: The key was not in the table.
+     */
+    template <typename K>
+    bool erase(const K& old_key)
+    {
+        const size_t index = indexOf(old_key);
+        if (index == kNotFound) {
+            return false;
+        }
+
+        for (size_t i = index + 1U; i < m_size; i++) {
+            *key(i - 1U) = std::move(*key(i));
+            *value(i - 1U) = std::move(*value(i));
+        }
+        m_size--;
+        key(m_size)->~Key();
+        value(m_size)->~Value();
+
+        return true;
+    }
+
+    /**
+     * @brief Remove all entries.
+     */
+    void clear()
+    {
+        for (size_t i = 0; i < m_size; i++) {
+            key(i)->~Key();
+            value(i)->~Value();
+        }
+        m_size = 0;
+    }
+
+    /**
+     * @brief Get a read-only view of the keys, in order.
+     *
+     * The view is invalidated by any insert or erase.
+     *
+     * @return A Span over the keys.
+     */
+    Span<const Key> keys() const
+    {
+        return Span<const Key>(key(0), m_size);
+    }
+
+    /**
+     * @brief Get a view of the values, in the order of their keys.
+     *
+     * The view is invalidated by any insert or erase.
+     *
+     * @return A Span over the values.
+     */
+    Span<Value> values()
+    {
+        return Span<Value>(value(0), m_size);
+    }
+
+    /**
+     * @brief Const overload of values().
+     * @overload
+     */
+    Span<const Value> values() const
+    {
+        return Span<const Value>(value(0), m_size);
+    }
+
+    /**
+     * @brief Get the current number of entries in the table.
+     *
+     * @return The current number of entries in the table.
+     */
+    size_t size() const
+    {
+        return m_size;
+    }
+
+    /**
+     * @brief Get the maximum number of entries that can be stored in the table.
+     *
+     * @return The maximum number of entries that can be stored in the table.
+     */
+    size_t capacity() const
+    {
+        return N;
+    }
+
+    /**
+     * @brief Check if the table is empty.
+     *
+     * @return `true` if the table is empty, otherwise `false`.
+     */
+    bool isEmpty() const
+    {
+        return (m_size == 0);
+    }
+
+    /**
+     * @brief Check if the table is full.
+     *
+     * @return `true` if the table is full, otherwise `false`.
+     */
+    bool isFull() const
+    {
+        return (m_size >= N);
+    }
+
+private:
+    /**
+     * @brief A storage container which simulates a *U*.
+     */
+    template <typename U>
+    struct alignas(U) StorageHelper {
+        uint8_t mem[sizeof(U)];
+    };
+
+    Key* key(size_t index)
+    {
+        return reinterpret_cast<Key*>(&m_keys[index]);
+    }
+
+    const Key* key(size_t index) const
+    {
+        return reinterpret_cast<const Key*>(&m_keys[index]);
+    }
+
+    Value* value(size_t index)
+    {
+        return reinterpret_cast<Value*>(&m_values[index]);
+    }
+
+    const Value* value(size_t index) const
+    {
+        return reinterpret_cast<const Value*>(&m_values[index]);
+    }
+
+    /**
+     * @brief Find the index of the first key which is not less than the given key.
+     */
+    template <typename K>
+    size_t lowerBound(const K& k) const
+    {
+        return algorithms::lowerBound(key(0), m_size, k, m_compare);
+    }
+
+    /**
+     * @brief Check if the key at an index, as returned by lowerBound(), matches a key.
+     */
+    template <typename K>
+    bool isMatch(size_t index, const K& k) const
+    {
+        return (index < m_size) && (m_compare(k, *key(index)) == 0);
+    }
+
+    /**
+     * @brief Find the value mapped to a key, or construct a new entry if there is no match.
+     *
+     * @param[in]  new_key
+     *             The key to search for.
+     * @param[out] inserted
+     *             Set to `true` if a new entry was constructed, otherwise `false`.
+     * @param[in]  args
+     *             The arguments forwarded to the *Value* constructor if there is no match.
+     * @return A pointer to the mapped value, or `nullptr` if there was no match and the table was
+     *         full.
+     */
+    template <typename ... Args>
+    Value* findOrEmplace(const Key& new_key, bool& inserted, Args&&... args)
+    {
+        inserted = false;
+
+        const size_t index = lowerBound(new_key);
+        if (isMatch(index, new_key)) {
+            return value(index);
+        }
+
+        if (isFull()) {
+            return nullptr;
+        }
+
+        // Open a gap at the index in both arrays
+        if (index < m_size) {
+            new (key(m_size)) Key(std::move(*key(m_size - 1U)));
+            new (value(m_size)) Value(std::move(*value(m_size - 1U)));
+            for (size_t i = m_size - 1U; i > index; i--) {
+                *key(i) = std::move(*key(i - 1U));
+                *value(i) = std::move(*value(i - 1U));
+            }
+            key(index)->~Key();
+            value(index)->~Value();
+        }
+        new (key(index)) Key(new_key);
+        new (value(index)) Value(std::forward<Args>(args)...);
+        m_size++;
+        inserted = true;
+
+        return value(index);
+    }
+
+    /// The key storage, sorted. Only the first m_size keys are constructed.
+    StorageHelper<Key> m_keys[N];
+    /// The value storage, parallel to m_keys.
+    StorageHelper<Value> m_values[N];
+    /// The current number of entries.
+    size_t m_size = 0;
+    /// The predicate used to order keys.
+    Compare m_compare {};
+};
+
+template <typename Key, typename Value, size_t N, typename Compare>
+constexpr size_t KeyValueTable<Key, Value, N, Compare>::kNotFound;
+
+} // namespace junk
+
+#endif // KEY_VALUE_TABLE_H
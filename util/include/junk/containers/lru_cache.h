@@ -0,0 +1,379 @@
+/**
+ * @file   lru_cache.h
+ * @brief  This file contains the definition of the LruCache container.
+ * @author Liam Bucci <liam.bucci@gmail.com>
+ * @date   2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#ifndef LRU_CACHE_H
+#define LRU_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#include "junk/containers/fixed_hash_map.h"
+#include "junk/memory/typed_mem_pool.h"
+#include "junk/util/junk_assert.h"
+#include "junk/util/util.h"
+
+namespace junk {
+
+/**
+ * @brief Counters kept by an LruCache, for sizing a cache from real traffic.
+ */
+struct LruCacheStats
+{
+    /// The number of get() calls which found their key.
+    size_t hits = 0;
+    /// The number of get() calls which did not find their key.
+    size_t misses = 0;
+    /// The number of entries evicted to make room for a new entry.
+    size_t evictions = 0;
+};
+
+/**
+ * @brief A fixed-capacity map which evicts the least recently used entry when full.
+ *
+ * Entries are nodes drawn from a TypedMemPool and linked into an intrusive list in order of use,
+ * most recent first. A FixedHashMap indexes the nodes by key. get(), put() and eviction are all
+ * O(1): a hash probe plus a few pointer updates, with no heap and no tree descent.
+ *
+ * get() marks an entry as used and is the only call counted as a hit or a miss. peek() and
+ * contains() read without touching the recency order or the counters.
+ *
+ * @tparam Key
+ *         The key type. Must be copyable and EqualityComparable, a copy is kept in the index.
+ * @tparam Value
+ *         The cached value type.
+ * @tparam N
+ *         The maximum number of entries held by the cache.
+ * @tparam Hash
+ *         The hash function used to index keys. See FixedHashMap.
+ */
+template <typename Key, typename Value, size_t N, typename Hash = util::Hash>
+class LruCache
+{
+public:
+    LruCache() = default;
+
+    /**
+     * @brief Destructor. Destructs all remaining entries.
+     */
+    ~LruCache()
+    {
+        clear();
+    }
+
+    LruCache(const LruCache&) = delete;
+    LruCache& operator=(const LruCache&) = delete;
+
+    /**
+     * @brief Look up a key and mark its entry as the most recently used.
+     *
+     * Counts a hit or a miss.
+     *
+     * @param[in]  key
+     *             The key to look up.
+     * @return A pointer to the cached value, or `nullptr` on a miss.
+     */
+    Value* get(const Key& key)
+    {
+        Node* const* found = m_index.find(key);
+        if (found == nullptr) {
+            m_stats.misses++;
+            return nullptr;
+        }
+
+        m_stats.hits++;
+        moveToFront(*found);
+        return &((*found)->value);
+    }
+
+    /**
+     * @brief Look up a key without changing the recency order or the counters.
+     *
+     * @param[in]  key
+     *             The key to look up.
+     * @return A pointer to the cached value, or `nullptr` if the key is not cached.
+     */
+    const Value* peek(const Key& key) const
+    {
+        Node* const* found = m_index.find(key);
+        return (found != nullptr) ? &((*found)->value) : nullptr;
+    }
+
+    /**
+     * @brief Check if a key is cached, without changing the recency order or the counters.
+     *
+     * @param[in]  key
+     *             The key to look up.
+     * @return `true` if the key is cached, otherwise `false`.
+     */
+    bool contains(const Key& key) const
+    {
+        return m_index.contains(key);
+    }
+
+    /**
+     * @brief Cache a value, and mark its entry as the most recently used.
+     *
+     * Assigns the value if the key is already cached. Otherwise a new entry is constructed, and if
+     * the cache was full the least recently used entry is then evicted. *value* may refer to that
+     * entry.
+     *
+     * @param[in]  key
+     *             The key to cache.
+     * @param[in]  value
+     *             The value to copy or move into the cache.
+     * @return A pointer to the cached value.
+     */
+    template <typename V>
+    Value* put(const Key& key, V&& value)
+    {
+        Node** found = m_index.find(key);
+        if (found != nullptr) {
+            (*found)->value = std::forward<V>(value);
+            moveToFront(*found);
+            return &((*found)->value);
+        }
+
+        return insertNode(key, std::forward<V>(value));
+    }
+
+    /**
+     * @brief Construct a value in place if the key is not already cached.
+     *
+     * If the key is cached nothing is constructed, the entry is only marked as the most recently
+     * used. Otherwise the new entry is constructed, and if the cache was full the least recently
+     * used entry is then evicted. *args* may refer to that entry.
+     *
+     * @param[in]  key
+     *             The key to cache.
+     * @param[in]  args
+     *             The arguments forwarded to the *Value* constructor.
+     * @return A boolean:
+     *         - `true`:  A new entry was constructed.
+     *         - `false`: The key was already cached.
+     */
+    template <typename ... Args>
+    bool tryEmplace(const Key& key, Args&&... args)
+    {
+        Node** found = m_index.find(key);
+        if (found != nullptr) {
+            moveToFront(*found);
+            return false;
+        }
+
+        return (insertNode(key, std::forward<Args>(args)...) != nullptr);
+    }
+
+    /**
+     * @brief Remove the entry with the given key.
+     *
+     * @param[in]  key
+     *             The key to remove.
+     * @return A boolean:
+     *         - `true`:  The entry was removed.
+     *         - `false`: The key was not cached.
+     */
+    bool erase(const Key& key)
+    {
+        Node** found = m_index.find(key);
+        if (found == nullptr) {
+            return false;
+        }
+
+        Node* node = *found;
+        m_index.erase(key);
+        unlink(node);
+        m_pool.deallocate(node);
+
+        return true;
+    }
+
+    /**
+     * @brief Remove all entries. The counters are kept.
+     */
+    void clear()
+    {
+        Node* node = m_head;
+        while (node != nullptr) {
+            Node* next = node->next;
+            m_pool.deallocate(node);
+            node = next;
+        }
+        m_head = nullptr;
+        m_tail = nullptr;
+        m_index.clear();
+    }
+
+    /**
+     * @brief Get the key of the least recently used entry, the next to be evicted.
+     *
+     * @return A pointer to the key, or `nullptr` if the cache is empty.
+     */
+    const Key* oldest() const
+    {
+        return (m_tail != nullptr) ? &(m_tail->key) : nullptr;
+    }
+
+    /**
+     * @brief Get the hit, miss and eviction counters.
+     *
+     * @return The counters since construction or the last resetStats().
+     */
+    const LruCacheStats& stats() const
+    {
+        return m_stats;
+    }
+
+    /**
+     * @brief Reset the hit, miss and eviction counters to zero.
+     */
+    void resetStats()
+    {
+        m_stats = LruCacheStats();
+    }
+
+    /**
+     * @brief Get the current number of entries in the cache.
+     *
+     * @return The current number of entries in the cache.
+     */
+    size_t size() const
+    {
+        return m_index.size();
+    }
+
+    /**
+     * @brief Get the maximum number of entries held by the cache.
+     *
+     * @return The maximum number of entries held by the cache.
+     */
+    size_t capacity() const
+    {
+        return N;
+    }
+
+    /**
+     * @brief Check if the cache is empty.
+     *
+     * @return `true` if the cache is empty, otherwise `false`.
+     */
+    bool isEmpty() const
+    {
+        return m_index.isEmpty();
+    }
+
+    /**
+     * @brief Check if the cache is full, so the next new key evicts an entry.
+     *
+     * @return `true` if the cache is full, otherwise `false`.
+     */
+    bool isFull() const
+    {
+        return m_index.isFull();
+    }
+
+private:
+    /**
+     * @brief An entry, linked into the recency list.
+     */
+    struct Node
+    {
+        template <typename ... Args>
+        Node(const Key& k, Args&&... args) : key(k), value(std::forward<Args>(args)...) {}
+
+        /// The next more recently used entry.
+        Node* prev = nullptr;
+        /// The next less recently used entry.
+        Node* next = nullptr;
+        Key key;
+        Value value;
+    };
+
+    /**
+     * @brief Construct a new entry at the front of the list, evicting the oldest entry if full.
+     *
+     * The new entry is constructed before the oldest is evicted, so the arguments may refer to the
+     * evicted entry, as in `put(k, *peek(*oldest()))`.
+     *
+     * @pre  The key must not be cached.
+     *
+     * @return A pointer to the new value.
+     */
+    template <typename ... Args>
+    Value* insertNode(const Key& key, Args&&... args)
+    {
+        // The pool has a spare node, so this succeeds even when the cache is full
+        Node* node = m_pool.emplace(key, std::forward<Args>(args)...);
+        JUNK_ASSERT_RETURN(node != nullptr, nullptr);
+
+        if (isFull()) {
+            Node* evicted = m_tail;
+            m_index.erase(evicted->key);
+            unlink(evicted);
+            m_pool.deallocate(evicted);
+            m_stats.evictions++;
+        }
+
+        const bool indexed = m_index.tryEmplace(key, node);
+        JUNK_ASSERT(indexed);
+        (void)indexed;
+
+        pushFront(node);
+        return &(node->value);
+    }
+
+    void pushFront(Node* node)
+    {
+        node->prev = nullptr;
+        node->next = m_head;
+        if (m_head != nullptr) {
+            m_head->prev = node;
+        } else {
+            m_tail = node;
+        }
+        m_head = node;
+    }
+
+    void unlink(Node* node)
+    {
+        if (node->prev != nullptr) {
+            node->prev->next = node->next;
+        } else {
+            m_head = node->next;
+        }
+        if (node->next != nullptr) {
+            node->next->prev = node->prev;
+        } else {
+            m_tail = node->prev;
+        }
+    }
+
+    void moveToFront(Node* node)
+    {
+        if (node != m_head) {
+            unlink(node);
+            pushFront(node);
+        }
+    }
+
+    /// The storage for the entries, plus a spare to build a new entry in before one is evicted.
+    TypedMemPool<Node, N + 1U> m_pool;
+    /// The entries indexed by key.
+    FixedHashMap<Key, Node*, N, Hash> m_index;
+    /// The most recently used entry.
+    Node* m_head = nullptr;
+    /// The least recently used entry.
+    Node* m_tail = nullptr;
+    /// The hit, miss and eviction counters.
+    LruCacheStats m_stats;
+};
+
+} // namespace junk
+
+#endif // LRU_CACHE_H
@@ -0,0 +1,274 @@
+/**
+ * @file   mpmc_queue.h
+ * @brief  This file contains the definition of the MpmcQueue container.
+ * @author Liam Bucci <liam.bucci@gmail.com>
+ * @date   2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#ifndef MPMC_QUEUE_H
+#define MPMC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#include "junk/util/util.h"
+
+namespace junk {
+
+/**
+ * @brief A bounded lock-free FIFO queue for any number of producer and consumer threads.
+ *
+ * Each slot carries a sequence number which says whose turn it is (Dmitry Vyukov's bounded MPMC
+ * queue). For the slot at position `pos` the sequence is `pos` while the slot is free for the
+ * producer which claims `pos`, `pos + 1` once the item is stored and the consumer which claims
+ * `pos` may take it, and `pos + S` once it is free again for the next lap. Producers claim a
+ * position by a compare-and-swap on the shared enqueue position, consumers on the shared dequeue
+ * position, so each operation costs one CAS and touches one slot. There is no lock, and a thread
+ * stalled between its claim and its store only holds up the consumer of that one slot.
+ *
+ * Items are stored inline, the queue never allocates.
+ *
+ * @warning Needs `<atomic>` with compare-and-swap, so this container is intended for host builds.
+ *          isEmpty() and size() are snapshots which may be stale by the time they are used.
+ *
+ * @tparam T
+ *         The type stored by this container. Must be copyable or movable.
+ * @tparam S
+ *         The maximum number of items that may be stored in this container. Must be at least 2.
+ *         A power of two turns the slot lookup into a mask.
+ */
+template <class T, size_t S>
+class MpmcQueue
+{
+    static_assert(S >= 2U, "MpmcQueue needs at least 2 slots to tell a full slot from a free one");
+
+public:
+    /**
+     * @brief Constructor for MpmcQueue container.
+     *
+     * Marks every slot as free for the first lap.
+     */
+    MpmcQueue()
+    {
+        for (size_t i = 0; i < S; i++) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Destructor for MpmcQueue container.
+     *
+     * The destructor ensures all remaining internal items are destructed. No other thread may be
+     * using the queue when it is destructed.
+     */
+    ~MpmcQueue()
+    {
+        size_t pos = m_dequeue_pos.load(std::memory_order_relaxed);
+        const size_t end = m_enqueue_pos.load(std::memory_order_relaxed);
+        for (; pos != end; pos++) {
+            m_cells[pos % S].item()->~T();
+        }
+    }
+
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    /**
+     * @brief Enqueue a given item.
+     *
+     * @param[in]  item
+     *             The item to copy into the queue.
+     * @return A boolean:
+     *         - `true`:  The item was stored successfully in the queue.
+     *         - `false`: The queue was full.
+     */
+    bool enqueue(const T& item)
+    {
+        return emplace(item);
+    }
+
+    /**
+     * @brief Enqueue a given item.
+     *
+     * @param[in]  item
+     *             The item to move into the queue.
+     * @return A boolean:
+     *         - `true`:  The item was moved successfully into the queue.
+     *         - `false`: The queue was full.
+     */
+    bool enqueue(T&& item)
+    {
+        return emplace(std::move(item));
+    }
+
+    /**
+     * @brief Emplace an item on the back of the queue.
+     *
+     * @param[in]  args
+     *             The parameter pack of template arguments that will be forwarded to the type *T*
+     *             constructor.
+     * @return A boolean:
+     *         - `true`:  The item was emplaced on the back of the queue.
+     *         - `false`: The queue was full.
+     */
+    template <typename ... Args>
+    bool emplace(Args&&... args)
+    {
+        Cell* cell = nullptr;
+        size_t pos = m_enqueue_pos.load(std::memory_order_relaxed);
+
+        for (;;) {
+            cell = &m_cells[pos % S];
+            const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+            if (diff == 0) {
+                // The slot is free for this lap, try to claim the position
+                if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1U,
+                                                        std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // The slot still holds the item from the previous lap
+                return false;
+            } else {
+                // Another producer claimed this position first
+                pos = m_enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+
+        new (cell->item()) T(std::forward<Args>(args)...);
+        cell->sequence.store(pos + 1U, std::memory_order_release);
+
+        return true;
+    }
+
+    /**
+     * @brief Retrieve the oldest item from the queue.
+     *
+     * The item is moved into *item* and then destructed in the queue.
+     *
+     * @param[out] item
+     *             The retrieved item.
+     * @return A boolean:
+     *         - `true`:  An item was successfully retrieved.
+     *         - `false`: The queue was empty.
+     */
+    bool dequeue(T& item)
+    {
+        Cell* cell = nullptr;
+        size_t pos = m_dequeue_pos.load(std::memory_order_relaxed);
+
+        for (;;) {
+            cell = &m_cells[pos % S];
+            const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t diff =
+                static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1U);
+
+            if (diff == 0) {
+                // The slot holds an item for this lap, try to claim the position
+                if (m_dequeue_pos.compare_exchange_weak(pos, pos + 1U,
+                                                        std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // The producer of this position has not stored its item yet
+                return false;
+            } else {
+                // Another consumer claimed this position first
+                pos = m_dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+
+        T* front = cell->item();
+        item = std::move(*front);
+        front->~T();
+        cell->sequence.store(pos + S, std::memory_order_release);
+
+        return true;
+    }
+
+    /**
+     * @brief Check if the queue is empty.
+     *
+     * @return A boolean:
+     *         - `true`:  The queue is empty.
+     *         - `false`: The queue is not empty.
+     */
+    bool isEmpty() const
+    {
+        return (size() == 0);
+    }
+
+    /**
+     * @brief Get the number of items in the queue.
+     *
+     * Items whose producer has claimed a position but not yet stored the item are counted.
+     *
+     * @return The number of items in the queue.
+     */
+    size_t size() const
+    {
+        const size_t dequeue_pos = m_dequeue_pos.load(std::memory_order_acquire);
+        const size_t enqueue_pos = m_enqueue_pos.load(std::memory_order_acquire);
+        const intptr_t diff =
+            static_cast<intptr_t>(enqueue_pos) - static_cast<intptr_t>(dequeue_pos);
+        if (diff <= 0) {
+            return 0U;
+        }
+
+        // Both positions may have moved on between the two loads
+        return util::min(static_cast<size_t>(diff), S);
+    }
+
+    /**
+     * @brief Get the maximum number of items that can be stored by the queue.
+     *
+     * @return The maximum number of items that can be stored by the queue.
+     */
+    size_t capacity() const
+    {
+        return S;
+    }
+
+private:
+    /**
+     * @brief A storage container which simulates the type *T*.
+     *
+     * Each StorageHelper instance has the same alignment and storage requirements as an object of
+     * type *T*.
+     */
+    struct alignas(T) StorageHelper {
+        uint8_t mem[sizeof(T)];
+    };
+
+    /**
+     * @brief A slot and the sequence number which says whose turn it is.
+     */
+    struct Cell
+    {
+        T* item()
+        {
+            return reinterpret_cast<T*>(&storage);
+        }
+
+        std::atomic<size_t> sequence;
+        StorageHelper storage;
+    };
+
+    /// The next position to be claimed by a producer.
+    alignas(util::kCacheLineSize) std::atomic<size_t> m_enqueue_pos {0};
+    /// The next position to be claimed by a consumer.
+    alignas(util::kCacheLineSize) std::atomic<size_t> m_dequeue_pos {0};
+
+    /// The actual storage for the queue.
+    alignas(util::kCacheLineSize) alignas(Cell) Cell m_cells[S];
+};
+
+} // namespace junk
+
+#endif // MPMC_QUEUE_H
@@ -0,0 +1,209 @@
+/**
+ * @file   optional.h
+ * @brief  This file contains the definition of the Optional container.
+ * @author Liam Bucci <liam.bucci@gmail.com>
+ * @date   2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#ifndef OPTIONAL_H
+#define OPTIONAL_H
+
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#include "junk/util/junk_assert.h"
+
+namespace junk {
+
+/**
+ * @brief A container holding either one item or nothing.
+ *
+ * Stands in for `std::optional`, which needs C++17. The item lives inside the Optional, so
+ * returning one from a function never allocates, and a named Optional returned on every path is
+ * built in the caller's storage.
+ *
+ * @tparam T
+ *         The type stored by this container.
+ */
+template <class T>
+class Optional
+{
+public:
+    /**
+     * @brief Construct an empty Optional.
+     */
+    Optional() = default;
+
+    /**
+     * @brief Construct an Optional holding a copy of *item*.
+     */
+    Optional(const T& item)
+    {
+        emplace(item);
+    }
+
+    /**
+     * @brief Construct an Optional holding *item*, moved in.
+     */
+    Optional(T&& item)
+    {
+        emplace(std::move(item));
+    }
+
+    Optional(const Optional& other)
+    {
+        if (other.m_has_value) {
+            emplace(*other);
+        }
+    }
+
+    Optional(Optional&& other)
+    {
+        if (other.m_has_value) {
+            emplace(std::move(*other));
+        }
+    }
+
+    Optional& operator=(const Optional& other)
+    {
+        if (this != &other) {
+            reset();
+            if (other.m_has_value) {
+                emplace(*other);
+            }
+        }
+        return *this;
+    }
+
+    Optional& operator=(Optional&& other)
+    {
+        if (this != &other) {
+            reset();
+            if (other.m_has_value) {
+                emplace(std::move(*other));
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Destructor for Optional container.
+     *
+     * The destructor ensures the item, if any, is destructed.
+     */
+    ~Optional()
+    {
+        reset();
+    }
+
+    /**
+     * @brief Construct a new item in place, destructing the previous one if there was one.
+     *
+     * @param[in]  args
+     *             The parameter pack of template arguments that will be forwarded to the type *T*
+     *             constructor.
+     * @return The new item.
+     */
+    template <typename ... Args>
+    T& emplace(Args&&... args)
+    {
+        reset();
+        new (reinterpret_cast<T*>(&m_storage)) T(std::forward<Args>(args)...);
+        m_has_value = true;
+        return **this;
+    }
+
+    /**
+     * @brief Destruct the item, if there is one, leaving the Optional empty.
+     */
+    void reset()
+    {
+        if (m_has_value) {
+            reinterpret_cast<T*>(&m_storage)->~T();
+            m_has_value = false;
+        }
+    }
+
+    /**
+     * @brief Check if the Optional holds an item.
+     *
+     * @return A boolean:
+     *         - `true`:  There is an item.
+     *         - `false`: The Optional is empty.
+     */
+    bool hasValue() const
+    {
+        return m_has_value;
+    }
+
+    /**
+     * @brief Same as hasValue(), so an Optional can be tested directly in a condition.
+     */
+    explicit operator bool() const
+    {
+        return m_has_value;
+    }
+
+    /**
+     * @brief Get the item.
+     *
+     * @pre  The Optional must hold an item.
+     *
+     * @return The item.
+     */
+    T& operator*()
+    {
+        JUNK_ASSERT(m_has_value);
+        return *reinterpret_cast<T*>(&m_storage);
+    }
+
+    /**
+     * @brief Get the item of a const Optional.
+     *
+     * @pre  The Optional must hold an item.
+     *
+     * @return The item.
+     */
+    const T& operator*() const
+    {
+        JUNK_ASSERT(m_has_value);
+        return *reinterpret_cast<const T*>(&m_storage);
+    }
+
+    T* operator->()
+    {
+        return &**this;
+    }
+
+    const T* operator->() const
+    {
+        return &**this;
+    }
+
+    /**
+     * @brief Get a copy of the item, or *fallback* if the Optional is empty.
+     */
+    T valueOr(const T& fallback) const
+    {
+        return m_has_value ? **this : fallback;
+    }
+
+private:
+    /**
+     * @brief A storage container which simulates the type *T*.
+     */
+    struct alignas(T) StorageHelper {
+        uint8_t mem[sizeof(T)];
+    };
+
+    /// The storage for the item, only constructed while m_has_value is set.
+    StorageHelper m_storage;
+    /// Whether m_storage holds an item.
+    bool m_has_value = false;
+};
+
+} // namespace junk
+
+#endif // OPTIONAL_H
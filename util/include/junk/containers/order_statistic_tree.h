@@ -0,0 +1,179 @@
+/**
+ * @file   order_statistic_tree.h
+ * @brief  This file contains the definition of the OrderStatisticTree container.
+ * @author Liam Bucci <liam.bucci@gmail.com>
+ * @date   2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#ifndef ORDER_STATISTIC_TREE_H
+#define ORDER_STATISTIC_TREE_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "junk/containers/rb_tree.h"
+#include "junk/util/util.h"
+
+namespace junk {
+
+/**
+ * @brief A Red-Black Tree which answers order statistic queries in O(log n).
+ *
+ * Every node stores the size of its subtree (see SubtreeSize), which is maintained through
+ * insertion, removal and rebalancing. This allows finding the k-th smallest item (select()), the
+ * number of items smaller than a key (rank()), the number of items within a range
+ * (countInRange()) and percentiles without traversing the tree.
+ *
+ * @tparam NumNodes
+ *         Maximum number of nodes that may be stored in the tree.
+ * @tparam T
+ *         The type stored in each node. This must be Comparable using *Compare*.
+ * @tparam Compare
+ *         The three-way predicate used to order keys. See RbTree.
+ * @tparam KeyOf
+ *         The functor which extracts the key of an item. See RbTree.
+ */
+template <size_t NumNodes,
+          typename T,
+          typename Compare = util::ThreeWayCompare,
+          typename KeyOf = util::Identity>
+class OrderStatisticTree : public RbTree<NumNodes, T, Compare, KeyOf, SubtreeSize>
+{
+protected:
+    using Base = RbTree<NumNodes, T, Compare, KeyOf, SubtreeSize>;
+    using Node = typename Base::Node;
+
+public:
+    using Base::Base;
+
+    /**
+     * @brief Find the item with the given rank.
+     *
+     * @param[in]  k
+     *             The zero-based rank of the item, `0` being the smallest item.
+     * @return A pointer to the k-th smallest item, or `nullptr` if *k* is not less than size().
+     */
+    const T* select(size_t k) const
+    {
+        const Node* current = this->m_root;
+        while (current != nullptr) {
+            const size_t left_count = count(current->left);
+            if (k < left_count) {
+                current = current->left;
+            } else if (k == left_count) {
+                return &(current->item);
+            } else {
+                k -= left_count + 1;
+                current = current->right;
+            }
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * @brief Get the number of items strictly less than the given key.
+     *
+     * @tparam K
+     *         Key type. Must be Comparable to the item key type using *Compare*.
+     * @param[in]  key
+     *             The key to rank.
+     * @return The number of items in the tree which compare less than *key*.
+     */
+    template <typename K>
+    size_t rank(const K& key) const
+    {
+        return countBelow(key, false);
+    }
+
+    /**
+     * @brief Get the number of items within the given closed range.
+     *
+     * @tparam K
+     *         Key type. Must be Comparable to the item key type using *Compare*.
+     * @param[in]  low
+     *             The lower bound of the range, inclusive.
+     * @param[in]  high
+     *             The upper bound of the range, inclusive.
+     * @return The number of items *i* where `low <= i <= high`. `0` if *high* is less than
+     *         *low*.
+     */
+    template <typename K>
+    size_t countInRange(const K& low, const K& high) const
+    {
+        const size_t below_high = countBelow(high, true);
+        const size_t below_low = countBelow(low, false);
+
+        return (below_high > below_low) ? (below_high - below_low) : 0;
+    }
+
+    /**
+     * @brief Find the item at the given percentile using the nearest-rank method.
+     *
+     * @param[in]  percent
+     *             The percentile to find, from `0` (smallest item) to `100` (largest item).
+     * @return A pointer to the item at the percentile, or `nullptr` if the tree is empty or
+     *         *percent* is greater than 100.
+     */
+    const T* percentile(uint8_t percent) const
+    {
+        const size_t num_items = count(this->m_root);
+        if ((num_items == 0) || (percent > 100U)) {
+            return nullptr;
+        }
+
+        // Nearest rank: ceil(percent * n / 100), converted to a zero-based rank
+        size_t k = ((percent * num_items) + 99U) / 100U;
+        if (k > 0) {
+            k--;
+        }
+
+        return select(k);
+    }
+
+private:
+    /**
+     * @brief Get the size of a subtree.
+     *
+     * @param[in]  node
+     *             The root of the subtree. May be `nullptr`.
+     * @return The number of nodes in the subtree.
+     */
+    static size_t count(const Node* node)
+    {
+        return (node != nullptr) ? node->count : 0;
+    }
+
+    /**
+     * @brief Count the items less than (or less than or equal to) a key.
+     *
+     * @param[in]  key
+     *             The key to compare against.
+     * @param[in]  inclusive
+     *             Whether items equal to *key* are counted.
+     * @return The number of matching items.
+     */
+    template <typename K>
+    size_t countBelow(const K& key, bool inclusive) const
+    {
+        size_t result = 0;
+        const Node* current = this->m_root;
+        while (current != nullptr) {
+            const int comp = this->compareKey(key, current);
+            if ((comp < 0) || ((comp == 0) && !inclusive)) {
+                // The item and everything to its right is not counted
+                current = current->left;
+            } else {
+                result += count(current->left) + 1;
+                current = current->right;
+            }
+        }
+
+        return result;
+    }
+};
+
+} // namespace junk
+
+#endif // ORDER_STATISTIC_TREE_H
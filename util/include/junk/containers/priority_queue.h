@@ -0,0 +1,494 @@
+/**
+ * @file   priority_queue.h
+ * @brief  This file contains the definition of the PriorityQueue container.
+ * @author Liam Bucci <liam.bucci@gmail.com>
+ * @date   2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#ifndef PRIORITY_QUEUE_H
+#define PRIORITY_QUEUE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#include "junk/util/junk_assert.h"
+#include "junk/util/util.h"
+
+namespace junk {
+
+/**
+ * @brief A fixed-capacity priority queue, kept as a d-ary min-heap.
+ *
+ * The item which sorts first by *Compare* is always at the top. push() and pop() are O(log n) and
+ * top() is O(1). Items are stored inline in heap order, so a sift walks one contiguous array.
+ * With the default arity of 4 the heap is half as deep as a binary heap and the children of a node
+ * are adjacent, which suits host caches. An arity of 2 does the fewest comparisons per pop.
+ *
+ * Each push returns a handle which follows its item as it moves through the heap, so the item can
+ * be changed (decrease-key, for example a deadline brought forward) or removed later in O(log n).
+ * A handle is reused once its item leaves the queue.
+ *
+ * @tparam T
+ *         The type stored by this container. Must be movable.
+ * @tparam N
+ *         The maximum number of items that may be stored in this container.
+ * @tparam Compare
+ *         The three-way predicate used to order items, called as `compare(a, b)`. The smallest
+ *         item is at the top, invert the predicate for a max-heap. See util::ThreeWayCompare.
+ * @tparam Arity
+ *         The number of children of each heap node. Must be at least 2. Defaults to 4.
+ */
+template <class T, size_t N, typename Compare = util::ThreeWayCompare, size_t Arity = 4U>
+class PriorityQueue
+{
+    static_assert(Arity >= 2U, "PriorityQueue needs an arity of at least 2");
+
+public:
+    /// Identifies an item in the queue for update() and erase().
+    using Handle = size_t;
+
+    /// The handle returned when the queue is full.
+    static constexpr Handle kInvalidHandle = ~static_cast<Handle>(0);
+
+    /**
+     * @brief Constructor for PriorityQueue container.
+     *
+     * @param[in]  compare
+     *             The predicate used to order items.
+     */
+    explicit PriorityQueue(const Compare& compare = Compare()) : m_compare(compare)
+    {
+        // Every handle starts out free, parked past the end of the heap
+        for (size_t i = 0; i < N; i++) {
+            m_handles[i] = i;
+            m_positions[i] = i;
+        }
+    }
+
+    /**
+     * @brief Destructor for PriorityQueue container.
+     *
+     * The destructor ensures all remaining internal items are destructed.
+     */
+    ~PriorityQueue()
+    {
+        clear();
+    }
+
+    PriorityQueue(const PriorityQueue&) = delete;
+    PriorityQueue& operator=(const PriorityQueue&) = delete;
+
+    /**
+     * @brief Push the given item onto the queue (by copying).
+     *
+     * @param[in]  item
+     *             The item to store in the queue.
+     * @return The handle of the item, or kInvalidHandle if the queue was full.
+     */
+    Handle push(const T& item)
+    {
+        return emplace(item);
+    }
+
+    /**
+     * @brief Push the given item onto the queue (by moving).
+     *
+     * @param[in]  item
+     *             The item to move into the queue.
+     * @return The handle of the item, or kInvalidHandle if the queue was full.
+     */
+    Handle push(T&& item)
+    {
+        return emplace(std::move(item));
+    }
+
+    /**
+     * @brief Construct an item in place in the queue.
+     *
+     * @param[in]  args
+     *             The parameter pack of template arguments that will be forwarded to the type *T*
+     *             constructor.
+     * @return The handle of the item, or kInvalidHandle if the queue was full.
+     */
+    template <typename ... Args>
+    Handle emplace(Args&&... args)
+    {
+        if (isFull()) {
+            return kInvalidHandle;
+        }
+
+        // The next free handle is parked at the first position past the heap
+        const size_t position = m_size;
+        const Handle handle = m_handles[position];
+        new (item(position)) T(std::forward<Args>(args)...);
+        m_size++;
+
+        // Most new items stay at the bottom, so only lift the item out once it has to move
+        if ((position > 0) && (m_compare(*item(position), *item(parentOf(position))) < 0)) {
+            siftUp(position, std::move(*item(position)), handle);
+        }
+
+        return handle;
+    }
+
+    /**
+     * @brief Get the item at the top of the queue.
+     *
+     * @pre  The queue must not be empty.
+     *
+     * @return A reference to the item which sorts first.
+     */
+    const T& top() const
+    {
+        JUNK_ASSERT(!isEmpty());
+        return *item(0);
+    }
+
+    /**
+     * @brief Peek at the item at the top of the queue.
+     *
+     * Retrieve a copy of the top item without removing it from the queue.
+     *
+     * @param[out] out
+     *             The retrieved item.
+     * @return A boolean:
+     *         - `true`:  An item was successfully retrieved.
+     *         - `false`: The queue was empty.
+     */
+    bool peek(T& out) const
+    {
+        if (isEmpty()) {
+            return false;
+        }
+
+        out = *item(0);
+        return true;
+    }
+
+    /**
+     * @brief Retrieve the item at the top of the queue.
+     *
+     * The item is moved into *out* and then removed from the queue.
+     *
+     * @param[out] out
+     *             The retrieved item.
+     * @return A boolean:
+     *         - `true`:  An item was successfully retrieved.
+     *         - `false`: The queue was empty.
+     */
+    bool pop(T& out)
+    {
+        if (isEmpty()) {
+            return false;
+        }
+
+        out = std::move(*item(0));
+        removeAt(0);
+        return true;
+    }
+
+    /**
+     * @brief Remove the item at the top of the queue.
+     *
+     * @return A boolean:
+     *         - `true`:  An item was removed.
+     *         - `false`: The queue was empty.
+     */
+    bool pop()
+    {
+        if (isEmpty()) {
+            return false;
+        }
+
+        removeAt(0);
+        return true;
+    }
+
+    /**
+     * @brief Check if a handle refers to an item in the queue.
+     *
+     * @param[in]  handle
+     *             The handle to check.
+     * @return `true` if the handle refers to an item in the queue, otherwise `false`.
+     */
+    bool contains(Handle handle) const
+    {
+        return (handle < N) && (m_positions[handle] < m_size);
+    }
+
+    /**
+     * @brief Get the item with the given handle.
+     *
+     * @param[in]  handle
+     *             The handle of the item.
+     * @return A pointer to the item, valid until the next change to the queue, or `nullptr` if the
+     *         handle does not refer to an item in the queue.
+     */
+    const T* find(Handle handle) const
+    {
+        return contains(handle) ? item(m_positions[handle]) : nullptr;
+    }
+
+    /**
+     * @brief Replace the item with the given handle, and move it to its new place in the queue.
+     *
+     * Serves both decrease-key and increase-key, the item sifts whichever way it needs to.
+     *
+     * @param[in]  handle
+     *             The handle of the item.
+     * @param[in]  value
+     *             The new item to copy or move over the old one.
+     * @return A boolean:
+     *         - `true`:  The item was replaced.
+     *         - `false`: The handle does not refer to an item in the queue.
+     */
+    template <typename U>
+    bool update(Handle handle, U&& value)
+    {
+        if (!contains(handle)) {
+            return false;
+        }
+
+        const size_t position = m_positions[handle];
+        *item(position) = std::forward<U>(value);
+        restore(position);
+
+        return true;
+    }
+
+    /**
+     * @brief Remove the item with the given handle.
+     *
+     * @param[in]  handle
+     *             The handle of the item.
+     * @return A boolean:
+     *         - `true`:  The item was removed.
+     *         - `false`: The handle does not refer to an item in the queue.
+     */
+    bool erase(Handle handle)
+    {
+        if (!contains(handle)) {
+            return false;
+        }
+
+        removeAt(m_positions[handle]);
+        return true;
+    }
+
+    /**
+     * @brief Remove all items from the queue.
+     */
+    void clear()
+    {
+        for (size_t i = 0; i < m_size; i++) {
+            item(i)->~T();
+        }
+        m_size = 0;
+    }
+
+    /**
+     * @brief Check if the queue is full.
+     *
+     * @return A boolean:
+     *         - `true`:  The queue is full.
+     *         - `false`: The queue is not full.
+     */
+    bool isFull() const
+    {
+        return (m_size >= N);
+    }
+
+    /**
+     * @brief Check if the queue is empty.
+     *
+     * @return A boolean:
+     *         - `true`:  The queue is empty.
+     *         - `false`: The queue is not empty.
+     */
+    bool isEmpty() const
+    {
+        return (m_size == 0);
+    }
+
+    /**
+     * @brief Get the current number of items in the queue.
+     *
+     * @return The current number of items in the queue.
+     */
+    size_t size() const
+    {
+        return m_size;
+    }
+
+    /**
+     * @brief Get the maximum number of items that can be stored by the queue.
+     *
+     * @return The maximum number of items that can be stored by the queue.
+     */
+    size_t capacity() const
+    {
+        return N;
+    }
+
+private:
+    /**
+     * @brief A storage container which simulates the type *T*.
+     *
+     * Each StorageHelper instance has the same alignment and storage requirements as an object of
+     * type *T*.
+     */
+    struct alignas(T) StorageHelper {
+        uint8_t mem[sizeof(T)];
+    };
+
+    T* item(size_t position)
+    {
+        return reinterpret_cast<T*>(&m_storage[position]);
+    }
+
+    const T* item(size_t position) const
+    {
+        return reinterpret_cast<const T*>(&m_storage[position]);
+    }
+
+    /**
+     * @brief Record which handle is at a heap position.
+     */
+    void place(size_t position, Handle handle)
+    {
+        m_handles[position] = handle;
+        m_positions[handle] = position;
+    }
+
+    /**
+     * @brief Remove the item at a heap position.
+     *
+     * The last item is lifted out and sifted from the hole, and the removed item's handle is
+     * parked past the end of the heap for reuse.
+     */
+    void removeAt(size_t position)
+    {
+        const size_t last = m_size - 1U;
+        const Handle handle = m_handles[position];
+
+        if (position == last) {
+            item(last)->~T();
+            m_size--;
+            return;
+        }
+
+        T moving = std::move(*item(last));
+        const Handle moving_handle = m_handles[last];
+        item(last)->~T();
+        place(last, handle);
+        m_size--;
+
+        if ((position > 0) && (m_compare(moving, *item(parentOf(position))) < 0)) {
+            siftUp(position, std::move(moving), moving_handle);
+        } else {
+            siftDown(position, std::move(moving), moving_handle);
+        }
+    }
+
+    /**
+     * @brief Sift a changed item up or down, whichever restores the heap order.
+     */
+    void restore(size_t position)
+    {
+        const Handle handle = m_handles[position];
+        if ((position > 0) && (m_compare(*item(position), *item(parentOf(position))) < 0)) {
+            siftUp(position, std::move(*item(position)), handle);
+        } else {
+            siftDown(position, std::move(*item(position)), handle);
+        }
+    }
+
+    static size_t parentOf(size_t position)
+    {
+        return (position - 1U) / Arity;
+    }
+
+    /**
+     * @brief Move an item towards the top until its parent sorts before it.
+     *
+     * The item has been lifted out of the hole at *position*, parents are moved down into the hole
+     * one move per level rather than a swap.
+     */
+    void siftUp(size_t position, T&& value, Handle handle)
+    {
+        T moving = std::move(value);
+
+        while (position > 0) {
+            const size_t parent = parentOf(position);
+            if (m_compare(moving, *item(parent)) >= 0) {
+                break;
+            }
+            *item(position) = std::move(*item(parent));
+            place(position, m_handles[parent]);
+            position = parent;
+        }
+
+        *item(position) = std::move(moving);
+        place(position, handle);
+    }
+
+    /**
+     * @brief Move an item towards the bottom until no child sorts before it.
+     *
+     * The item has been lifted out of the hole at *position*, the smallest child is moved up into
+     * the hole at each level.
+     */
+    void siftDown(size_t position, T&& value, Handle handle)
+    {
+        T moving = std::move(value);
+
+        for (;;) {
+            const size_t first = (position * Arity) + 1U;
+            if (first >= m_size) {
+                break;
+            }
+
+            // Pick the child which sorts first, the children are adjacent in memory
+            const size_t end = util::min(first + Arity, m_size);
+            size_t best = first;
+            for (size_t child = first + 1U; child < end; child++) {
+                if (m_compare(*item(child), *item(best)) < 0) {
+                    best = child;
+                }
+            }
+
+            if (m_compare(*item(best), moving) >= 0) {
+                break;
+            }
+            *item(position) = std::move(*item(best));
+            place(position, m_handles[best]);
+            position = best;
+        }
+
+        *item(position) = std::move(moving);
+        place(position, handle);
+    }
+
+    /// The three-way predicate used to order items.
+    Compare m_compare;
+    /// The current number of items in the queue.
+    size_t m_size = 0;
+    /// The handle of the item at each heap position, free handles are parked past the end.
+    Handle m_handles[N];
+    /// The heap position of each handle.
+    size_t m_positions[N];
+
+    /// The actual storage for the queue, in heap order.
+    StorageHelper m_storage[N] {};
+};
+
+template <class T, size_t N, typename Compare, size_t Arity>
+constexpr typename PriorityQueue<T, N, Compare, Arity>::Handle
+PriorityQueue<T, N, Compare, Arity>::kInvalidHandle;
+
+} // namespace junk
+
+#endif // PRIORITY_QUEUE_H
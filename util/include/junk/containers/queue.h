@@ -10,26 +10,255 @@
 #define QUEUE_H
 
 #include <cstdint>
+#include <cstring>
 #include <new>
+#include <type_traits>
 #include <utility>
 
+#include "junk/containers/optional.h"
+#include "junk/containers/span.h"
 #include "junk/util/junk_assert.h"
+#include "junk/util/util.h"
 
 namespace junk {
 
+/**
+ * @brief The read and write positions of a Queue.
+ *
+ * For a general capacity the positions are slot indices which wrap back to zero at *S*, and the
+ * number of items is kept in a separate count to tell a full queue from an empty one.
+ *
+ * @tparam S
+ *         The number of slots in the queue.
+ * @tparam Pow2
+ *         Whether *S* is a power of two, selects the specialization below.
+ */
+template <size_t S, bool Pow2 = util::isPow2(S)>
+class QueueIndices
+{
+public:
+    /**
+     * @brief Get the slot of the item at the front of the queue.
+     */
+    size_t readSlot() const
+    {
+        return m_read_index;
+    }
+
+    /**
+     * @brief Get the slot the next item will be stored in.
+     */
+    size_t writeSlot() const
+    {
+        return m_write_index;
+    }
+
+    /**
+     * @brief Get the slot of the item at an index from the front of the queue.
+     *
+     * @pre  *index* must be less than *S*.
+     */
+    size_t slotAt(size_t index) const
+    {
+        const size_t slot = m_read_index + index;
+        return (slot >= S) ? (slot - S) : slot;
+    }
+
+    /**
+     * @brief Advance past items added to the back of the queue.
+     *
+     * @pre  The items must not run past the end of the storage, only up to it.
+     *
+     * @param[in]  count
+     *             The number of items added. Defaults to `1`.
+     */
+    void pushBack(size_t count = 1U)
+    {
+        m_write_index += count;
+        if (m_write_index >= S) {
+            m_write_index = 0;
+        }
+        m_size += count;
+    }
+
+    /**
+     * @brief Advance past items removed from the front of the queue.
+     *
+     * @pre  The items must not run past the end of the storage, only up to it.
+     *
+     * @param[in]  count
+     *             The number of items removed. Defaults to `1`.
+     */
+    void popFront(size_t count = 1U)
+    {
+        m_read_index += count;
+        if (m_read_index >= S) {
+            m_read_index = 0;
+        }
+        m_size -= count;
+    }
+
+    /**
+     * @brief Get the number of items between the two positions.
+     */
+    size_t size() const
+    {
+        return m_size;
+    }
+
+private:
+    /// The index of the next item to read out (dequeue).
+    size_t m_read_index = 0;
+    /// The index of the next available write slot (enqueue).
+    size_t m_write_index = 0;
+    /// The current number of items in the queue.
+    size_t m_size = 0;
+};
+
+/**
+ * @brief The read and write positions of a Queue with a power-of-two capacity.
+ *
+ * The positions run freely and are masked down to a slot, so advancing never branches. Unsigned
+ * wraparound of a position is a multiple of *S*, so the number of items is simply the difference
+ * of the two positions and no separate count is kept.
+ */
+template <size_t S>
+class QueueIndices<S, true>
+{
+public:
+    size_t readSlot() const
+    {
+        return m_read_pos & kMask;
+    }
+
+    size_t writeSlot() const
+    {
+        return m_write_pos & kMask;
+    }
+
+    size_t slotAt(size_t index) const
+    {
+        return (m_read_pos + index) & kMask;
+    }
+
+    void pushBack(size_t count = 1U)
+    {
+        m_write_pos += count;
+    }
+
+    void popFront(size_t count = 1U)
+    {
+        m_read_pos += count;
+    }
+
+    size_t size() const
+    {
+        return m_write_pos - m_read_pos;
+    }
+
+private:
+    static constexpr size_t kMask = S - 1U;
+
+    /// The free running position of the next item to read out (dequeue).
+    size_t m_read_pos = 0;
+    /// The free running position of the next available write slot (enqueue).
+    size_t m_write_pos = 0;
+};
+
+/**
+ * @brief What a Queue does with a new item when it is full.
+ */
+enum class QueueFullPolicy
+{
+    kReject,   ///< The new item is refused, the producer sees the queue is full.
+    kOverwrite ///< The oldest item is dropped to make room, the producer never has to wait.
+};
+
+/**
+ * @brief The dropped item counter of an overwriting Queue.
+ *
+ * @tparam Policy
+ *         The QueueFullPolicy of the Queue.
+ */
+template <QueueFullPolicy Policy>
+class QueueDropCounter
+{
+public:
+    /**
+     * @brief Get the number of items dropped to make room for newer ones.
+     *
+     * A consumer can compare this with an earlier reading to see how many items it missed.
+     *
+     * @return The number of items dropped since construction or the last resetDropped().
+     */
+    size_t dropped() const
+    {
+        return m_dropped;
+    }
+
+    /**
+     * @brief Reset the dropped item counter to zero.
+     */
+    void resetDropped()
+    {
+        m_dropped = 0;
+    }
+
+protected:
+    void countDropped(size_t count)
+    {
+        m_dropped += count;
+    }
+
+private:
+    /// The number of items dropped since construction or the last resetDropped().
+    size_t m_dropped = 0;
+};
+
+/**
+ * @brief A rejecting Queue never drops items, so it stores no counter.
+ *
+ * Empty, so a Queue with the default policy is no larger for the counter existing.
+ */
+template <>
+class QueueDropCounter<QueueFullPolicy::kReject>
+{
+public:
+    size_t dropped() const
+    {
+        return 0;
+    }
+
+    void resetDropped() {}
+
+protected:
+    void countDropped(size_t) {}
+};
+
 /**
  * @brief Queue container class.
  *
  * This class is a container which acts as a FIFO circular buffer. It can be used with any type
  * as long as the type is either copyable or movable.
  *
+ * A power-of-two capacity is tracked by free running indices (see QueueIndices), which saves the
+ * wraparound branches and the size count on every operation.
+ *
+ * With QueueFullPolicy::kOverwrite the queue keeps the latest *S* items: adding to a full queue
+ * drops the oldest item in O(1) and counts it in dropped(), for telemetry and logs where a stalled
+ * producer is worse than a lost sample. The new item is built before the oldest is dropped, so it
+ * may be a copy of that item, and is then moved into place, so *T* must be move constructible.
+ *
  * @tparam T
  *         The type stored by this container.
  * @tparam S
  *         The maximum number of items that may be stored in this container.
+ * @tparam Policy
+ *         What enqueue() and emplace() do when the queue is full. Defaults to
+ *         QueueFullPolicy::kReject.
  */
-template <class T, size_t S>
-class Queue
+template <class T, size_t S, QueueFullPolicy Policy = QueueFullPolicy::kReject>
+class Queue : public QueueDropCounter<Policy>
 {
 public:
     Queue() = default;
@@ -42,69 +271,43 @@ public:
     ~Queue()
     {
         while (!isEmpty()) {
-            reinterpret_cast<T*>(&m_storage[m_read_index])->~T();
-            m_read_index++;
-            if (m_read_index >= S) {
-                m_read_index = 0;
-            }
-            m_size--;
+            reinterpret_cast<T*>(&m_storage[m_indices.readSlot()])->~T();
+            m_indices.popFront();
         }
     }
 
     /**
      * @brief Enqueue a given item.
      *
-     * Enqueues the given item at the back of the queue. The type of *T* must be copyable.
+     * Enqueues the given item at the back of the queue. The item is copy constructed in place, so
+     * the type of *T* must be copy constructible.
      *
      * @param[in]  item
      *             The item to store in the queue.
      * @return A boolean:
      *         - `true`:  The item was stored successfully in the queue.
-     *         - `false`: The queue was full.
+     *         - `false`: The queue was full. Never returned by an overwriting queue.
      */
     bool enqueue(const T& item)
     {
-        bool success = false;
-
-        if (!isFull()) {
-            *reinterpret_cast<T*>(&m_storage[m_write_index]) = item;
-            m_write_index++;
-            if (m_write_index >= S) {
-                m_write_index = 0;
-            }
-            m_size++;
-            success = true;
-        }
-
-        return success;
+        return constructBack(item);
     }
 
     /**
      * @brief Enqueue a given item.
      *
-     * Enqueues the given item at the back of the queue. The type of *T* must be movable.
+     * Enqueues the given item at the back of the queue. The item is move constructed in place, so
+     * the type of *T* must be move constructible.
      *
      * @param[in]  item
      *             The item to store in the queue.
      * @return A boolean:
      *         - `true`:  The item was moved successfully into the queue.
-     *         - `false`: The queue was full.
+     *         - `false`: The queue was full. Never returned by an overwriting queue.
      */
     bool enqueue(T&& item)
     {
-        bool success = false;
-
-        if (!isFull()) {
-            *reinterpret_cast<T*>(&m_storage[m_write_index]) = std::move(item);
-            m_write_index++;
-            if (m_write_index >= S) {
-                m_write_index = 0;
-            }
-            m_size++;
-            success = true;
-        }
-
-        return success;
+        return constructBack(std::move(item));
     };
 
     /**
@@ -116,23 +319,11 @@ public:
      *             The item to store in the queue.
      * @return A boolean:
      *         - `true`:  The item was moved successfully into the queue.
-     *         - `false`: The queue was full.
+     *         - `false`: The queue was full. Never returned by an overwriting queue.
      */
     bool enqueue(const T&& item)
     {
-        bool success = false;
-
-        if (!isFull()) {
-            *reinterpret_cast<T*>(&m_storage[m_write_index]) = std::move(item);
-            m_write_index++;
-            if (m_write_index >= S) {
-                m_write_index = 0;
-            }
-            m_size++;
-            success = true;
-        }
-
-        return success;
+        return constructBack(std::move(item));
     };
 
     /**
@@ -145,25 +336,12 @@ public:
      *             constructor.
      * @return A boolean:
      *         - `true`:  The item was emplaced on the back of the queue.
-     *         - `false`: The queue was full.
+     *         - `false`: The queue was full. Never returned by an overwriting queue.
      */
     template <typename ... Args>
     bool emplace(Args&&... args)
     {
-        bool success = false;
-
-        if (!isFull()) {
-            // Construct the item on the queue
-            new (reinterpret_cast<T*>(&m_storage[m_write_index])) T(std::forward<Args>(args)...);
-            m_write_index++;
-            if (m_write_index >= S) {
-                m_write_index = 0;
-            }
-            m_size++;
-            success = true;
-        }
-
-        return success;
+        return constructBack(std::forward<Args>(args)...);
     };
 
     /**
@@ -183,13 +361,9 @@ public:
         bool success = false;
 
         if (!isEmpty()) {
-            item = *reinterpret_cast<T*>(&m_storage[m_read_index]);
-            reinterpret_cast<T*>(&m_storage[m_read_index])->~T();
-            m_read_index++;
-            if (m_read_index >= S) {
-                m_read_index = 0;
-            }
-            m_size--;
+            item = *reinterpret_cast<T*>(&m_storage[m_indices.readSlot()]);
+            reinterpret_cast<T*>(&m_storage[m_indices.readSlot()])->~T();
+            m_indices.popFront();
             success = true;
         }
 
@@ -213,19 +387,353 @@ public:
         bool success = false;
 
         if (!isEmpty()) {
-            item = std::move(*reinterpret_cast<T*>(&m_storage[m_read_index]));
-            reinterpret_cast<T*>(&m_storage[m_read_index])->~T();
-            m_read_index++;
-            if (m_read_index >= S) {
-                m_read_index = 0;
-            }
-            m_size--;
+            item = std::move(*reinterpret_cast<T*>(&m_storage[m_indices.readSlot()]));
+            reinterpret_cast<T*>(&m_storage[m_indices.readSlot()])->~T();
+            m_indices.popFront();
             success = true;
         }
 
         return success;
     };
 
+    /**
+     * @brief Retrieve the oldest item from the queue, if there is one.
+     *
+     * The item is moved straight into the returned Optional, so unlike dequeue(T&) the caller does
+     * not need a default constructed item to receive it.
+     *
+     * @return The oldest item, or an empty Optional if the queue was empty.
+     */
+    Optional<T> tryDequeue()
+    {
+        Optional<T> item;
+
+        if (!isEmpty()) {
+            T* front_item = reinterpret_cast<T*>(&m_storage[m_indices.readSlot()]);
+            item.emplace(std::move(*front_item));
+            front_item->~T();
+            m_indices.popFront();
+        }
+
+        return item;
+    }
+
+    /**
+     * @brief Process the oldest item in place, then remove it from the queue.
+     *
+     * *fn* is called with a reference to the item while it is still in the queue, so it may read
+     * it or move from it without a copy. The item is destructed once *fn* returns.
+     *
+     * @param[in]  fn
+     *             The function to call with the item, as `fn(T&)`.
+     * @return A boolean:
+     *         - `true`:  An item was processed and removed.
+     *         - `false`: The queue was empty, *fn* was not called.
+     */
+    template <typename F>
+    bool consume(F&& fn)
+    {
+        bool success = false;
+
+        if (!isEmpty()) {
+            T* front_item = reinterpret_cast<T*>(&m_storage[m_indices.readSlot()]);
+            fn(*front_item);
+            front_item->~T();
+            m_indices.popFront();
+            success = true;
+        }
+
+        return success;
+    }
+
+    /**
+     * @brief Enqueue as many of the given items as fit.
+     *
+     * The items are copied in at most two contiguous runs, one up to the end of the storage and
+     * one from its start. Trivially copyable items are copied with `memcpy`, others are copy
+     * constructed in place.
+     *
+     * With QueueFullPolicy::kOverwrite all of *items* are taken: old items are dropped to make room,
+     * and if *items* holds more than *S* only its last *S* items are stored. Every item lost either
+     * way is counted in dropped().
+     *
+     * @pre  *items* must not refer to items in this queue, an overwriting queue drops old items
+     *       before the copy.
+     *
+     * @param[in]  items
+     *             The items to store in the queue, in order.
+     * @return The number of items taken from *items*. Less than the length of *items* if the queue
+     *         became full and does not overwrite.
+     */
+    size_t enqueueBulk(Span<const T> items)
+    {
+        const T* src = items.cget();
+        size_t count = items.length();
+        size_t taken = count;
+
+        if (Policy == QueueFullPolicy::kOverwrite) {
+            // Only the last S items can be kept, then drop as many old items as needed
+            if (count > S) {
+                this->countDropped(count - S);
+                src += count - S;
+                count = S;
+            }
+            if (count > (S - size())) {
+                const size_t excess = count - (S - size());
+                release(excess);
+                this->countDropped(excess);
+            }
+        } else {
+            count = util::min(count, S - size());
+            taken = count;
+        }
+
+        size_t done = 0;
+        while (done < count) {
+            const size_t slot = m_indices.writeSlot();
+            const size_t run = util::min(count - done, S - slot);
+            copyIn(slot, src + done, run, std::is_trivially_copyable<T>());
+            m_indices.pushBack(run);
+            done += run;
+        }
+
+        return taken;
+    }
+
+    /**
+     * @brief Dequeue as many items as are queued, up to the length of *items*.
+     *
+     * The items are copied out in at most two contiguous runs. Trivially copyable items are copied
+     * with `memcpy`, others are moved into *items* and then destructed in the queue.
+     *
+     * @param[out] items
+     *             The retrieved items, oldest first.
+     * @return The number of items retrieved into the front of *items*. Less than the length of
+     *         *items* if the queue became empty.
+     */
+    size_t dequeueBulk(Span<T> items)
+    {
+        const size_t count = util::min(items.length(), size());
+        T* dst = items.get();
+
+        size_t done = 0;
+        while (done < count) {
+            const size_t slot = m_indices.readSlot();
+            const size_t run = util::min(count - done, S - slot);
+            moveOut(slot, dst + done, run, std::is_trivially_copyable<T>());
+            m_indices.popFront(run);
+            done += run;
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief Reserve a contiguous region at the back of the queue to be filled in place.
+     *
+     * The region is cut short at the end of the storage, so it may hold fewer than *count* items
+     * even when there is room for more. Once the region is committed a second reservation starts
+     * at the front of the storage. The items are not part of the queue until commit() is called.
+     *
+     * Only for trivial types, since the region is raw storage handed out to be written.
+     *
+     * @param[in]  count
+     *             The number of items wanted.
+     * @return A Span over the writable region, of at most *count* items. Empty if the queue is
+     *         full.
+     */
+    Span<T> reserve(size_t count)
+    {
+        static_assert(std::is_trivial<T>::value,
+                      "Queue::reserve() hands out raw storage, T must be a trivial type");
+
+        const size_t slot = m_indices.writeSlot();
+        const size_t length = util::min(util::min(count, S - size()), S - slot);
+        if (length == 0) {
+            return Span<T>();
+        }
+
+        return Span<T>(reinterpret_cast<T*>(&m_storage[slot]), length);
+    }
+
+    /**
+     * @brief Add items written into a region from reserve() to the back of the queue.
+     *
+     * @param[in]  count
+     *             The number of items written, from the start of the region.
+     * @return A boolean:
+     *         - `true`:  The items were added to the queue.
+     *         - `false`: *count* is larger than the region reserve() can return, nothing was added.
+     */
+    bool commit(size_t count)
+    {
+        const size_t slot = m_indices.writeSlot();
+        JUNK_ASSERT_RETURN(count <= util::min(S - size(), S - slot), false);
+
+        m_indices.pushBack(count);
+        return true;
+    }
+
+    /**
+     * @brief Get the items at the front of the queue which are stored contiguously.
+     *
+     * The region ends at the end of the storage, so it may hold fewer items than the queue. Once
+     * it is released the next call returns the items at the start of the storage. The items stay
+     * in the queue until release() is called, so the region can be handed straight to a driver.
+     *
+     * @return A Span over the readable region. Empty if the queue is empty.
+     */
+    Span<const T> peekContiguous() const
+    {
+        const size_t slot = m_indices.readSlot();
+        const size_t length = util::min(size(), S - slot);
+        if (length == 0) {
+            return Span<const T>();
+        }
+
+        return Span<const T>(reinterpret_cast<const T*>(&m_storage[slot]), length);
+    }
+
+    /**
+     * @brief Remove items from the front of the queue without retrieving them.
+     *
+     * Completes a peekContiguous(), but may also drop items beyond its region.
+     *
+     * @param[in]  count
+     *             The number of items to remove.
+     * @return A boolean:
+     *         - `true`:  The items were removed.
+     *         - `false`: There are fewer than *count* items in the queue, nothing was removed.
+     */
+    bool release(size_t count)
+    {
+        JUNK_ASSERT_RETURN(count <= size(), false);
+
+        while (count > 0) {
+            const size_t slot = m_indices.readSlot();
+            const size_t run = util::min(count, S - slot);
+            for (size_t i = 0; i < run; i++) {
+                reinterpret_cast<T*>(&m_storage[slot + i])->~T();
+            }
+            m_indices.popFront(run);
+            count -= run;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Get both contiguous segments of the items in the queue.
+     *
+     * The items run from the front of the queue to the end of the storage, and then on from the
+     * start of the storage. Together the two segments hold every item, oldest first. They are
+     * valid until the queue is next changed.
+     *
+     * @param[out] first
+     *             The segment holding the front of the queue, the same as peekContiguous(). Empty if
+     *             the queue is empty.
+     * @param[out] second
+     *             The segment holding the rest of the items. Empty if the items do not wrap.
+     */
+    void segments(Span<const T>& first, Span<const T>& second) const
+    {
+        first = peekContiguous();
+        second = Span<const T>();
+
+        const size_t rest = size() - first.length();
+        if (rest > 0) {
+            second = Span<const T>(reinterpret_cast<const T*>(&m_storage[0]), rest);
+        }
+    }
+
+    /**
+     * @brief Get the oldest item in the queue.
+     *
+     * Unlike peek() no copy is made, the item stays in the queue.
+     *
+     * @pre  The queue must not be empty.
+     *
+     * @return The item at the front of the queue.
+     */
+    T& front()
+    {
+        JUNK_ASSERT(!isEmpty());
+        return *reinterpret_cast<T*>(&m_storage[m_indices.readSlot()]);
+    }
+
+    /**
+     * @brief Get the oldest item in the const queue.
+     *
+     * @pre  The queue must not be empty.
+     *
+     * @return The item at the front of the queue.
+     */
+    const T& front() const
+    {
+        JUNK_ASSERT(!isEmpty());
+        return *reinterpret_cast<const T*>(&m_storage[m_indices.readSlot()]);
+    }
+
+    /**
+     * @brief Get an item by its index from the front of the queue.
+     *
+     * @pre  *i* must be strictly less than the size of the queue.
+     *
+     * @param[in]  i
+     *             The index of the item, `0` is the oldest item.
+     * @return The item at index *i*.
+     */
+    T& at(const size_t i)
+    {
+        JUNK_ASSERT(i < size());
+        return *reinterpret_cast<T*>(&m_storage[m_indices.slotAt(i)]);
+    }
+
+    /**
+     * @brief Get an item by its index from the front of the const queue.
+     *
+     * @pre  *i* must be strictly less than the size of the queue.
+     *
+     * @param[in]  i
+     *             The index of the item, `0` is the oldest item.
+     * @return The item at index *i*.
+     */
+    const T& at(const size_t i) const
+    {
+        JUNK_ASSERT(i < size());
+        return *reinterpret_cast<const T*>(&m_storage[m_indices.slotAt(i)]);
+    }
+
+    /**
+     * @brief Get an item by its index from the back of the queue.
+     *
+     * @pre  *i* must be strictly less than the size of the queue.
+     *
+     * @param[in]  i
+     *             The index of the item, `0` is the newest item.
+     * @return The item at index *i* from the back.
+     */
+    T& atBack(const size_t i)
+    {
+        JUNK_ASSERT(i < size());
+        return at(size() - 1U - i);
+    }
+
+    /**
+     * @brief Get an item by its index from the back of the const queue.
+     *
+     * @pre  *i* must be strictly less than the size of the queue.
+     *
+     * @param[in]  i
+     *             The index of the item, `0` is the newest item.
+     * @return The item at index *i* from the back.
+     */
+    const T& atBack(const size_t i) const
+    {
+        JUNK_ASSERT(i < size());
+        return at(size() - 1U - i);
+    }
+
     /**
      * @brief Peek at the next item in the queue.
      *
@@ -242,7 +750,7 @@ public:
         bool success = false;
 
         if (!isEmpty()) {
-            item = *reinterpret_cast<const T*>(&m_storage[m_read_index]);
+            item = *reinterpret_cast<const T*>(&m_storage[m_indices.readSlot()]);
             success = true;
         }
 
@@ -258,7 +766,7 @@ public:
      */
     bool isFull() const
     {
-        return (m_size >= S);
+        return (m_indices.size() >= S);
     };
 
     /**
@@ -270,7 +778,7 @@ public:
      */
     bool isEmpty() const
     {
-        return (m_size == 0);
+        return (m_indices.size() == 0);
     };
 
     /**
@@ -280,7 +788,7 @@ public:
      */
     size_t size() const
     {
-        return m_size;
+        return m_indices.size();
     };
 
     /**
@@ -304,12 +812,88 @@ private:
         uint8_t mem[sizeof(T)];
     };
 
-    /// The index of the next item to read out (dequeue).
-    size_t m_read_index = 0;
-    /// The index of the next available write slot (enqueue).
-    size_t m_write_index = 0;
-    /// The current number of items in the queue.
-    size_t m_size = 0;
+    /**
+     * @brief Construct a new item at the back of the queue.
+     *
+     * The item is constructed in place, the write slot is raw storage and is never assigned to.
+     *
+     * @param[in]  args
+     *             The arguments forwarded to the *T* constructor.
+     * @return `true` if the item was stored, `false` if the queue was full and rejects new items.
+     */
+    template <typename ... Args>
+    bool constructBack(Args&&... args)
+    {
+        bool success = false;
+
+        if (!isFull()) {
+            T* slot = reinterpret_cast<T*>(&m_storage[m_indices.writeSlot()]);
+            new (slot) T(std::forward<Args>(args)...);
+            m_indices.pushBack();
+            success = true;
+        } else {
+            success = overwriteBack(
+                std::integral_constant<bool, Policy == QueueFullPolicy::kOverwrite>(),
+                std::forward<Args>(args)...);
+        }
+
+        return success;
+    }
+
+    template <typename ... Args>
+    bool overwriteBack(std::false_type /* overwrite */, Args&&...)
+    {
+        return false;
+    }
+
+    /**
+     * @brief Drop the oldest item of a full queue and construct a new item in its place.
+     *
+     * The new item is built first and moved into the freed slot afterwards, because *args* may
+     * refer to the oldest item, as in `enqueue(front())`.
+     */
+    template <typename ... Args>
+    bool overwriteBack(std::true_type /* overwrite */, Args&&... args)
+    {
+        T item(std::forward<Args>(args)...);
+
+        reinterpret_cast<T*>(&m_storage[m_indices.readSlot()])->~T();
+        m_indices.popFront();
+        this->countDropped(1U);
+
+        new (reinterpret_cast<T*>(&m_storage[m_indices.writeSlot()])) T(std::move(item));
+        m_indices.pushBack();
+        return true;
+    }
+
+    void copyIn(size_t slot, const T* src, size_t count, std::true_type /* trivial */)
+    {
+        std::memcpy(&m_storage[slot], src, count * sizeof(T));
+    }
+
+    void copyIn(size_t slot, const T* src, size_t count, std::false_type /* trivial */)
+    {
+        for (size_t i = 0; i < count; i++) {
+            new (reinterpret_cast<T*>(&m_storage[slot + i])) T(src[i]);
+        }
+    }
+
+    void moveOut(size_t slot, T* dst, size_t count, std::true_type /* trivial */)
+    {
+        std::memcpy(dst, &m_storage[slot], count * sizeof(T));
+    }
+
+    void moveOut(size_t slot, T* dst, size_t count, std::false_type /* trivial */)
+    {
+        for (size_t i = 0; i < count; i++) {
+            T* item = reinterpret_cast<T*>(&m_storage[slot + i]);
+            dst[i] = std::move(*item);
+            item->~T();
+        }
+    }
+
+    /// The read and write positions.
+    QueueIndices<S> m_indices;
 
     /// The actual storage for the queue.
     StorageHelper m_storage[S] {};
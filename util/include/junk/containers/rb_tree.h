@@ -11,6 +11,7 @@
 
 #include <cstdint>
 #include <cstring>
+#include <utility>
 
 #include "junk/memory/typed_mem_pool.h"
 #include "junk/util/junk_assert.h"
@@ -19,24 +20,145 @@
 namespace junk {
 
 /**
- * @brief A binary tree container implemented as a Red-Black Tree.
+ * @brief RbTree augmentation which stores nothing.
  *
+ * An augmentation is a base of every tree node which caches a summary of the node's subtree. The
+ * tree calls `update()` on a node whenever its children change, so the summary of every node
+ * always reflects its current subtree. `kEnabled` allows the tree to skip maintaining an
+ * augmentation which stores nothing.
+ */
+struct NoAugmentation
+{
+    /// This augmentation does not need to be maintained.
+    static constexpr bool kEnabled = false;
+
+    /**
+     * @brief Recompute the summary of a node from its item and children.
+     *
+     * @param[in]  item
+     *             The item stored by the node.
+     * @param[in]  left
+     *             The augmentation of the left child, or `nullptr` if there is none.
+     * @param[in]  right
+     *             The augmentation of the right child, or `nullptr` if there is none.
+     */
+    template <typename Item>
+    void update(const Item& item, const NoAugmentation* left, const NoAugmentation* right)
+    {
+        (void)item;
+        (void)left;
+        (void)right;
+    }
+};
+
+/**
+ * @brief RbTree augmentation which stores the number of nodes in each subtree.
+ *
+ * Allows order statistic queries (rank and select) in O(log n). See OrderStatisticTree.
+ */
+struct SubtreeSize
+{
+    /// This augmentation must be maintained.
+    static constexpr bool kEnabled = true;
+
+    /// @copydoc NoAugmentation::update()
+    template <typename Item>
+    void update(const Item& item, const SubtreeSize* left, const SubtreeSize* right)
+    {
+        (void)item;
+        count = 1 + ((left != nullptr) ? left->count : 0) + ((right != nullptr) ? right->count : 0);
+    }
+
+    /// The number of nodes in the subtree rooted at this node, including this node.
+    size_t count = 1;
+};
+
+/**
+ * @brief The link from an RbTree to a node, a plain pointer.
+ *
+ * A tree read by other threads while it changes swaps in a link type which behaves like a pointer
+ * but is loaded and stored atomically. See ConcurrentRbTree.
+ */
+template <typename N>
+using PlainLink = N*;
+
+/**
+ * @brief A binary tree container implemented as a Red-Black Tree, storing its nodes in an external
+ *        pool.
+ *
+ * Several trees may share one node pool. Nodes then move between them without copying items:
+ * split() moves every item from a key upward into another tree, and join() moves every item of
+ * another tree with a disjoint range into this one, both in O(log n). Use RbTree for a tree which
+ * owns its pool.
+ *
+ * Items are ordered by a three-way `Compare` predicate which is called exactly once per level
+ * while descending the tree. The predicate must have a signature similar to
+ * `int comp(const K& a, const T& b)`, where the return values follow:
+ * - `0` if `a == b`
+ * - A negative number if `a < b`
+ * - A positive number if `a > b`.
  *
+ * The predicate never sees whole items, only keys. A `KeyOf` extractor returns the key of an
+ * item, so records whose key is a single field can be stored directly and compared on that field,
+ * without a wrapper type. By default the whole item is the key. The predicate is called with item
+ * keys on both sides when inserting and with the search key on the left side when searching.
  *
  * @tparam NumNodes
  *         Maximum number of nodes that may be stored in the tree.
  * @tparam T
- *         The type stored in each node. This must be Comparable.
+ *         The type stored in each node. Its key must be Comparable using *Compare*.
+ * @tparam Compare
+ *         The three-way predicate used to order keys. Defaults to util::ThreeWayCompare, which
+ *         uses `operator <` and `operator ==`.
+ * @tparam KeyOf
+ *         A stateless functor returning a reference to the key of an item, with a signature
+ *         similar to `const Key& keyOf(const T& item)`. Defaults to util::Identity.
+ * @tparam Augment
+ *         The per-subtree summary stored in every node. Defaults to NoAugmentation. See
+ *         SubtreeSize for the interface an augmentation must provide.
+ * @tparam Link
+ *         The type of the root and child links, given the node type. Defaults to PlainLink.
  */
-template <size_t NumNodes, typename T>
-class RbTree
+template <size_t NumNodes,
+          typename T,
+          typename Compare = util::ThreeWayCompare,
+          typename KeyOf = util::Identity,
+          typename Augment = NoAugmentation,
+          template <typename> class Link = PlainLink>
+class PooledRbTree
 {
+protected:
+    struct Node;
+
 public:
-    /// Default constructor.
-    RbTree() = default;
+    /// The type of the pool which stores the nodes of the tree.
+    using Pool = TypedMemPool<Node, NumNodes>;
+
+    /**
+     * @brief Constructor which sets the node pool.
+     *
+     * @param[in]  pool
+     *             The pool to store nodes in. Must outlive the tree.
+     */
+    explicit PooledRbTree(Pool& pool) : m_pool(&pool) {}
+
+    /**
+     * @brief Constructor which sets the node pool and the comparison predicate.
+     *
+     * @param[in]  pool
+     *             The pool to store nodes in. Must outlive the tree.
+     * @param[in]  compare
+     *             The predicate used to order items in the tree.
+     */
+    PooledRbTree(Pool& pool, const Compare& compare) : m_pool(&pool), m_compare(compare) {}
+
+    /// Trees are not copyable, their nodes cannot be shared.
+    PooledRbTree(const PooledRbTree&) = delete;
+    PooledRbTree& operator=(const PooledRbTree&) = delete;
+
     /// Default destructor.
     /// @todo Destruct all remaining nodes before destructing container.
-    ~RbTree() = default;
+    ~PooledRbTree() = default;
 
     /**
      * @brief Insert an array of items.
@@ -84,46 +206,7 @@ public:
      */
     bool insert(const T& item)
     {
-        bool success = false;
-
-        // Trivial case of empty tree
-        if (m_root == nullptr) {
-            m_root = m_mem_pool.emplace(item);
-            success = repairTree(m_root);
-            return (m_root != nullptr);
-        }
-
-        // Traverse the tree to find where to insert the new item
-        Node* current = m_root;
-        while(current != nullptr) {
-            // If the new item is less than the current node, go left
-            if (item < current->item) {
-                // If we've reached a leaf, insert the item
-                if (current->left == nullptr) {
-                    current->left = m_mem_pool.emplace(item);
-                    current->left->parent = current;
-                    current = current->left;
-                    success = repairTree(current);
-                    break;
-                } else {
-                    current = current->left;
-                }
-            // If the new item is greater than or equal to the current node, go right
-            } else {
-                // If we've reached a leaf, insert the item
-                if (current->right == nullptr) {
-                    current->right = m_mem_pool.emplace(item);
-                    current->right->parent = current;
-                    current = current->right;
-                    success = repairTree(current);
-                    break;
-                } else {
-                    current = current->right;
-                }
-            }
-        }
-
-        return success;
+        return insertItem(item);
     }
 
     /**
@@ -141,53 +224,72 @@ public:
      */
     bool insert(T&& item)
     {
-        bool success = false;
+        return insertItem(std::move(item));
+    }
 
-        // Trivial case of empty tree
-        if (m_root == nullptr) {
-            m_root = m_mem_pool.emplace(std::move(item));
-            success = repairTree(m_root);
-            return success;
-        }
+    /**
+     * @brief Insert a single item next to a hint.
+     *
+     * If the item belongs directly before or after the hinted item it is linked there without
+     * descending from the root, which makes inserting nearly sorted runs O(1) amortized. Otherwise
+     * the item is inserted normally.
+     *
+     * @pre  *hint* must be `nullptr` or point to an item currently stored in this tree, such as
+     *       the result of search() or of a previous hinted insert.
+     *
+     * @param[in]  hint
+     *             An item close to where the new item belongs. May be `nullptr`.
+     * @param[in]  item
+     *             The item to copy or move into the tree.
+     * @return A pointer to the inserted item, which can be used as the next hint, or `nullptr` if
+     *         the tree was full.
+     */
+    T* insert(const T* hint, const T& item)
+    {
+        return insertItemHint(hint, item);
+    }
 
-        // Traverse the tree to find where to insert the new item
-        Node* current = m_root;
-        while(current != nullptr) {
-            // If the new item is less than the current item, go left
-            if (item < current->item) {
-                // If we've reached a leaf, insert the item
-                if (current->left == nullptr) {
-                    current->left = m_mem_pool.emplace(std::move(item));
-                    current->left->parent = current;
-                    current = current->left;
-                    success = repairTree(current);
-                    break;
-                } else {
-                    current = current->left;
-                }
-            // If the new item is greater than or equal to the current item, go right
-            } else {
-                // If we've reached a leaf, insert the item
-                if (current->right == nullptr) {
-                    current->right = m_mem_pool.emplace(std::move(item));
-                    current->right->parent = current;
-                    current = current->right;
-                    success = repairTree(current);
-                    break;
-                } else {
-                    current = current->right;
-                }
-            }
+    /**
+     * @brief Insert a single item next to a hint, via moving.
+     * @overload
+     */
+    T* insert(const T* hint, T&& item)
+    {
+        return insertItemHint(hint, std::move(item));
+    }
+
+    /**
+     * @brief Construct an item in place.
+     *
+     * The item is constructed directly inside its node and then linked into the tree, so large
+     * records are never copied.
+     *
+     * @param[in]  args
+     *             The arguments forwarded to the *T* constructor.
+     * @return A boolean:
+     *         - `true`:  The item was constructed in the tree.
+     *         - `false`: The tree was full.
+     */
+    template <typename ... Args>
+    bool emplace(Args&&... args)
+    {
+        Node* node = m_pool->emplace(std::forward<Args>(args)...);
+        if (node == nullptr) {
+            return false;
         }
 
-        return success;
+        Node* p_parent = nullptr;
+        bool go_left = false;
+        findLeaf(KeyOf()(node->item), p_parent, go_left);
+
+        return linkNode(node, p_parent, go_left);
     }
 
     /**
      * @brief Search for the given key in the tree.
      *
      * Searches the tree for the matching key. Key must be Comparable to the items stored in the
-     * tree. If no match is found `nullptr` is returned.
+     * tree using *Compare*. If no match is found `nullptr` is returned.
      *
      * @note If there are multiple matches in the tree the first found is returned. This depends on
      *       the order in which items are added to the tree.
@@ -203,39 +305,8 @@ public:
     template <typename K>
     T* search(const K& key)
     {
-        // Trivial case of empty tree
-        if (m_root == nullptr) {
-            return nullptr;
-        }
-
-        // Traverse the tree trying to find a match with key
-        T* presult = nullptr;
-        Node* current = m_root;
-        while(current != nullptr) {
-            // If the key is equal to the current item, return a pointer to that item
-            if (key == current->item) {
-                presult = &(current->item);
-                break;
-            // If the key is less than the current item, go left
-            } else if (key < current->item) {
-                if (current->left == nullptr) {
-                    // We're at a leaf, no match was found
-                    break;
-                } else {
-                    current = current->left;
-                }
-            // If the key is greater than the current item, go right
-            } else {
-                if (current->right == nullptr) {
-                    // We're at a leaf, no match was found
-                    break;
-                } else {
-                    current = current->right;
-                }
-            }
-        }
-
-        return presult;
+        Node* node = findNode(key);
+        return (node != nullptr) ? &(node->item) : nullptr;
     }
 
     /**
@@ -249,49 +320,201 @@ public:
     template <typename K>
     const T* search(const K& key) const
     {
-        // Trivial case of empty tree
+        const Node* node = findNode(key);
+        return (node != nullptr) ? &(node->item) : nullptr;
+    }
+
+    /**
+     * @brief Remove the given key from the tree.
+     *
+     * Searches the tree for the matching key and removes the item found. The item is destructed
+     * and its node returned to the pool. Pointers to other items in the tree remain valid.
+     *
+     * @note If there are multiple matches in the tree only the first found is removed.
+     *
+     * @tparam K
+     *         Key type. May be the same as the item type stored by the tree or may be any other
+     *         type that is Comparable to the item type.
+     * @param[in]  key
+     *             The key to remove from the tree.
+     * @return A boolean:
+     *         - `true`:  A matching item was removed.
+     *         - `false`: No match was found.
+     */
+    template <typename K>
+    bool erase(const K& key)
+    {
+        Node* node = findNode(key);
+        if (node == nullptr) {
+            return false;
+        }
+
+        eraseNode(node);
+        return true;
+    }
+
+    /**
+     * @brief Move every item not less than a key into another tree.
+     *
+     * The tree is cut along the search path of *key* and the pieces are rejoined into two trees,
+     * in O(log n). Nodes are relinked, no item is copied or moved, and pointers to items stay
+     * valid.
+     *
+     * @note The sizes of both trees are recounted, in O(n), on the next call to size(). Joining
+     *       the trees back together before then avoids the recount.
+     *
+     * @param[in]  key
+     *             The key to split at. Items equal to *key* move to *right*.
+     * @param[out] right
+     *             The tree which receives the items. Must be empty and share this tree's pool.
+     * @return A boolean:
+     *         - `true`:  The tree was split.
+     *         - `false`: *right* was not empty, or did not share this tree's pool.
+     */
+    template <typename K>
+    bool split(const K& key, PooledRbTree& right)
+    {
+        if ((&right == this) || (right.m_pool != m_pool) || (right.m_root != nullptr)) {
+            return false;
+        }
+
+        Node* left_root = nullptr;
+        Node* right_root = nullptr;
+        size_t left_height = 0;
+        size_t right_height = 0;
+        splitSubtree(m_root, blackHeight(m_root), key,
+                     left_root, left_height, right_root, right_height);
+
+        setRoot(left_root);
+        right.setRoot(right_root);
+        m_size_known = false;
+        right.m_size_known = false;
+
+        return true;
+    }
+
+    /**
+     * @brief Move every item of another tree into this one.
+     *
+     * The ranges of the two trees must not overlap: every item of *other* must sort at or after
+     * every item of this tree, or at or before it. The trees are joined in O(log n). Nodes are
+     * relinked, no item is copied or moved, and pointers to items stay valid.
+     *
+     * @param[in]  other
+     *             The tree to take the items of. Must share this tree's pool. Left empty.
+     * @return A boolean:
+     *         - `true`:  The trees were joined.
+     *         - `false`: The ranges overlap, or *other* did not share this tree's pool.
+     */
+    bool join(PooledRbTree& other)
+    {
+        if ((&other == this) || (other.m_pool != m_pool)) {
+            return false;
+        }
+
+        if (other.m_root == nullptr) {
+            return true;
+        }
+
         if (m_root == nullptr) {
-            return nullptr;
+            std::swap(m_root, other.m_root);
+            std::swap(m_min, other.m_min);
+            std::swap(m_max, other.m_max);
+            std::swap(m_size, other.m_size);
+            std::swap(m_size_known, other.m_size_known);
+            return true;
         }
 
-        // Traverse the tree trying to find a match with key
-        T* presult = nullptr;
-        Node* current = m_root;
-        while(current != nullptr) {
-            // If the key is equal to the current item, return a pointer to that item
-            if (key == current->item) {
-                presult = &(current->item);
-                break;
-            // If the key is less than the current item, go left
-            } else if (key < current->item) {
-                if (current->left == nullptr) {
-                    // We're at a leaf, no match was found
-                    break;
-                } else {
-                    current = current->left;
-                }
-            // If the key is greater than the current item, go right
-            } else {
-                if (current->right == nullptr) {
-                    // We're at a leaf, no match was found
-                    break;
-                } else {
-                    current = current->right;
-                }
-            }
+        // Only the extreme items need to be compared to check the ranges are disjoint
+        const bool append = (compareKey(KeyOf()(m_max->item), other.m_min) <= 0);
+        if (!append && (compareKey(KeyOf()(other.m_max->item), m_min) > 0)) {
+            return false;
+        }
+
+        // Sizes are only summed if both are known, a recount is O(n)
+        const bool size_known = m_size_known && other.m_size_known;
+        const size_t num_items = m_size + other.m_size;
+
+        // The extreme item of the other tree nearest to this one joins the two trees
+        Node* middle = append ? other.m_min : other.m_max;
+        other.unlinkNode(middle);
+        Node* other_root = other.m_root;
+        other.setRoot(nullptr);
+        other.m_size = 0;
+        other.m_size_known = true;
+
+        size_t height = 0;
+        if (append) {
+            setRoot(joinSubtrees(m_root, blackHeight(m_root), middle,
+                                 other_root, blackHeight(other_root), height));
+        } else {
+            setRoot(joinSubtrees(other_root, blackHeight(other_root), middle,
+                                 m_root, blackHeight(m_root), height));
         }
+        m_size = num_items;
+        m_size_known = size_known;
 
-        return presult;
+        return true;
     }
 
-private:
+    /**
+     * @brief Get the current number of items in the tree.
+     *
+     * @return The current number of items in the tree.
+     */
+    size_t size() const
+    {
+        if (!m_size_known) {
+            m_size = countNodes(m_root);
+            m_size_known = true;
+        }
+
+        return m_size;
+    }
+
+    /**
+     * @brief Get the pool which stores the nodes of the tree.
+     *
+     * @return A reference to the node pool, which may be shared with other trees.
+     */
+    Pool& pool()
+    {
+        return *m_pool;
+    }
+
+    /**
+     * @brief Call a function for every item in the tree, in order.
+     *
+     * @param[in]  fn
+     *             The function to call. Must have a signature similar to `void fn(const T& item)`.
+     */
+    template <typename F>
+    void forEach(F fn) const
+    {
+        for (Node* node = m_min; node != nullptr; node = successor(node)) {
+            fn(static_cast<const T&>(node->item));
+        }
+    }
+
+    /**
+     * @brief Get the maximum number of items that can be stored by the tree.
+     *
+     * @return The maximum number of items that can be stored by the tree.
+     */
+    size_t capacity() const
+    {
+        return NumNodes;
+    }
+
+protected:
     /**
      * @brief The node object which makes up the tree.
      *
-     * Stores left, right, and parent pointers as well as the color and the actual item. Provides
-     * both copy and move constructors for the item.
+     * Stores left, right, and parent pointers as well as the color and the actual item. The item
+     * is constructed in place from any arguments accepted by *T*. The node derives from the tree's augmentation
+     * so an empty augmentation takes no space.
      */
-    struct Node
+    struct Node : public Augment
     {
         /**
          * @brief The red/black color each node may be painted.
@@ -303,29 +526,24 @@ private:
         };
 
         /**
-         * @brief Constructor which copies the item into the node.
+         * @brief Constructor which constructs the item in place.
          *
-         * @param[in]  i
-         *             The item to store.
-         */
-        explicit Node(const T& i) : item(i) {};
-
-        /**
-         * @brief Constructor which moves the item into the node.
+         * Copying or moving an existing item into the node is the single argument case.
          *
-         * @param[in]  i
-         *             The item to store.
+         * @param[in]  args
+         *             The arguments forwarded to the *T* constructor.
          */
-        explicit Node(T&& i) : item(std::move(i)) {};
+        template <typename ... Args>
+        explicit Node(Args&&... args) : item(std::forward<Args>(args)...) {};
 
         /// The item stored by this node.
         T item;
         /// The parent node in the tree.
         Node* parent = nullptr;
         /// The left child node in the tree.
-        Node* left = nullptr;
+        Link<Node> left = nullptr;
         /// The right child node in the tree.
-        Node* right = nullptr;
+        Link<Node> right = nullptr;
         /// The color that this node is painted.
         Color color = Color::kRed;
     };
@@ -435,6 +653,10 @@ private:
                 p_parent->right = left;
             }
         }
+
+        // The node is now the child of its previous left, so update it first
+        updateAugment(node);
+        updateAugment(left);
     }
 
     /**
@@ -482,33 +704,847 @@ private:
                 p_parent->left = right;
             }
         }
+
+        // The node is now the child of its previous right, so update it first
+        updateAugment(node);
+        updateAugment(right);
     }
 
     /**
-     * @brief Repair the tree according to red-black tree rules.
+     * @brief Insert an item by copying or moving it into a new node.
      *
-     * This function must be called each time a node is inserted or deleted. It re-paints and
-     * rotates the tree to ensure it adheres to red-black tree rules.
+     * Descends the tree once, calling the comparison predicate once per level, then allocates the
+     * new node at the leaf position found. Items equal to an existing item are placed to its right.
      *
-     * @see https://en.wikipedia.org/wiki/Red%E2%80%93black_tree
+     * @param[in]  item
+     *             The item to copy or move into the tree.
+     * @return A boolean:
+     *         - `true`:  The item was successfully inserted into the tree.
+     *         - `false`: The tree was full.
+     */
+    template <typename U>
+    bool insertItem(U&& item)
+    {
+        return (insertNode(std::forward<U>(item)) != nullptr);
+    }
+
+    /**
+     * @brief Find the leaf position where a new item with the given key belongs.
      *
+     * Keys which sort at or after the largest item, or before the smallest item, are placed
+     * directly next to the cached extreme node so monotonic inserts skip the descent. Otherwise the
+     * tree is descended once, calling the comparison predicate once per level.
+     *
+     * @param[in]  key
+     *             The key of the new item.
+     * @param[out] p_parent
+     *             The node to attach the new item to, or `nullptr` if the tree is empty.
+     * @param[out] go_left
+     *             Whether the new item becomes the left (`true`) or right (`false`) child.
+     */
+    template <typename K>
+    void findLeaf(const K& key, Node*& p_parent, bool& go_left) const
+    {
+        p_parent = nullptr;
+        go_left = false;
+
+        if (m_root == nullptr) {
+            // Empty tree, the new node becomes the root
+        } else if (compareKey(key, m_max) >= 0) {
+            // Append after the largest item
+            p_parent = m_max;
+        } else if (compareKey(key, m_min) < 0) {
+            // Prepend before the smallest item
+            p_parent = m_min;
+            go_left = true;
+        } else {
+            // Traverse the tree to find where to insert the new item
+            Node* current = m_root;
+            while (current != nullptr) {
+                p_parent = current;
+                // Go left if the new item is less than the current item, otherwise go right
+                go_left = (compareKey(key, current) < 0);
+                current = go_left ? current->left : current->right;
+            }
+        }
+    }
+
+    /**
+     * @brief Compare a key against the key of a node's item.
+     *
+     * @param[in]  key
+     *             The key on the left side of the comparison.
      * @param[in]  node
-     *             A pointer to the node to start the repair at.
-     * @return A boolean:
-     *         - `true`:  Repair succeeded. The tree adheres to red-black tree rules.
-     *         - `false`: The starting node was invalid.
+     *             The node whose item key is on the right side. Must not be `nullptr`.
+     * @return The result of the three-way comparison predicate.
      */
-    bool repairTree(Node* node)
+    template <typename K>
+    int compareKey(const K& key, const Node* node) const
     {
-        // Handle a nullptr
+        return m_compare(key, KeyOf()(node->item));
+    }
+
+    /**
+     * @brief Insert an item, returning the new node.
+     *
+     * @param[in]  item
+     *             The item to copy or move into the tree.
+     * @return A pointer to the new node, or `nullptr` if the tree was full.
+     */
+    template <typename U>
+    Node* insertNode(U&& item)
+    {
+        Node* p_parent = nullptr;
+        bool go_left = false;
+        findLeaf(KeyOf()(item), p_parent, go_left);
+
+        Node* node = m_pool->emplace(std::forward<U>(item));
         if (node == nullptr) {
-            return false;
+            return nullptr;
+        }
+
+        linkNode(node, p_parent, go_left);
+        return node;
+    }
+
+    /**
+     * @brief Insert an item next to a hint node if it belongs there.
+     *
+     * @param[in]  hint
+     *             An item stored in the tree, or `nullptr`.
+     * @param[in]  item
+     *             The item to copy or move into the tree.
+     * @return A pointer to the inserted item, or `nullptr` if the tree was full.
+     */
+    template <typename U>
+    T* insertItemHint(const T* hint, U&& item)
+    {
+        Node* hint_node = (hint != nullptr) ? m_pool->containing(hint) : nullptr;
+        Node* p_parent = nullptr;
+        bool go_left = false;
+
+        if (hint_node != nullptr) {
+            const auto& key = KeyOf()(item);
+            if (compareKey(key, hint_node) >= 0) {
+                // The item belongs after the hint, check that it also belongs before the next item
+                Node* next = successor(hint_node);
+                if ((next == nullptr) || (compareKey(key, next) < 0)) {
+                    if (hint_node->right == nullptr) {
+                        p_parent = hint_node;
+                    } else {
+                        // The successor is the left-most node of the right subtree
+                        p_parent = next;
+                        go_left = true;
+                    }
+                }
+            } else {
+                // The item belongs before the hint, check that it also belongs after the previous
+                Node* prev = predecessor(hint_node);
+                if ((prev == nullptr) || (compareKey(key, prev) >= 0)) {
+                    if (hint_node->left == nullptr) {
+                        p_parent = hint_node;
+                        go_left = true;
+                    } else {
+                        // The predecessor is the right-most node of the left subtree
+                        p_parent = prev;
+                    }
+                }
+            }
+        }
+
+        Node* node = nullptr;
+        if (p_parent == nullptr) {
+            // No usable hint
+            node = insertNode(std::forward<U>(item));
+        } else {
+            node = m_pool->emplace(std::forward<U>(item));
+            if (node != nullptr) {
+                linkNode(node, p_parent, go_left);
+            }
+        }
+
+        return (node != nullptr) ? &(node->item) : nullptr;
+    }
+
+    /**
+     * @brief Find the node matching a key, or construct a new node if there is no match.
+     *
+     * Descends the tree once. If no item matches *key* a new item is constructed in place from
+     * *args* at the leaf position found, so nothing is constructed when the key already exists.
+     *
+     * @pre  The item constructed from *args* must compare equal to *key*.
+     *
+     * @param[in]  key
+     *             The key to search for.
+     * @param[out] inserted
+     *             Set to `true` if a new node was constructed, otherwise `false`.
+     * @param[in]  args
+     *             The arguments forwarded to the *T* constructor if there is no match.
+     * @return A pointer to the matching or newly constructed node, or `nullptr` if there was no
+     *         match and the tree was full.
+     */
+    template <typename K, typename ... Args>
+    Node* findOrEmplace(const K& key, bool& inserted, Args&&... args)
+    {
+        inserted = false;
+
+        Node* p_parent = nullptr;
+        bool go_left = false;
+        Node* current = m_root;
+        while (current != nullptr) {
+            const int result = compareKey(key, current);
+            if (result == 0) {
+                return current;
+            }
+            p_parent = current;
+            go_left = (result < 0);
+            current = go_left ? current->left : current->right;
+        }
+
+        Node* node = m_pool->emplace(std::forward<Args>(args)...);
+        if (node == nullptr) {
+            return nullptr;
+        }
+
+        inserted = linkNode(node, p_parent, go_left);
+        return node;
+    }
+
+    /**
+     * @brief Link a newly allocated node into the tree and rebalance.
+     *
+     * @param[in]  node
+     *             The new node.
+     * @param[in]  p_parent
+     *             The leaf to attach the node to, or `nullptr` if the tree is empty.
+     * @param[in]  go_left
+     *             Whether the node becomes the left (`true`) or right (`false`) child.
+     * @return A boolean:
+     *         - `true`:  The node was linked and the tree repaired.
+     *         - `false`: The node was invalid.
+     */
+    bool linkNode(Node* node, Node* p_parent, bool go_left)
+    {
+        node->parent = p_parent;
+        if (p_parent == nullptr) {
+            m_root = node;
+            m_min = node;
+            m_max = node;
+        } else if (go_left) {
+            p_parent->left = node;
+            if (p_parent == m_min) {
+                m_min = node;
+            }
+        } else {
+            p_parent->right = node;
+            if (p_parent == m_max) {
+                m_max = node;
+            }
+        }
+
+        m_size++;
+
+        updateAugmentPath(node);
+        return repairTree(node);
+    }
+
+    /**
+     * @brief Find the node matching the given key.
+     *
+     * @param[in]  key
+     *             The key to search for.
+     * @return A pointer to the first matching node found, or `nullptr` if there is no match.
+     */
+    template <typename K>
+    Node* findNode(const K& key) const
+    {
+        Node* current = m_root;
+        while (current != nullptr) {
+            const int result = compareKey(key, current);
+            if (result == 0) {
+                break;
+            }
+            current = (result < 0) ? current->left : current->right;
+        }
+
+        return current;
+    }
+
+    /**
+     * @brief Recompute the augmentation of a single node from its children.
+     *
+     * @param[in]  node
+     *             The node to update. May be `nullptr`.
+     */
+    static void updateAugment(Node* node)
+    {
+        if (Augment::kEnabled && (node != nullptr)) {
+            node->Augment::update(node->item,
+                                  static_cast<const Augment*>(node->left),
+                                  static_cast<const Augment*>(node->right));
+        }
+    }
+
+    /**
+     * @brief Recompute the augmentation of a node and all of its ancestors.
+     *
+     * @param[in]  node
+     *             The first node to update. May be `nullptr`.
+     */
+    static void updateAugmentPath(Node* node)
+    {
+        if (Augment::kEnabled) {
+            while (node != nullptr) {
+                updateAugment(node);
+                node = node->parent;
+            }
+        }
+    }
+
+    /**
+     * @brief Check if a node is black. Leaves (`nullptr`) are black.
+     *
+     * @param[in]  node
+     *             The node to check. May be `nullptr`.
+     * @return `true` if the node is black or `nullptr`, otherwise `false`.
+     */
+    static bool isBlack(const Node* node)
+    {
+        return (node == nullptr) || (node->color == Node::Color::kBlack);
+    }
+
+    /**
+     * @brief Get the left-most (smallest) node of a subtree.
+     *
+     * @param[in]  node
+     *             The root of the subtree. Must not be `nullptr`.
+     * @return A pointer to the left-most node of the subtree.
+     */
+    static Node* minimum(Node* node)
+    {
+        while (node->left != nullptr) {
+            node = node->left;
+        }
+
+        return node;
+    }
+
+    /**
+     * @brief Get the right-most (largest) node of a subtree.
+     *
+     * @param[in]  node
+     *             The root of the subtree. Must not be `nullptr`.
+     * @return A pointer to the right-most node of the subtree.
+     */
+    static Node* maximum(Node* node)
+    {
+        while (node->right != nullptr) {
+            node = node->right;
+        }
+
+        return node;
+    }
+
+    /**
+     * @brief Get the next node in order.
+     *
+     * @param[in]  node
+     *             The node to start from. Must not be `nullptr`.
+     * @return A pointer to the next node in order, or `nullptr` if *node* is the largest.
+     */
+    static Node* successor(Node* node)
+    {
+        if (node->right != nullptr) {
+            return minimum(node->right);
+        }
+
+        // Walk up until we arrive from a left child
+        Node* p_parent = node->parent;
+        while ((p_parent != nullptr) && (node == p_parent->right)) {
+            node = p_parent;
+            p_parent = p_parent->parent;
+        }
+
+        return p_parent;
+    }
+
+    /**
+     * @brief Get the previous node in order.
+     *
+     * @param[in]  node
+     *             The node to start from. Must not be `nullptr`.
+     * @return A pointer to the previous node in order, or `nullptr` if *node* is the smallest.
+     */
+    static Node* predecessor(Node* node)
+    {
+        if (node->left != nullptr) {
+            return maximum(node->left);
+        }
+
+        // Walk up until we arrive from a right child
+        Node* p_parent = node->parent;
+        while ((p_parent != nullptr) && (node == p_parent->left)) {
+            node = p_parent;
+            p_parent = p_parent->parent;
+        }
+
+        return p_parent;
+    }
+
+    /**
+     * @brief Replace the subtree rooted at one node with the subtree rooted at another.
+     *
+     * @param[in]  old_node
+     *             The root of the subtree being replaced. Must not be `nullptr`.
+     * @param[in]  new_node
+     *             The root of the replacement subtree. May be `nullptr`.
+     */
+    void transplant(Node* old_node, Node* new_node)
+    {
+        if (old_node->parent == nullptr) {
+            m_root = new_node;
+        } else if (old_node == old_node->parent->left) {
+            old_node->parent->left = new_node;
+        } else {
+            old_node->parent->right = new_node;
+        }
+
+        if (new_node != nullptr) {
+            new_node->parent = old_node->parent;
+        }
+    }
+
+    /**
+     * @brief Follow the root upward after a rotation may have replaced it.
+     */
+    void updateRoot()
+    {
+        while (m_root->parent != nullptr) {
+            m_root = m_root->parent;
+        }
+    }
+
+    /**
+     * @brief Unlink a node from the tree, rebalance, and return it to the pool.
+     *
+     * @param[in]  node
+     *             The node to remove. Must be a node of this tree.
+     */
+    void eraseNode(Node* node)
+    {
+        unlinkNode(node);
+        m_pool->deallocate(node);
+    }
+
+    /**
+     * @brief Unlink a node from the tree and rebalance, keeping the node allocated.
+     *
+     * Nodes are relinked rather than having their items swapped, so no item is copied and pointers
+     * to the remaining items stay valid.
+     *
+     * @see https://en.wikipedia.org/wiki/Red%E2%80%93black_tree#Removal
+     *
+     * @param[in]  node
+     *             The node to unlink. Must be a node of this tree.
+     */
+    void unlinkNode(Node* node)
+    {
+        // The extreme nodes have at most one child, so their neighbours are cheap to find
+        if (node == m_min) {
+            m_min = successor(node);
+        }
+        if (node == m_max) {
+            m_max = predecessor(node);
+        }
+
+        // The child which takes the place of the removed node, and that child's new parent
+        Node* child = nullptr;
+        Node* child_parent = nullptr;
+        typename Node::Color removed_color = node->color;
+
+        if (node->left == nullptr) {
+            child = node->right;
+            child_parent = node->parent;
+            transplant(node, node->right);
+        } else if (node->right == nullptr) {
+            child = node->left;
+            child_parent = node->parent;
+            transplant(node, node->left);
+        } else {
+            // Two children, the in-order successor takes the place of the node
+            Node* successor = minimum(node->right);
+            removed_color = successor->color;
+            child = successor->right;
+            if (successor->parent == node) {
+                child_parent = successor;
+            } else {
+                child_parent = successor->parent;
+                transplant(successor, successor->right);
+                successor->right = node->right;
+                successor->right->parent = successor;
+            }
+            transplant(node, successor);
+            successor->left = node->left;
+            successor->left->parent = successor;
+            successor->color = node->color;
+        }
+
+        updateAugmentPath(child_parent);
+
+        if (removed_color == Node::Color::kBlack) {
+            repairErase(child, child_parent);
+        }
+
+        if (m_size_known) {
+            m_size--;
+        }
+    }
+
+    /**
+     * @brief Get the black height of a subtree, the number of black nodes on any path to a leaf.
+     *
+     * @param[in]  node
+     *             The root of the subtree. May be `nullptr`.
+     * @return The black height of the subtree, `0` for an empty subtree.
+     */
+    static size_t blackHeight(const Node* node)
+    {
+        size_t height = 0;
+        while (node != nullptr) {
+            if (isBlack(node)) {
+                height++;
+            }
+            node = node->left;
+        }
+
+        return height;
+    }
+
+    /**
+     * @brief Count the nodes of a subtree.
+     *
+     * @param[in]  node
+     *             The root of the subtree. May be `nullptr`.
+     * @return The number of nodes in the subtree.
+     */
+    static size_t countNodes(const Node* node)
+    {
+        size_t num_nodes = 0;
+        while (node != nullptr) {
+            // Count the left subtree recursively and walk down the right spine
+            num_nodes += 1 + countNodes(node->left);
+            node = node->right;
+        }
+
+        return num_nodes;
+    }
+
+    /**
+     * @brief Make a subtree a standalone tree: detach it from its parent and paint its root black.
+     *
+     * @param[in]  node
+     *             The root of the subtree. May be `nullptr`.
+     * @param[in,out] height
+     *             The black height of the subtree, updated if the root was repainted.
+     * @return The root of the standalone tree.
+     */
+    static Node* detachSubtree(Node* node, size_t& height)
+    {
+        if (node != nullptr) {
+            node->parent = nullptr;
+            if (!isBlack(node)) {
+                node->color = Node::Color::kBlack;
+                height++;
+            }
+        }
+
+        return node;
+    }
+
+    /**
+     * @brief Join two standalone trees and a middle node into one tree.
+     *
+     * The middle node is linked into the taller tree at the first black node down its inner spine
+     * whose black height matches the shorter tree, then the tree is repaired as for an insert. This
+     * takes O(1 + |left_height - right_height|).
+     *
+     * @see https://en.wikipedia.org/wiki/Red%E2%80%93black_tree#Set_operations_and_bulk_operations
+     *
+     * @pre  Every item of *left* sorts at or before *middle*, which sorts at or before every item
+     *       of *right*. Both roots are black and have no parent.
+     *
+     * @param[in]  left
+     *             The root of the lower tree. May be `nullptr`.
+     * @param[in]  left_height
+     *             The black height of *left*.
+     * @param[in]  middle
+     *             The node joining the trees. Must not be `nullptr`.
+     * @param[in]  right
+     *             The root of the upper tree. May be `nullptr`.
+     * @param[in]  right_height
+     *             The black height of *right*.
+     * @param[out] height
+     *             The black height of the joined tree.
+     * @return The root of the joined tree, which has no parent.
+     */
+    Node* joinSubtrees(Node* left, size_t left_height, Node* middle,
+                       Node* right, size_t right_height, size_t& height)
+    {
+        middle->parent = nullptr;
+        middle->color = Node::Color::kRed;
+
+        if (left_height == right_height) {
+            // Equal heights, the middle node becomes a black root
+            middle->left = left;
+            middle->right = right;
+            if (left != nullptr) {
+                left->parent = middle;
+            }
+            if (right != nullptr) {
+                right->parent = middle;
+            }
+            middle->color = Node::Color::kBlack;
+            updateAugment(middle);
+            height = left_height + 1;
+            return middle;
+        }
+
+        const bool left_taller = (left_height > right_height);
+        Node* current = left_taller ? left : right;
+        size_t current_height = left_taller ? left_height : right_height;
+        const size_t target_height = left_taller ? right_height : left_height;
+        Node* p_parent = nullptr;
+
+        // Walk the right spine of the taller left tree (or the left spine of a taller right tree)
+        while (!isBlack(current) || (current_height != target_height)) {
+            if (isBlack(current)) {
+                current_height--;
+            }
+            p_parent = current;
+            current = left_taller ? current->right : current->left;
+        }
+
+        // The middle node takes the place of the matching subtree, with the shorter tree beside it
+        Node* shorter = left_taller ? right : left;
+        middle->left = left_taller ? current : shorter;
+        middle->right = left_taller ? shorter : current;
+        if (middle->left != nullptr) {
+            middle->left->parent = middle;
+        }
+        if (middle->right != nullptr) {
+            middle->right->parent = middle;
+        }
+        middle->parent = p_parent;
+        if (left_taller) {
+            p_parent->right = middle;
+        } else {
+            p_parent->left = middle;
+        }
+
+        m_root = left_taller ? left : right;
+        updateAugmentPath(middle);
+
+        bool grew = false;
+        repairTree(middle, grew);
+        height = util::max(left_height, right_height) + (grew ? 1U : 0U);
+
+        Node* root = m_root;
+        m_root = nullptr;
+        return root;
+    }
+
+    /**
+     * @brief Split a subtree into a tree of the items less than a key and a tree of the rest.
+     *
+     * Recurses down the search path of *key*. On the way back up every node on the path is joined
+     * with the subtree it did not descend into. The black heights of the joined trees grow along
+     * the path, so all of the joins together take O(log n).
+     *
+     * @param[in]  node
+     *             The root of the subtree to split. May be `nullptr`. Its root may be red.
+     * @param[in]  node_height
+     *             The black height of *node*.
+     * @param[in]  key
+     *             The key to split at.
+     * @param[out] left
+     *             The root of the tree of items less than *key*.
+     * @param[out] left_height
+     *             The black height of *left*.
+     * @param[out] right
+     *             The root of the tree of items not less than *key*.
+     * @param[out] right_height
+     *             The black height of *right*.
+     */
+    template <typename K>
+    void splitSubtree(Node* node, size_t node_height, const K& key,
+                      Node*& left, size_t& left_height, Node*& right, size_t& right_height)
+    {
+        if (node == nullptr) {
+            left = nullptr;
+            right = nullptr;
+            left_height = 0;
+            right_height = 0;
+            return;
+        }
+
+        const size_t child_height = node_height - (isBlack(node) ? 1U : 0U);
+        size_t left_child_height = child_height;
+        size_t right_child_height = child_height;
+        Node* left_child = detachSubtree(node->left, left_child_height);
+        Node* right_child = detachSubtree(node->right, right_child_height);
+
+        if (compareKey(key, node) <= 0) {
+            // The node and its right subtree belong to the right tree
+            Node* lower_right = nullptr;
+            size_t lower_right_height = 0;
+            splitSubtree(left_child, left_child_height, key,
+                         left, left_height, lower_right, lower_right_height);
+            right = joinSubtrees(lower_right, lower_right_height, node,
+                                 right_child, right_child_height, right_height);
+        } else {
+            // The node and its left subtree belong to the left tree
+            Node* upper_left = nullptr;
+            size_t upper_left_height = 0;
+            splitSubtree(right_child, right_child_height, key,
+                         upper_left, upper_left_height, right, right_height);
+            left = joinSubtrees(left_child, left_child_height, node,
+                                upper_left, upper_left_height, left_height);
+        }
+    }
+
+    /**
+     * @brief Replace the whole tree with a standalone tree, updating the cached extreme nodes.
+     *
+     * @param[in]  root
+     *             The root of the new tree. May be `nullptr`.
+     */
+    void setRoot(Node* root)
+    {
+        m_root = root;
+        m_min = (root != nullptr) ? minimum(root) : nullptr;
+        m_max = (root != nullptr) ? maximum(root) : nullptr;
+    }
+
+    /**
+     * @brief Repair the tree according to red-black tree rules after removing a black node.
+     *
+     * @param[in]  node
+     *             The node which took the place of the removed node. May be `nullptr`.
+     * @param[in]  node_parent
+     *             The parent of *node*. Needed because *node* may be `nullptr`.
+     */
+    void repairErase(Node* node, Node* node_parent)
+    {
+        while ((node != m_root) && isBlack(node)) {
+            if (node == node_parent->left) {
+                Node* sibling = node_parent->right;
+                if (!isBlack(sibling)) {
+                    sibling->color = Node::Color::kBlack;
+                    node_parent->color = Node::Color::kRed;
+                    rotateLeft(node_parent);
+                    updateRoot();
+                    sibling = node_parent->right;
+                }
+
+                if (isBlack(sibling->left) && isBlack(sibling->right)) {
+                    sibling->color = Node::Color::kRed;
+                    node = node_parent;
+                    node_parent = node->parent;
+                } else {
+                    if (isBlack(sibling->right)) {
+                        sibling->left->color = Node::Color::kBlack;
+                        sibling->color = Node::Color::kRed;
+                        rotateRight(sibling);
+                        sibling = node_parent->right;
+                    }
+                    sibling->color = node_parent->color;
+                    node_parent->color = Node::Color::kBlack;
+                    sibling->right->color = Node::Color::kBlack;
+                    rotateLeft(node_parent);
+                    updateRoot();
+                    node = m_root;
+                }
+            } else {
+                Node* sibling = node_parent->left;
+                if (!isBlack(sibling)) {
+                    sibling->color = Node::Color::kBlack;
+                    node_parent->color = Node::Color::kRed;
+                    rotateRight(node_parent);
+                    updateRoot();
+                    sibling = node_parent->left;
+                }
+
+                if (isBlack(sibling->left) && isBlack(sibling->right)) {
+                    sibling->color = Node::Color::kRed;
+                    node = node_parent;
+                    node_parent = node->parent;
+                } else {
+                    if (isBlack(sibling->left)) {
+                        sibling->right->color = Node::Color::kBlack;
+                        sibling->color = Node::Color::kRed;
+                        rotateLeft(sibling);
+                        sibling = node_parent->left;
+                    }
+                    sibling->color = node_parent->color;
+                    node_parent->color = Node::Color::kBlack;
+                    sibling->left->color = Node::Color::kBlack;
+                    rotateRight(node_parent);
+                    updateRoot();
+                    node = m_root;
+                }
+            }
+        }
+
+        if (node != nullptr) {
+            node->color = Node::Color::kBlack;
+        }
+    }
+
+    /**
+     * @brief Repair the tree according to red-black tree rules.
+     *
+     * This function must be called each time a node is inserted or deleted. It re-paints and
+     * rotates the tree to ensure it adheres to red-black tree rules.
+     *
+     * @see https://en.wikipedia.org/wiki/Red%E2%80%93black_tree
+     *
+     * @param[in]  node
+     *             A pointer to the node to start the repair at.
+     * @return A boolean:
+     *         - `true`:  Repair succeeded. The tree adheres to red-black tree rules.
+     *         - `false`: The starting node was invalid.
+     */
+    bool repairTree(Node* node)
+    {
+        bool grew = false;
+        return repairTree(node, grew);
+    }
+
+    /**
+     * @brief Repair the tree, reporting whether its black height grew.
+     * @overload
+     *
+     * @param[in]  node
+     *             A pointer to the node to start the repair at.
+     * @param[out] grew
+     *             Set to `true` if a red root was repainted black, which adds one to the black
+     *             height of the whole tree.
+     * @return See repairTree(Node*).
+     */
+    bool repairTree(Node* node, bool& grew)
+    {
+        grew = false;
+
+        // Handle a nullptr
+        if (node == nullptr) {
+            return false;
         }
 
         Node* current = node;
         while (current != nullptr) {
             if (parent(current) == nullptr) {
                 // Case of root node
+                grew = (current->color == Node::Color::kRed);
                 current->color = Node::Color::kBlack;
                 break;
 
@@ -533,9 +1569,9 @@ private:
                     // Do nothing
                 }
 
-                Node* old_parent = parent(current);
+                Node* old_parent = current->parent;
                 Node* old_grandparent = grandparent(current);
-                if (current == parent(current)->left) {
+                if (current == old_parent->left) {
                     rotateRight(grandparent(current));
                 } else {
                     rotateLeft(grandparent(current));
@@ -547,19 +1583,73 @@ private:
             }
         }
 
-        // Update root node
-        while(parent(current) != nullptr) {
-            current = parent(current);
-        }
-        m_root = current;
+        // A rotation at the root makes the old root a child of the new root
+        updateRoot();
 
         return true;
     }
 
     /// A pointer to the root node of the tree.
-    Node* m_root = nullptr;
-    /// The memory pool used to store all the nodes in the tree.
-    TypedMemPool<Node, NumNodes> m_mem_pool;
+    Link<Node> m_root = nullptr;
+    /// A pointer to the smallest (left-most) node of the tree.
+    Node* m_min = nullptr;
+    /// A pointer to the largest (right-most) node of the tree.
+    Node* m_max = nullptr;
+    /// The memory pool used to store all the nodes in the tree, possibly shared with other trees.
+    Pool* m_pool;
+    /// The predicate used to order items in the tree.
+    Compare m_compare {};
+    /// The number of items in the tree, valid only if m_size_known is set.
+    mutable size_t m_size = 0;
+    /// Whether m_size is valid. Cleared by split(), which cannot count the items it moves.
+    mutable bool m_size_known = true;
+};
+
+/**
+ * @brief A Red-Black Tree which owns its node pool.
+ *
+ * Other trees may share the pool through pool(), allowing items to be split off into them and
+ * joined back without copying. See PooledRbTree for the full interface.
+ *
+ * @tparam NumNodes
+ *         Maximum number of nodes that may be stored in the tree.
+ * @tparam T
+ *         The type stored in each node. See PooledRbTree.
+ * @tparam Compare
+ *         The three-way predicate used to order keys. See PooledRbTree.
+ * @tparam KeyOf
+ *         The functor which extracts the key of an item. See PooledRbTree.
+ * @tparam Augment
+ *         The per-subtree summary stored in every node. See PooledRbTree.
+ * @tparam Link
+ *         The type of the root and child links. See PooledRbTree.
+ */
+template <size_t NumNodes,
+          typename T,
+          typename Compare = util::ThreeWayCompare,
+          typename KeyOf = util::Identity,
+          typename Augment = NoAugmentation,
+          template <typename> class Link = PlainLink>
+class RbTree : public PooledRbTree<NumNodes, T, Compare, KeyOf, Augment, Link>
+{
+protected:
+    using Base = PooledRbTree<NumNodes, T, Compare, KeyOf, Augment, Link>;
+
+public:
+    /// Default constructor.
+    RbTree() : Base(m_mem_pool) {}
+
+    /**
+     * @brief Constructor which sets the comparison predicate.
+     *
+     * @param[in]  compare
+     *             The predicate used to order items in the tree.
+     */
+    explicit RbTree(const Compare& compare) : Base(m_mem_pool, compare) {}
+
+private:
+    /// The memory pool owned by this tree. Only its address is used until it is constructed.
+    typename Base::Pool m_mem_pool;
 };
 
 } // namespace junk
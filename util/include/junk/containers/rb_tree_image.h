@@ -0,0 +1,262 @@
+/**
+ * @file   rb_tree_image.h
+ * @brief  This file contains the definition of the RbTreeImage flat tree snapshot.
+ * @author Liam Bucci <liam.bucci@gmail.com>
+ * @date   2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#ifndef RB_TREE_IMAGE_H
+#define RB_TREE_IMAGE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "junk/util/util.h"
+
+namespace junk {
+
+/**
+ * @brief The header at the start of every RbTreeImage.
+ *
+ * All fields have a fixed width. Images use the byte order of the machine that wrote them, a
+ * mismatched byte order is caught by the magic number.
+ */
+struct RbTreeImageHeader
+{
+    /// Identifies an RbTreeImage, always RbTreeImageHeader::kMagic.
+    uint32_t magic;
+    /// The layout version of the image, always RbTreeImageHeader::kVersion.
+    uint16_t version;
+    /// The size in bytes of this header.
+    uint16_t header_size;
+    /// The size in bytes of one item.
+    uint32_t item_size;
+    /// The alignment in bytes of one item.
+    uint32_t item_align;
+    /// The offset in bytes from the start of the image to the first item.
+    uint32_t items_offset;
+    /// The number of items in the image.
+    uint32_t count;
+
+    /// The magic number, "JRBT".
+    static constexpr uint32_t kMagic = 0x5442524AU;
+    /// The current layout version.
+    static constexpr uint16_t kVersion = 1U;
+};
+
+/**
+ * @brief A read-only, pointer-free snapshot of an RbTree which is searched in place.
+ *
+ * write() stores the header followed by the items of a tree in order, as a flat array. The image
+ * holds no pointers, so it can be written to a file and later mapped (with `mmap`) or copied to any
+ * suitably aligned address and opened without deserializing: open() only validates the header. A
+ * search is a binary search over the items which calls the tree's three-way predicate once per
+ * step, the same number of comparisons as a search of a balanced tree.
+ *
+ * @tparam T
+ *         The type of the items. Must be trivially copyable, items are stored as raw bytes.
+ * @tparam Compare
+ *         The three-way predicate used to order keys. Must order items the same way as the tree
+ *         the image was written from. See RbTree.
+ * @tparam KeyOf
+ *         The functor which extracts the key of an item. See RbTree.
+ */
+template <typename T, typename Compare = util::ThreeWayCompare, typename KeyOf = util::Identity>
+class RbTreeImage
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "RbTreeImage stores items as raw bytes, T must be trivially copyable");
+
+public:
+    /// Default constructor. The image is empty until open() succeeds.
+    RbTreeImage() = default;
+
+    /**
+     * @brief Constructor which sets the comparison predicate.
+     *
+     * @param[in]  compare
+     *             The predicate used to order items.
+     */
+    explicit RbTreeImage(const Compare& compare) : m_compare(compare) {}
+
+    /**
+     * @brief Get the number of bytes needed for an image of the given number of items.
+     *
+     * @param[in]  count
+     *             The number of items.
+     * @return The size of the image in bytes.
+     */
+    static constexpr size_t imageSize(size_t count)
+    {
+        return itemsOffset() + (count * sizeof(T));
+    }
+
+    /**
+     * @brief Write an image of a tree to a buffer.
+     *
+     * @pre  *buffer* must be aligned to at least `alignof(T)`, so the image can be opened in place.
+     *
+     * @tparam Tree
+     *         The type of the tree, any RbTree storing *T* with the same order as this image.
+     * @param[in]  tree
+     *             The tree to write.
+     * @param[out] buffer
+     *             The buffer to write the image to.
+     * @param[in]  buffer_size
+     *             The size of *buffer* in bytes.
+     * @return The number of bytes written, or `0` if *buffer* was `nullptr` or too small.
+     */
+    template <typename Tree>
+    static size_t write(const Tree& tree, void* buffer, size_t buffer_size)
+    {
+        const size_t count = tree.size();
+        const size_t size = imageSize(count);
+        if ((buffer == nullptr) || (buffer_size < size)) {
+            return 0;
+        }
+
+        RbTreeImageHeader header;
+        header.magic = RbTreeImageHeader::kMagic;
+        header.version = RbTreeImageHeader::kVersion;
+        header.header_size = static_cast<uint16_t>(sizeof(RbTreeImageHeader));
+        header.item_size = static_cast<uint32_t>(sizeof(T));
+        header.item_align = static_cast<uint32_t>(alignof(T));
+        header.items_offset = static_cast<uint32_t>(itemsOffset());
+        header.count = static_cast<uint32_t>(count);
+
+        uint8_t* bytes = static_cast<uint8_t*>(buffer);
+        std::memset(bytes, 0, itemsOffset());
+        std::memcpy(bytes, &header, sizeof(header));
+
+        uint8_t* item_bytes = bytes + itemsOffset();
+        tree.forEach([&item_bytes](const T& item) {
+            std::memcpy(item_bytes, &item, sizeof(T));
+            item_bytes += sizeof(T);
+        });
+
+        return size;
+    }
+
+    /**
+     * @brief Open an image in place. Nothing is copied, the image must outlive this object.
+     *
+     * @param[in]  image
+     *             The start of the image, such as the address returned by `mmap`.
+     * @param[in]  image_size
+     *             The number of bytes available at *image*.
+     * @return A boolean:
+     *         - `true`:  The image was valid and is now open.
+     *         - `false`: The image was invalid, truncated, misaligned, or written for a different
+     *                    item type. The image is left closed.
+     */
+    bool open(const void* image, size_t image_size)
+    {
+        m_items = nullptr;
+        m_count = 0;
+
+        // The items start after the header and its alignment padding, both must be present
+        if ((image == nullptr) || (image_size < itemsOffset())) {
+            return false;
+        }
+
+        RbTreeImageHeader header;
+        std::memcpy(&header, image, sizeof(header));
+        if ((header.magic != RbTreeImageHeader::kMagic) ||
+            (header.version != RbTreeImageHeader::kVersion) ||
+            (header.header_size != sizeof(RbTreeImageHeader)) ||
+            (header.item_size != sizeof(T)) ||
+            (header.item_align != alignof(T)) ||
+            (header.items_offset != itemsOffset())) {
+            return false;
+        }
+
+        // Checked by division so a corrupt count cannot overflow
+        if (((image_size - itemsOffset()) / sizeof(T)) < header.count) {
+            return false;
+        }
+
+        const uint8_t* items = static_cast<const uint8_t*>(image) + itemsOffset();
+        if ((reinterpret_cast<uintptr_t>(items) % alignof(T)) != 0) {
+            return false;
+        }
+
+        m_items = reinterpret_cast<const T*>(items);
+        m_count = header.count;
+        return true;
+    }
+
+    /**
+     * @brief Search the image for the given key.
+     *
+     * @tparam K
+     *         Key type. May be the key type of *T* or any other type Comparable to it using
+     *         *Compare*.
+     * @param[in]  key
+     *             The key to search for.
+     * @return A pointer to a matching item inside the image, or `nullptr` if there is no match.
+     */
+    template <typename K>
+    const T* search(const K& key) const
+    {
+        size_t low = 0;
+        size_t high = m_count;
+        while (low < high) {
+            const size_t middle = low + ((high - low) / 2U);
+            const int result = m_compare(key, KeyOf()(m_items[middle]));
+            if (result == 0) {
+                return &m_items[middle];
+            } else if (result < 0) {
+                high = middle;
+            } else {
+                low = middle + 1U;
+            }
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * @brief Get the items of the image, in order.
+     *
+     * @return A pointer to the first item, or `nullptr` if no image is open.
+     */
+    const T* items() const
+    {
+        return m_items;
+    }
+
+    /**
+     * @brief Get the number of items in the image.
+     *
+     * @return The number of items, `0` if no image is open.
+     */
+    size_t size() const
+    {
+        return m_count;
+    }
+
+private:
+    /**
+     * @brief Get the offset of the first item, the header size rounded up to the item alignment.
+     *
+     * @return The offset in bytes.
+     */
+    static constexpr size_t itemsOffset()
+    {
+        return ((sizeof(RbTreeImageHeader) + alignof(T) - 1U) / alignof(T)) * alignof(T);
+    }
+
+    /// The items of the open image, or `nullptr`.
+    const T* m_items = nullptr;
+    /// The number of items in the open image.
+    size_t m_count = 0;
+    /// The predicate used to order items.
+    Compare m_compare {};
+};
+
+} // namespace junk
+
+#endif // RB_TREE_IMAGE_H
@@ -0,0 +1,239 @@
+/**
+ * @file   sliding_window.h
+ * @brief  This file contains the definition of the SlidingWindow container.
+ * @author Liam Bucci <liam.bucci@gmail.com>
+ * @date   2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#ifndef SLIDING_WINDOW_H
+#define SLIDING_WINDOW_H
+
+#include <cstddef>
+
+#include "junk/containers/deque.h"
+#include "junk/containers/queue.h"
+#include "junk/containers/span.h"
+#include "junk/util/junk_assert.h"
+#include "junk/util/util.h"
+
+namespace junk {
+
+/**
+ * @brief The last *S* samples of a stream, with their sum, minimum and maximum kept up to date.
+ *
+ * The samples are kept in an overwriting Queue, so a new sample drops the oldest once the window
+ * is full. The sum is adjusted by the sample added and the sample dropped. The minimum and the
+ * maximum are each kept by a monotonic Deque of the samples which could still become the extreme:
+ * a new sample pops every sample it beats off the back, and the front is popped when it leaves the
+ * window. So every aggregate is O(1) per sample (amortized for the minimum and maximum), instead
+ * of O(S) for a scan of the window.
+ *
+ * @note A floating point sum collects rounding errors as samples are added and removed, call
+ *       clear() now and then or use an integer *Acc* for long runs.
+ *
+ * @tparam T
+ *         The type of the samples. Must be copyable.
+ * @tparam S
+ *         The number of samples in a full window.
+ * @tparam Acc
+ *         The type the sum is kept in, wide enough for *S* samples. Defaults to *T*.
+ * @tparam Compare
+ *         The three-way predicate used to order samples for min() and max(). See
+ *         util::ThreeWayCompare.
+ */
+template <class T, size_t S, class Acc = T, typename Compare = util::ThreeWayCompare>
+class SlidingWindow
+{
+public:
+    /**
+     * @brief Constructor for SlidingWindow container.
+     *
+     * @param[in]  compare
+     *             The predicate used to order samples.
+     */
+    explicit SlidingWindow(const Compare& compare = Compare()) : m_compare(compare) {}
+
+    /**
+     * @brief Add a sample to the window, dropping the oldest sample if the window is full.
+     *
+     * @param[in]  sample
+     *             The sample to add.
+     */
+    void push(const T& sample)
+    {
+        if (m_samples.isFull()) {
+            const T& oldest = m_samples.at(0);
+            m_sum -= static_cast<Acc>(oldest);
+            if (m_compare(m_min.front(), oldest) == 0) {
+                m_min.popFront();
+            }
+            if (m_compare(m_max.front(), oldest) == 0) {
+                m_max.popFront();
+            }
+        }
+
+        // Equal samples are kept, so each one leaves the front when its own sample does
+        while (!m_min.isEmpty() && (m_compare(m_min.back(), sample) > 0)) {
+            m_min.popBack();
+        }
+        m_min.pushBack(sample);
+        while (!m_max.isEmpty() && (m_compare(m_max.back(), sample) < 0)) {
+            m_max.popBack();
+        }
+        m_max.pushBack(sample);
+
+        m_sum += static_cast<Acc>(sample);
+        m_samples.enqueue(sample);
+    }
+
+    /**
+     * @brief Get the sum of the samples in the window.
+     *
+     * @return The sum of the samples, or a value initialized *Acc* if the window is empty.
+     */
+    Acc sum() const
+    {
+        return m_sum;
+    }
+
+    /**
+     * @brief Get the smallest sample in the window.
+     *
+     * @pre  The window must not be empty.
+     *
+     * @return A reference to the sample which sorts first.
+     */
+    const T& min() const
+    {
+        JUNK_ASSERT(!isEmpty());
+        return m_min.front();
+    }
+
+    /**
+     * @brief Get the largest sample in the window.
+     *
+     * @pre  The window must not be empty.
+     *
+     * @return A reference to the sample which sorts last.
+     */
+    const T& max() const
+    {
+        JUNK_ASSERT(!isEmpty());
+        return m_max.front();
+    }
+
+    /**
+     * @brief Get a sample by its index from the oldest sample.
+     *
+     * @pre  *i* must be strictly less than the size of the window.
+     *
+     * @param[in]  i
+     *             The index of the sample, `0` is the oldest sample.
+     * @return The sample at index *i*.
+     */
+    const T& at(const size_t i) const
+    {
+        return m_samples.at(i);
+    }
+
+    /**
+     * @brief Get a sample by its index from the newest sample.
+     *
+     * @pre  *i* must be strictly less than the size of the window.
+     *
+     * @param[in]  i
+     *             The index of the sample, `0` is the newest sample.
+     * @return The sample at index *i* from the newest.
+     */
+    const T& atBack(const size_t i) const
+    {
+        return m_samples.atBack(i);
+    }
+
+    /**
+     * @brief Get both contiguous segments of the samples in the window, oldest first.
+     *
+     * See Queue::segments().
+     *
+     * @param[out] first
+     *             The segment holding the oldest samples.
+     * @param[out] second
+     *             The segment holding the rest of the samples.
+     */
+    void segments(Span<const T>& first, Span<const T>& second) const
+    {
+        m_samples.segments(first, second);
+    }
+
+    /**
+     * @brief Remove all samples from the window.
+     */
+    void clear()
+    {
+        m_samples.release(m_samples.size());
+        m_min.clear();
+        m_max.clear();
+        m_sum = Acc();
+    }
+
+    /**
+     * @brief Check if the window is full.
+     *
+     * @return A boolean:
+     *         - `true`:  The window holds *S* samples, the next sample drops the oldest.
+     *         - `false`: The window is not full.
+     */
+    bool isFull() const
+    {
+        return m_samples.isFull();
+    }
+
+    /**
+     * @brief Check if the window is empty.
+     *
+     * @return A boolean:
+     *         - `true`:  The window is empty.
+     *         - `false`: The window is not empty.
+     */
+    bool isEmpty() const
+    {
+        return m_samples.isEmpty();
+    }
+
+    /**
+     * @brief Get the current number of samples in the window.
+     *
+     * @return The current number of samples in the window.
+     */
+    size_t size() const
+    {
+        return m_samples.size();
+    }
+
+    /**
+     * @brief Get the number of samples in a full window.
+     *
+     * @return The number of samples in a full window.
+     */
+    size_t capacity() const
+    {
+        return S;
+    }
+
+private:
+    /// The three-way predicate used to order samples.
+    Compare m_compare;
+    /// The sum of the samples in the window.
+    Acc m_sum {};
+    /// The samples in the window, oldest first.
+    Queue<T, S, QueueFullPolicy::kOverwrite> m_samples;
+    /// The candidates for the minimum, in increasing order from the front.
+    Deque<T, S> m_min;
+    /// The candidates for the maximum, in decreasing order from the front.
+    Deque<T, S> m_max;
+};
+
+} // namespace junk
+
+#endif // SLIDING_WINDOW_H
@@ -0,0 +1,343 @@
+/**
+ * @file   spsc_queue.h
+ * @brief  This file contains the definition of the SpscQueue container.
+ * @author Liam Bucci <liam.bucci@gmail.com>
+ * @date   2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#if !defined(__AVR__)
+#include <atomic>
+#endif
+
+#include "junk/util/util.h"
+
+namespace junk {
+
+/**
+ * @brief A lock-free FIFO circular buffer for exactly one producer and one consumer.
+ *
+ * Unlike Queue there is no shared size. The producer owns the write index and the consumer owns the
+ * read index, each side only reads the index of the other. A slot is published by storing the write
+ * index with release ordering after the item is constructed, and handed back by storing the read
+ * index with release ordering after the item is destructed. No critical section is needed, so an ISR
+ * can feed the main loop, or one thread can feed another.
+ *
+ * On host builds the two indices sit on separate cache lines, and each side keeps a private copy of
+ * the index of the other side which it only refreshes when the queue looks full (or empty). While
+ * the queue is neither, the producer and consumer do not touch each other's cache lines at all.
+ *
+ * On AVR the indices are single bytes, which the core loads and stores atomically, and ordering
+ * only has to hold against an ISR on the same core, so a compiler barrier is enough. *S* must be
+ * less than 255 there.
+ *
+ * @warning Only one context may call the producer functions (enqueue(), emplace()) and only one
+ *          context may call the consumer functions (dequeue(), peek()). isEmpty(), isFull() and
+ *          size() may be called from either side, the answer may be stale by the time it is used.
+ *
+ * @tparam T
+ *         The type stored by this container. Must be copyable or movable.
+ * @tparam S
+ *         The maximum number of items that may be stored in this container.
+ */
+template <class T, size_t S>
+class SpscQueue
+{
+#if defined(__AVR__)
+    static_assert(S < 255U, "SpscQueue indices are single bytes on AVR, S must be less than 255");
+    using Index = uint8_t;
+#else
+    using Index = size_t;
+#endif
+
+public:
+    SpscQueue() = default;
+
+    /**
+     * @brief Destructor for SpscQueue container.
+     *
+     * The destructor ensures all remaining internal items are destructed. Neither side may be
+     * running when the queue is destructed.
+     */
+    ~SpscQueue()
+    {
+        Index read = m_read_index.loadRelaxed();
+        const Index write = m_write_index.loadRelaxed();
+        while (read != write) {
+            slot(read)->~T();
+            read = nextIndex(read);
+        }
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    /**
+     * @brief Enqueue a given item. Producer only.
+     *
+     * @param[in]  item
+     *             The item to copy into the queue.
+     * @return A boolean:
+     *         - `true`:  The item was stored successfully in the queue.
+     *         - `false`: The queue was full.
+     */
+    bool enqueue(const T& item)
+    {
+        return emplace(item);
+    }
+
+    /**
+     * @brief Enqueue a given item. Producer only.
+     *
+     * @param[in]  item
+     *             The item to move into the queue.
+     * @return A boolean:
+     *         - `true`:  The item was moved successfully into the queue.
+     *         - `false`: The queue was full.
+     */
+    bool enqueue(T&& item)
+    {
+        return emplace(std::move(item));
+    }
+
+    /**
+     * @brief Emplace an item on the back of the queue. Producer only.
+     *
+     * @param[in]  args
+     *             The parameter pack of template arguments that will be forwarded to the type *T*
+     *             constructor.
+     * @return A boolean:
+     *         - `true`:  The item was emplaced on the back of the queue.
+     *         - `false`: The queue was full.
+     */
+    template <typename ... Args>
+    bool emplace(Args&&... args)
+    {
+        const Index write = m_write_index.loadRelaxed();
+        const Index next = nextIndex(write);
+
+        if (next == m_cached_read_index) {
+            // Looks full, see how far the consumer has got since we last checked
+            m_cached_read_index = m_read_index.loadAcquire();
+            if (next == m_cached_read_index) {
+                return false;
+            }
+        }
+
+        new (slot(write)) T(std::forward<Args>(args)...);
+        m_write_index.storeRelease(next);
+
+        return true;
+    }
+
+    /**
+     * @brief Retrieve the oldest item from the queue. Consumer only.
+     *
+     * The item is moved into *item* and then destructed in the queue.
+     *
+     * @param[out] item
+     *             The retrieved item.
+     * @return A boolean:
+     *         - `true`:  An item was successfully retrieved.
+     *         - `false`: The queue was empty.
+     */
+    bool dequeue(T& item)
+    {
+        const Index read = m_read_index.loadRelaxed();
+
+        if (read == m_cached_write_index) {
+            // Looks empty, see how far the producer has got since we last checked
+            m_cached_write_index = m_write_index.loadAcquire();
+            if (read == m_cached_write_index) {
+                return false;
+            }
+        }
+
+        T* front = slot(read);
+        item = std::move(*front);
+        front->~T();
+        m_read_index.storeRelease(nextIndex(read));
+
+        return true;
+    }
+
+    /**
+     * @brief Peek at the next item in the queue. Consumer only.
+     *
+     * Retrieve a copy of the next item in the queue without removing it from the queue.
+     *
+     * @param[out] item
+     *             The retrieved item.
+     * @return A boolean:
+     *         - `true`:  An item was successfully retrieved.
+     *         - `false`: The queue was empty.
+     */
+    bool peek(T& item) const
+    {
+        const Index read = m_read_index.loadRelaxed();
+        if (read == m_write_index.loadAcquire()) {
+            return false;
+        }
+
+        item = *slot(read);
+        return true;
+    }
+
+    /**
+     * @brief Check if the queue is full.
+     *
+     * @return A boolean:
+     *         - `true`:  The queue is full.
+     *         - `false`: The queue is not full.
+     */
+    bool isFull() const
+    {
+        return (nextIndex(m_write_index.loadAcquire()) == m_read_index.loadAcquire());
+    }
+
+    /**
+     * @brief Check if the queue is empty.
+     *
+     * @return A boolean:
+     *         - `true`:  The queue is empty.
+     *         - `false`: The queue is not empty.
+     */
+    bool isEmpty() const
+    {
+        return (m_write_index.loadAcquire() == m_read_index.loadAcquire());
+    }
+
+    /**
+     * @brief Get the current number of items in the queue.
+     *
+     * @return The current number of items in the queue.
+     */
+    size_t size() const
+    {
+        const size_t write = m_write_index.loadAcquire();
+        const size_t read = m_read_index.loadAcquire();
+        return (write >= read) ? (write - read) : (write + kNumSlots - read);
+    }
+
+    /**
+     * @brief Get the maximum number of items that can be stored by the queue.
+     *
+     * @return The maximum number of items that can be stored by the queue.
+     */
+    size_t capacity() const
+    {
+        return S;
+    }
+
+private:
+    /// One slot is always left empty, so a full queue can be told apart from an empty one.
+    static constexpr size_t kNumSlots = S + 1U;
+
+#if defined(__AVR__)
+    /**
+     * @brief An index shared with an ISR.
+     *
+     * A byte is loaded and stored in one instruction, and the ISR runs on the same core, so only
+     * the compiler has to be kept from moving memory accesses across a load or store.
+     */
+    class SharedIndex
+    {
+    public:
+        Index loadRelaxed() const
+        {
+            return m_value;
+        }
+
+        Index loadAcquire() const
+        {
+            const Index value = m_value;
+            __asm__ __volatile__("" ::: "memory");
+            return value;
+        }
+
+        void storeRelease(Index value)
+        {
+            __asm__ __volatile__("" ::: "memory");
+            m_value = value;
+        }
+
+    private:
+        volatile Index m_value = 0;
+    };
+#else
+    /**
+     * @brief An index shared with another thread.
+     */
+    class SharedIndex
+    {
+    public:
+        Index loadRelaxed() const
+        {
+            return m_value.load(std::memory_order_relaxed);
+        }
+
+        Index loadAcquire() const
+        {
+            return m_value.load(std::memory_order_acquire);
+        }
+
+        void storeRelease(Index value)
+        {
+            m_value.store(value, std::memory_order_release);
+        }
+
+    private:
+        std::atomic<Index> m_value {0};
+    };
+#endif
+
+    /**
+     * @brief A storage container which simulates the type *T*.
+     *
+     * Each StorageHelper instance has the same alignment and storage requirements as an object of
+     * type *T*.
+     */
+    struct alignas(T) StorageHelper {
+        uint8_t mem[sizeof(T)];
+    };
+
+    static Index nextIndex(Index index)
+    {
+        return (index + 1U >= kNumSlots) ? 0 : static_cast<Index>(index + 1U);
+    }
+
+    T* slot(Index index)
+    {
+        return reinterpret_cast<T*>(&m_storage[index]);
+    }
+
+    const T* slot(Index index) const
+    {
+        return reinterpret_cast<const T*>(&m_storage[index]);
+    }
+
+    /// The index of the next available write slot. Written by the producer.
+    alignas(util::kCacheLineSize) SharedIndex m_write_index;
+    /// The producer's copy of the read index, refreshed when the queue looks full.
+    Index m_cached_read_index = 0;
+
+    /// The index of the next item to read out. Written by the consumer.
+    alignas(util::kCacheLineSize) SharedIndex m_read_index;
+    /// The consumer's copy of the write index, refreshed when the queue looks empty.
+    Index m_cached_write_index = 0;
+
+    /// The actual storage for the queue.
+    alignas(util::kCacheLineSize) alignas(StorageHelper) StorageHelper m_storage[kNumSlots] {};
+};
+
+} // namespace junk
+
+#endif // SPSC_QUEUE_H
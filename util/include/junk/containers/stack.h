@@ -13,6 +13,9 @@
 #include <new>
 #include <utility>
 
+#include "junk/containers/optional.h"
+#include "junk/util/junk_assert.h"
+
 namespace junk {
 
 /**
@@ -45,7 +48,8 @@ public:
     /**
      * @brief Push the given item onto the stack (by copying).
      *
-     * Pushes the given item to the top of the stack. The type of *T* must be copyable.
+     * Pushes the given item to the top of the stack. The item is copy constructed in place, so the
+     * type of *T* must be copy constructible.
      *
      * @param[in]  item
      *             The item to store in the stack.
@@ -58,7 +62,7 @@ public:
         bool success = false;
 
         if (!isFull()) {
-            *reinterpret_cast<T*>(&m_storage[m_size]) = item;
+            new (reinterpret_cast<T*>(&m_storage[m_size])) T(item);
             m_size++;
             success = true;
         }
@@ -69,7 +73,8 @@ public:
     /**
      * @brief Push a given item onto the stack (by moving).
      *
-     * Push the given item to the top of the stack. The type of *T* must be movable.
+     * Push the given item to the top of the stack. The item is move constructed in place, so the
+     * type of *T* must be move constructible.
      *
      * @param[in]  item
      *             The item to store on the stack.
@@ -82,7 +87,7 @@ public:
         bool success = false;
 
         if (!isFull()) {
-            *reinterpret_cast<T*>(&m_storage[m_size]) = std::move(item);
+            new (reinterpret_cast<T*>(&m_storage[m_size])) T(std::move(item));
             m_size++;
             success = true;
         }
@@ -169,6 +174,56 @@ public:
         return success;
     };
 
+    /**
+     * @brief Retrieve the item from the top of the stack, if there is one.
+     *
+     * The item is moved straight into the returned Optional, so unlike pop(T&) the caller does not
+     * need a default constructed item to receive it.
+     *
+     * @return The top-most item, or an empty Optional if the stack was empty.
+     */
+    Optional<T> tryPop()
+    {
+        Optional<T> item;
+
+        if (!isEmpty()) {
+            m_size--;
+            T* top_item = reinterpret_cast<T*>(&m_storage[m_size]);
+            item.emplace(std::move(*top_item));
+            top_item->~T();
+        }
+
+        return item;
+    }
+
+    /**
+     * @brief Process the item on top of the stack in place, then remove it.
+     *
+     * *fn* is called with a reference to the item while it is still on the stack, so it may read
+     * it or move from it without a copy. The item is destructed once *fn* returns.
+     *
+     * @param[in]  fn
+     *             The function to call with the item, as `fn(T&)`.
+     * @return A boolean:
+     *         - `true`:  An item was processed and removed.
+     *         - `false`: The stack was empty, *fn* was not called.
+     */
+    template <typename F>
+    bool consume(F&& fn)
+    {
+        bool success = false;
+
+        if (!isEmpty()) {
+            T* top_item = reinterpret_cast<T*>(&m_storage[m_size - 1U]);
+            fn(*top_item);
+            top_item->~T();
+            m_size--;
+            success = true;
+        }
+
+        return success;
+    }
+
     /**
      * @brief Remove the top item from the stack.
      *
@@ -214,6 +269,34 @@ public:
         return success;
     };
 
+    /**
+     * @brief Get the item on top of the stack.
+     *
+     * Unlike peek() no copy is made, the item stays on the stack.
+     *
+     * @pre  The stack must not be empty.
+     *
+     * @return The top-most item.
+     */
+    T& top()
+    {
+        JUNK_ASSERT(!isEmpty());
+        return *reinterpret_cast<T*>(&m_storage[m_size - 1U]);
+    }
+
+    /**
+     * @brief Get the item on top of the const stack.
+     *
+     * @pre  The stack must not be empty.
+     *
+     * @return The top-most item.
+     */
+    const T& top() const
+    {
+        JUNK_ASSERT(!isEmpty());
+        return *reinterpret_cast<const T*>(&m_storage[m_size - 1U]);
+    }
+
     /**
      * @brief Check if the stack is full.
      *
@@ -125,6 +125,26 @@ protected:
                && ((((uintptr_t)mem - (uintptr_t)&m_buckets[0]) % BucketSize) == 0);
     }
 
+    /**
+     * @brief Get the bucket which contains the given address.
+     *
+     * @param[in]  mem
+     *             Any address within a bucket.
+     * @return A pointer to the first byte of the bucket containing *mem*, or `nullptr` if *mem*
+     *         is not within the pool.
+     */
+    void* bucketOf(const void* mem)
+    {
+        const uintptr_t first = (uintptr_t)&m_buckets[0];
+        const uintptr_t addr = (uintptr_t)mem;
+
+        if ((addr < first) || (addr >= (first + sizeof(m_buckets)))) {
+            return nullptr;
+        }
+
+        return &m_buckets[(addr - first) / sizeof(Bucket)];
+    }
+
 private:
     /// The internal helper object for creating buckets of the right size and alignment.
     struct alignas(BucketAlign) Bucket
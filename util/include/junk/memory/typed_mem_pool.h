@@ -65,6 +65,20 @@ public:
         return ptr;
     }
 
+    /**
+     * @brief Get the object whose storage contains the given address.
+     *
+     * Allows recovering an object from a pointer to one of its members.
+     *
+     * @param[in]  ptr
+     *             Any address within an object's storage.
+     * @return A pointer to the containing object, or `nullptr` if *ptr* is not within the pool.
+     */
+    T* containing(const void* ptr)
+    {
+        return static_cast<T*>(BaseMemPool::bucketOf(ptr));
+    }
+
     void deallocate(T* ptr)
     {
         if (BaseMemPool::isValid(static_cast<void*>(ptr))) {
@@ -43,6 +43,120 @@ constexpr const T& min(const T& a, const T& b)
     return (a < b) ? a : b;
 }
 
+/**
+ * @brief The size of a cache line, the unit of sharing between cores.
+ *
+ * Data written by different threads is aligned to this size so the cores do not steal the same line
+ * back and forth. AVR parts have no data cache, so nothing is padded there.
+ */
+#if defined(__AVR__)
+constexpr size_t kCacheLineSize = 1U;
+#else
+constexpr size_t kCacheLineSize = 64U;
+#endif
+
+/**
+ * @brief Check if a number is a power of two.
+ *
+ * @param[in]  n
+ *             The number to check.
+ * @return `true` if *n* is a power of two, otherwise `false`. Zero is not a power of two.
+ */
+constexpr bool isPow2(size_t n)
+{
+    return (n != 0U) && ((n & (n - 1U)) == 0U);
+}
+
+/**
+ * @brief Round a number up to a power of two.
+ *
+ * @param[in]  n
+ *             The number to round up.
+ * @param[in]  power
+ *             The power of two to start from. Defaults to `1`.
+ * @return The smallest power of two which is at least *n* and at least *power*.
+ */
+constexpr size_t roundUpPow2(size_t n, size_t power = 1U)
+{
+    return (power >= n) ? power : roundUpPow2(n, power * 2U);
+}
+
+/**
+ * @brief Default three-way comparison predicate.
+ *
+ * Orders two items using `operator <` and `operator ==`. The return value follows the same
+ * convention as the `Compare` predicate of binarySearch():
+ * - `0` if `a == b`
+ * - A negative number if `a < b`
+ * - A positive number if `a > b`.
+ *
+ * Types with an expensive comparison (strings, multi-field structs) should provide their own
+ * predicate which computes the ordering in a single pass.
+ */
+struct ThreeWayCompare
+{
+    template <typename A, typename B>
+    constexpr int operator()(const A& a, const B& b) const
+    {
+        return (a < b) ? -1 : ((a == b) ? 0 : 1);
+    }
+};
+
+/**
+ * @brief Default key extractor which uses the whole item as its key.
+ */
+struct Identity
+{
+    template <typename T>
+    constexpr const T& operator()(const T& item) const
+    {
+        return item;
+    }
+};
+
+/**
+ * @brief Default hash function for integer and enum keys.
+ *
+ * Mixes every bit of the key into every bit of the result (the MurmurHash3 finalizer), so keys
+ * which differ only in their high bits, or which are sequential, still spread across a table. The
+ * 64-bit finalizer is used where `size_t` is 64 bits wide, the 32-bit finalizer otherwise.
+ */
+struct Hash
+{
+    template <typename T>
+    size_t operator()(const T& key) const
+    {
+        return mix(static_cast<uint64_t>(key));
+    }
+
+    /**
+     * @brief Mix the bits of a value.
+     *
+     * @param[in]  x
+     *             The value to mix.
+     * @return The mixed value.
+     */
+    static size_t mix(uint64_t x)
+    {
+        if (sizeof(size_t) > sizeof(uint32_t)) {
+            x ^= x >> 33;
+            x *= 0xFF51AFD7ED558CCDULL;
+            x ^= x >> 33;
+            x *= 0xC4CEB9FE1A85EC53ULL;
+            x ^= x >> 33;
+            return static_cast<size_t>(x);
+        }
+
+        uint32_t h = static_cast<uint32_t>(x) ^ static_cast<uint32_t>(x >> 32);
+        h ^= h >> 16;
+        h *= 0x85EBCA6BUL;
+        h ^= h >> 13;
+        h *= 0xC2B2AE35UL;
+        h ^= h >> 16;
+        return static_cast<size_t>(h);
+    }
+};
+
 } // namespace util
 } // namespace junk
 
@@ -101,6 +101,10 @@ $$($(1)_BUILD_DIR)/%.o: $$(COMMON_TESTS_DIR)/%.c | $$($(1)_BUILD_DIR)
 $$($(1)_BUILD_DIR)/%.o: $$(COMMON_TESTS_DIR)/%.cpp | $$($(1)_BUILD_DIR)
 	$$(CXX) $$($(1)_CPPFLAGS) $$($(1)_INCLUDE_FLAGS) -MD -c $$< -o $$@
 
+# Common Benchmarks #
+$$($(1)_BUILD_DIR)/%.o: $$(COMMON_BENCH_DIR)/%.cpp | $$($(1)_BUILD_DIR)
+	$$(CXX) $$($(1)_CPPFLAGS) $$($(1)_INCLUDE_FLAGS) -MD -c $$< -o $$@
+
 # General Sources #
 $$($(1)_BUILD_DIR)/%.o: %.c | $$($(1)_BUILD_DIR)
 	$$(CC) $$($(1)_CFLAGS) $$($(1)_INCLUDE_FLAGS) -MD -c $$< -o $$@
@@ -44,6 +44,7 @@ void test_middle_odd();
 void test_middle_even_left();
 void test_middle_even_right();
 void test_fuzzy_search();
+void test_lower_bound();
 
 int main(int argc, char** argv)
 {
@@ -57,6 +58,7 @@ int main(int argc, char** argv)
     RUN_TEST(test_middle_even_left);
     RUN_TEST(test_middle_even_right);
     RUN_TEST(test_fuzzy_search);
+    RUN_TEST(test_lower_bound);
 
     return UNITY_END();
 }
@@ -259,3 +261,23 @@ void test_fuzzy_search()
         delete[] array;
     }
 }
+
+void test_lower_bound()
+{
+    int array[6] = {1, 3, 3, 5, 7, 9};
+
+    TEST_ASSERT_EQUAL_UINT32(0U, lowerBound(&array[0], 0, 5, &compare));
+    TEST_ASSERT_EQUAL_UINT32(0U, lowerBound(&array[0], 6, 0, &compare));
+    TEST_ASSERT_EQUAL_UINT32(0U, lowerBound(&array[0], 6, 1, &compare));
+    TEST_ASSERT_EQUAL_UINT32(1U, lowerBound(&array[0], 6, 2, &compare));
+    TEST_ASSERT_EQUAL_UINT32(1U, lowerBound(&array[0], 6, 3, &compare));
+    TEST_ASSERT_EQUAL_UINT32(3U, lowerBound(&array[0], 6, 4, &compare));
+    TEST_ASSERT_EQUAL_UINT32(5U, lowerBound(&array[0], 6, 9, &compare));
+    TEST_ASSERT_EQUAL_UINT32(6U, lowerBound(&array[0], 6, 10, &compare));
+
+    // The key may be a different type than the items
+    auto by_tens = [](long key, const int& item) {
+        return compare(static_cast<int>(key), item * 10);
+    };
+    TEST_ASSERT_EQUAL_UINT32(3U, lowerBound(&array[0], 6, 45L, by_tens));
+}
@@ -0,0 +1,228 @@
+/**
+ * @file      test_blocking_queue.cpp
+ * @brief     This file contains tests for BlockingQueue.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "unity.h"
+
+#include "junk/containers/blocking_queue.h"
+
+using namespace junk;
+
+void test_no_wait();
+void test_dequeue_timeout();
+void test_enqueue_timeout();
+void test_dequeue_wakes();
+void test_enqueue_wakes();
+void test_burst_wakes_all();
+void test_move_only_type();
+void test_threads();
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_no_wait);
+    RUN_TEST(test_dequeue_timeout);
+    RUN_TEST(test_enqueue_timeout);
+    RUN_TEST(test_dequeue_wakes);
+    RUN_TEST(test_enqueue_wakes);
+    RUN_TEST(test_burst_wakes_all);
+    RUN_TEST(test_move_only_type);
+    RUN_TEST(test_threads);
+
+    return UNITY_END();
+}
+
+using std::chrono::milliseconds;
+using std::chrono::steady_clock;
+
+void test_no_wait()
+{
+    BlockingQueue<uint32_t, 4> uut;
+
+    TEST_ASSERT_EQUAL_UINT32(4, uut.capacity());
+    TEST_ASSERT_TRUE(uut.isEmpty());
+
+    uint32_t item = 0;
+    TEST_ASSERT_FALSE(uut.dequeue(item));
+    for (uint32_t i = 0; i < 4; i++) {
+        TEST_ASSERT_TRUE(uut.enqueue(i));
+    }
+    TEST_ASSERT_TRUE(uut.isFull());
+    TEST_ASSERT_FALSE(uut.enqueue(4U));
+    TEST_ASSERT_EQUAL_UINT32(4, uut.size());
+
+    for (uint32_t i = 0; i < 4; i++) {
+        TEST_ASSERT_TRUE(uut.dequeue(item));
+        TEST_ASSERT_EQUAL_UINT32(i, item);
+    }
+    TEST_ASSERT_TRUE(uut.isEmpty());
+}
+
+void test_dequeue_timeout()
+{
+    BlockingQueue<uint32_t, 4> uut;
+
+    const auto start = steady_clock::now();
+    uint32_t item = 0;
+    TEST_ASSERT_FALSE(uut.dequeueWait(item, milliseconds(20)));
+    TEST_ASSERT_TRUE((steady_clock::now() - start) >= milliseconds(20));
+
+    // A zero timeout is a plain attempt
+    TEST_ASSERT_FALSE(uut.dequeueWait(item, milliseconds(0)));
+    uut.enqueue(7U);
+    TEST_ASSERT_TRUE(uut.dequeueWait(item, milliseconds(0)));
+    TEST_ASSERT_EQUAL_UINT32(7, item);
+}
+
+void test_enqueue_timeout()
+{
+    BlockingQueue<uint32_t, 2> uut;
+
+    TEST_ASSERT_TRUE(uut.enqueueWait(1U, milliseconds(20)));
+    TEST_ASSERT_TRUE(uut.enqueueWait(2U, milliseconds(20)));
+
+    const auto start = steady_clock::now();
+    TEST_ASSERT_FALSE(uut.enqueueWait(3U, milliseconds(20)));
+    TEST_ASSERT_TRUE((steady_clock::now() - start) >= milliseconds(20));
+    TEST_ASSERT_EQUAL_UINT32(2, uut.size());
+}
+
+void test_dequeue_wakes()
+{
+    BlockingQueue<uint32_t, 4> uut;
+
+    std::thread producer([&]() {
+        std::this_thread::sleep_for(milliseconds(20));
+        uut.enqueue(42U);
+    });
+
+    uint32_t item = 0;
+    TEST_ASSERT_TRUE(uut.dequeueWait(item, std::chrono::seconds(5)));
+    TEST_ASSERT_EQUAL_UINT32(42, item);
+    producer.join();
+}
+
+void test_enqueue_wakes()
+{
+    BlockingQueue<uint32_t, 1> uut;
+    uut.enqueue(1U);
+
+    std::thread consumer([&]() {
+        std::this_thread::sleep_for(milliseconds(20));
+        uint32_t item = 0;
+        uut.dequeue(item);
+    });
+
+    TEST_ASSERT_TRUE(uut.enqueueWait(2U, std::chrono::seconds(5)));
+    consumer.join();
+
+    uint32_t item = 0;
+    TEST_ASSERT_TRUE(uut.dequeue(item));
+    TEST_ASSERT_EQUAL_UINT32(2, item);
+}
+
+void test_burst_wakes_all()
+{
+    constexpr size_t kNumConsumers = 3U;
+
+    BlockingQueue<uint32_t, 8> uut;
+    std::atomic<uint32_t> received {0};
+    std::thread consumers[kNumConsumers];
+
+    for (size_t c = 0; c < kNumConsumers; c++) {
+        consumers[c] = std::thread([&]() {
+            uint32_t item = 0;
+            if (uut.dequeueWait(item, std::chrono::seconds(5))) {
+                received++;
+            }
+        });
+    }
+
+    // Let the consumers park, then only the first item sees an empty queue
+    std::this_thread::sleep_for(milliseconds(50));
+    for (uint32_t i = 0; i < kNumConsumers; i++) {
+        uut.enqueue(i);
+    }
+
+    for (size_t c = 0; c < kNumConsumers; c++) {
+        consumers[c].join();
+    }
+    TEST_ASSERT_EQUAL_UINT32(kNumConsumers, received.load());
+    TEST_ASSERT_TRUE(uut.isEmpty());
+}
+
+void test_move_only_type()
+{
+    BlockingQueue<std::unique_ptr<uint32_t>, 1> uut;
+
+    TEST_ASSERT_TRUE(uut.enqueueWait(std::unique_ptr<uint32_t>(new uint32_t(5U)), milliseconds(0)));
+
+    // A rejected item is left with the caller
+    std::unique_ptr<uint32_t> spare(new uint32_t(6U));
+    TEST_ASSERT_FALSE(uut.enqueueWait(std::move(spare), milliseconds(1)));
+    TEST_ASSERT_NOT_NULL(spare.get());
+
+    std::unique_ptr<uint32_t> item;
+    uut.dequeueWait(item);
+    TEST_ASSERT_EQUAL_UINT32(5, *item);
+}
+
+void test_threads()
+{
+    constexpr uint32_t kItemsPerProducer = 20000U;
+    constexpr size_t kNumProducers = 3U;
+    constexpr size_t kNumConsumers = 2U;
+    constexpr uint32_t kNumItems = kItemsPerProducer * kNumProducers;
+
+    static BlockingQueue<uint32_t, 16> uut;
+    std::atomic<uint64_t> sum {0};
+    std::atomic<uint32_t> received {0};
+    std::thread producers[kNumProducers];
+    std::thread consumers[kNumConsumers];
+
+    for (size_t c = 0; c < kNumConsumers; c++) {
+        consumers[c] = std::thread([&]() {
+            // Each consumer stops at a sentinel, one per consumer is sent at the end
+            for (;;) {
+                uint32_t item = 0;
+                uut.dequeueWait(item);
+                if (item == kNumItems) {
+                    break;
+                }
+                sum += item;
+                received++;
+            }
+        });
+    }
+
+    for (size_t p = 0; p < kNumProducers; p++) {
+        producers[p] = std::thread([&, p]() {
+            for (uint32_t i = 0; i < kItemsPerProducer; i++) {
+                uut.enqueueWait(static_cast<uint32_t>(p * kItemsPerProducer) + i);
+            }
+        });
+    }
+
+    for (size_t p = 0; p < kNumProducers; p++) {
+        producers[p].join();
+    }
+    for (size_t c = 0; c < kNumConsumers; c++) {
+        uut.enqueueWait(kNumItems);
+    }
+    for (size_t c = 0; c < kNumConsumers; c++) {
+        consumers[c].join();
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(kNumItems, received.load());
+    TEST_ASSERT_TRUE(sum.load() == (static_cast<uint64_t>(kNumItems) * (kNumItems - 1U) / 2U));
+}
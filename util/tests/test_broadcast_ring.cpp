@@ -0,0 +1,496 @@
+/**
+ * @file      test_broadcast_ring.cpp
+ * @brief     This file contains tests for BroadcastRing.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <atomic>
+#include <thread>
+
+#include "unity.h"
+#include "tracked.h"
+
+#define private public
+#include "junk/containers/broadcast_ring.h"
+#undef private
+
+using namespace junk;
+
+void test_subscribe();
+void test_fan_out();
+void test_gated();
+void test_no_consumers();
+void test_late_subscriber();
+void test_unsubscribe();
+void test_bulk();
+void test_peek_release();
+void test_lossy();
+void test_lossy_bulk();
+void test_lossy_mid_bulk();
+void test_destructs();
+void test_threads();
+void test_threads_lossy();
+void test_threads_lossy_torn();
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_subscribe);
+    RUN_TEST(test_fan_out);
+    RUN_TEST(test_gated);
+    RUN_TEST(test_no_consumers);
+    RUN_TEST(test_late_subscriber);
+    RUN_TEST(test_unsubscribe);
+    RUN_TEST(test_bulk);
+    RUN_TEST(test_peek_release);
+    RUN_TEST(test_lossy);
+    RUN_TEST(test_lossy_bulk);
+    RUN_TEST(test_lossy_mid_bulk);
+    RUN_TEST(test_destructs);
+    RUN_TEST(test_threads);
+    RUN_TEST(test_threads_lossy);
+    RUN_TEST(test_threads_lossy_torn);
+
+    return UNITY_END();
+}
+
+void test_subscribe()
+{
+    BroadcastRing<uint32_t, 8, 2> uut;
+
+    TEST_ASSERT_EQUAL_UINT32(8, uut.capacity());
+    TEST_ASSERT_FALSE(uut.isSubscribed(0));
+
+    const auto a = uut.subscribe();
+    const auto b = uut.subscribe();
+    TEST_ASSERT_TRUE(a != uut.kInvalidConsumer);
+    TEST_ASSERT_TRUE(b != uut.kInvalidConsumer);
+    TEST_ASSERT_TRUE(a != b);
+    TEST_ASSERT_TRUE(uut.subscribe() == uut.kInvalidConsumer);
+
+    TEST_ASSERT_TRUE(uut.unsubscribe(a));
+    TEST_ASSERT_FALSE(uut.isSubscribed(a));
+    TEST_ASSERT_FALSE(uut.unsubscribe(a));
+    TEST_ASSERT_EQUAL_UINT32(a, uut.subscribe());
+
+    uint32_t item = 0;
+    TEST_ASSERT_FALSE(uut.read(a, item));
+    TEST_ASSERT_FALSE(uut.read(uut.kInvalidConsumer, item));
+    TEST_ASSERT_EQUAL_UINT32(0, uut.available(a));
+}
+
+void test_fan_out()
+{
+    BroadcastRing<uint32_t, 8, 3> uut;
+    BroadcastRing<uint32_t, 8, 3>::ConsumerId ids[3];
+    for (size_t c = 0; c < 3; c++) {
+        ids[c] = uut.subscribe();
+    }
+
+    for (uint32_t i = 0; i < 5; i++) {
+        TEST_ASSERT_TRUE(uut.publish(i));
+    }
+
+    // Every consumer sees every item, in order
+    for (size_t c = 0; c < 3; c++) {
+        TEST_ASSERT_EQUAL_UINT32(5, uut.available(ids[c]));
+        for (uint32_t i = 0; i < 5; i++) {
+            uint32_t item = 99U;
+            TEST_ASSERT_TRUE(uut.read(ids[c], item));
+            TEST_ASSERT_EQUAL_UINT32(i, item);
+        }
+        uint32_t item = 0;
+        TEST_ASSERT_FALSE(uut.read(ids[c], item));
+    }
+}
+
+void test_gated()
+{
+    BroadcastRing<uint32_t, 4, 2> uut;
+    const auto fast = uut.subscribe();
+    const auto slow = uut.subscribe();
+
+    for (uint32_t i = 0; i < 4; i++) {
+        TEST_ASSERT_TRUE(uut.publish(i));
+        uint32_t item = 0;
+        TEST_ASSERT_TRUE(uut.read(fast, item));
+    }
+
+    // The slow consumer has not read anything, so the ring is full
+    TEST_ASSERT_FALSE(uut.publish(4U));
+    TEST_ASSERT_FALSE(uut.emplace(4U));
+
+    uint32_t item = 99U;
+    TEST_ASSERT_TRUE(uut.read(slow, item));
+    TEST_ASSERT_EQUAL_UINT32(0, item);
+    TEST_ASSERT_TRUE(uut.publish(4U));
+    TEST_ASSERT_FALSE(uut.publish(5U));
+
+    for (uint32_t i = 1; i < 5; i++) {
+        TEST_ASSERT_TRUE(uut.read(slow, item));
+        TEST_ASSERT_EQUAL_UINT32(i, item);
+    }
+    TEST_ASSERT_TRUE(uut.read(fast, item));
+    TEST_ASSERT_EQUAL_UINT32(4, item);
+    TEST_ASSERT_EQUAL_UINT32(0, uut.lost(slow));
+}
+
+void test_no_consumers()
+{
+    BroadcastRing<uint32_t, 4, 2> uut;
+
+    // Nobody is listening, so nothing holds the producer back
+    for (uint32_t i = 0; i < 20; i++) {
+        TEST_ASSERT_TRUE(uut.publish(i));
+    }
+}
+
+void test_late_subscriber()
+{
+    BroadcastRing<uint32_t, 8, 2> uut;
+    const auto early = uut.subscribe();
+
+    uut.publish(1U);
+    uut.publish(2U);
+    const auto late = uut.subscribe();
+    uut.publish(3U);
+
+    TEST_ASSERT_EQUAL_UINT32(3, uut.available(early));
+    TEST_ASSERT_EQUAL_UINT32(1, uut.available(late));
+
+    uint32_t item = 0;
+    TEST_ASSERT_TRUE(uut.read(late, item));
+    TEST_ASSERT_EQUAL_UINT32(3, item);
+}
+
+void test_unsubscribe()
+{
+    BroadcastRing<uint32_t, 4, 2> uut;
+    const auto reader = uut.subscribe();
+    const auto stalled = uut.subscribe();
+
+    for (uint32_t i = 0; i < 4; i++) {
+        uut.publish(i);
+        uint32_t item = 0;
+        uut.read(reader, item);
+    }
+    TEST_ASSERT_FALSE(uut.publish(4U));
+
+    // Dropping the stalled consumer lets the producer carry on
+    TEST_ASSERT_TRUE(uut.unsubscribe(stalled));
+    TEST_ASSERT_TRUE(uut.publish(4U));
+
+    uint32_t item = 0;
+    TEST_ASSERT_TRUE(uut.read(reader, item));
+    TEST_ASSERT_EQUAL_UINT32(4, item);
+}
+
+void test_bulk()
+{
+    BroadcastRing<uint8_t, 8, 2> uut;
+    const auto a = uut.subscribe();
+    const auto b = uut.subscribe();
+    const uint8_t in[6] = {1U, 2U, 3U, 4U, 5U, 6U};
+    uint8_t out[8] = {};
+
+    TEST_ASSERT_EQUAL_UINT32(6, uut.publishBulk(Span<const uint8_t>(in)));
+    TEST_ASSERT_EQUAL_UINT32(6, uut.readBulk(a, Span<uint8_t>(out)));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(in, out, 6);
+
+    // Only two slots are free while b has not read anything
+    TEST_ASSERT_EQUAL_UINT32(2, uut.publishBulk(Span<const uint8_t>(in)));
+    TEST_ASSERT_EQUAL_UINT32(4, uut.readBulk(b, Span<uint8_t>(out, 4)));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(in, out, 4);
+
+    // Wraps around the end of the eight slots
+    TEST_ASSERT_EQUAL_UINT32(4, uut.publishBulk(Span<const uint8_t>(in)));
+    TEST_ASSERT_EQUAL_UINT32(6, uut.readBulk(a, Span<uint8_t>(out)));
+    TEST_ASSERT_EQUAL_UINT8(1, out[0]);
+    TEST_ASSERT_EQUAL_UINT8(2, out[1]);
+    TEST_ASSERT_EQUAL_UINT8(1, out[2]);
+    TEST_ASSERT_EQUAL_UINT8(4, out[5]);
+    TEST_ASSERT_EQUAL_UINT32(8, uut.readBulk(b, Span<uint8_t>(out)));
+    TEST_ASSERT_EQUAL_UINT8(5, out[0]);
+    TEST_ASSERT_EQUAL_UINT8(4, out[7]);
+}
+
+void test_peek_release()
+{
+    BroadcastRing<uint8_t, 8, 1> uut;
+    const auto id = uut.subscribe();
+    const uint8_t in[6] = {1U, 2U, 3U, 4U, 5U, 6U};
+
+    TEST_ASSERT_EQUAL_UINT32(0, uut.peekContiguous(id).length());
+
+    uut.publishBulk(Span<const uint8_t>(in));
+    Span<const uint8_t> region = uut.peekContiguous(id);
+    TEST_ASSERT_EQUAL_UINT32(6, region.length());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(in, region.cget(), 6);
+
+    // The items keep gating the producer until they are released
+    TEST_ASSERT_EQUAL_UINT32(2, uut.publishBulk(Span<const uint8_t>(in)));
+    TEST_ASSERT_FALSE(uut.release(id, 9U));
+    TEST_ASSERT_TRUE(uut.release(id, 6U));
+
+    // The rest of the storage, then the start
+    TEST_ASSERT_EQUAL_UINT32(6, uut.publishBulk(Span<const uint8_t>(in)));
+    region = uut.peekContiguous(id);
+    TEST_ASSERT_EQUAL_UINT32(2, region.length());
+    TEST_ASSERT_EQUAL_UINT8(1, region[0]);
+    TEST_ASSERT_TRUE(uut.release(id, 2U));
+    region = uut.peekContiguous(id);
+    TEST_ASSERT_EQUAL_UINT32(6, region.length());
+    TEST_ASSERT_EQUAL_UINT8(4, region[3]);
+    TEST_ASSERT_TRUE(uut.release(id, 6U));
+    TEST_ASSERT_EQUAL_UINT32(0, uut.available(id));
+}
+
+void test_lossy()
+{
+    BroadcastRing<uint32_t, 4, 2, QueueFullPolicy::kOverwrite> uut;
+    const auto fast = uut.subscribe();
+    const auto slow = uut.subscribe();
+
+    for (uint32_t i = 0; i < 10; i++) {
+        TEST_ASSERT_TRUE(uut.publish(i));
+        uint32_t item = 99U;
+        TEST_ASSERT_TRUE(uut.read(fast, item));
+        TEST_ASSERT_EQUAL_UINT32(i, item);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, uut.lost(fast));
+
+    // The slow consumer only finds the last four items
+    TEST_ASSERT_EQUAL_UINT32(10, uut.available(slow));
+    for (uint32_t i = 6; i < 10; i++) {
+        uint32_t item = 99U;
+        TEST_ASSERT_TRUE(uut.read(slow, item));
+        TEST_ASSERT_EQUAL_UINT32(i, item);
+    }
+    uint32_t item = 0;
+    TEST_ASSERT_FALSE(uut.read(slow, item));
+    TEST_ASSERT_EQUAL_UINT32(6, uut.lost(slow));
+}
+
+void test_lossy_bulk()
+{
+    BroadcastRing<uint32_t, 4, 1, QueueFullPolicy::kOverwrite> uut;
+    const auto id = uut.subscribe();
+    const uint32_t in[6] = {1U, 2U, 3U, 4U, 5U, 6U};
+    uint32_t out[6] = {};
+
+    // More items than the ring holds, only the last four are kept
+    TEST_ASSERT_EQUAL_UINT32(6, uut.publishBulk(Span<const uint32_t>(in)));
+    TEST_ASSERT_EQUAL_UINT32(4, uut.readBulk(id, Span<uint32_t>(out)));
+    TEST_ASSERT_EQUAL_UINT32(3, out[0]);
+    TEST_ASSERT_EQUAL_UINT32(6, out[3]);
+    TEST_ASSERT_EQUAL_UINT32(2, uut.lost(id));
+
+    TEST_ASSERT_EQUAL_UINT32(6, uut.publishBulk(Span<const uint32_t>(in)));
+    TEST_ASSERT_EQUAL_UINT32(2, uut.readBulk(id, Span<uint32_t>(out, 2)));
+    TEST_ASSERT_EQUAL_UINT32(3, out[0]);
+    TEST_ASSERT_EQUAL_UINT32(4, out[1]);
+    TEST_ASSERT_EQUAL_UINT32(4, uut.lost(id));
+}
+
+void test_lossy_mid_bulk()
+{
+    BroadcastRing<uint32_t, 4, 1, QueueFullPolicy::kOverwrite> uut;
+    const auto id = uut.subscribe();
+    const uint32_t in[6] = {1U, 2U, 3U, 4U, 5U, 6U};
+    uint32_t out[4] = {};
+
+    TEST_ASSERT_EQUAL_UINT32(4, uut.publishBulk(Span<const uint32_t>(in, 4)));
+    TEST_ASSERT_EQUAL_UINT32(4, uut.readBulk(id, Span<uint32_t>(out)));
+    TEST_ASSERT_EQUAL_UINT32(2, uut.publishBulk(Span<const uint32_t>(in, 2)));
+
+    // The producer has announced a batch of six but not published it, so the two items read are
+    // discarded and the cursor skips ahead of the published sequence
+    uut.m_claimed.store(12U);
+    TEST_ASSERT_EQUAL_UINT32(0, uut.readBulk(id, Span<uint32_t>(out)));
+    TEST_ASSERT_EQUAL_UINT32(4, uut.lost(id));
+    TEST_ASSERT_EQUAL_UINT32(8, uut.m_consumers[id].cursor.load());
+
+    // A cursor ahead of the published sequence must not be moved back
+    TEST_ASSERT_EQUAL_UINT32(0, uut.readBulk(id, Span<uint32_t>(out)));
+    TEST_ASSERT_EQUAL_UINT32(4, uut.lost(id));
+    TEST_ASSERT_EQUAL_UINT32(8, uut.m_consumers[id].cursor.load());
+
+    // Once the batch is published the consumer carries on with its last four items
+    TEST_ASSERT_EQUAL_UINT32(6, uut.publishBulk(Span<const uint32_t>(in)));
+    TEST_ASSERT_EQUAL_UINT32(4, uut.readBulk(id, Span<uint32_t>(out)));
+    TEST_ASSERT_EQUAL_UINT32(3, out[0]);
+    TEST_ASSERT_EQUAL_UINT32(6, out[3]);
+    TEST_ASSERT_EQUAL_UINT32(4, uut.lost(id));
+}
+
+int32_t g_live = 0;
+
+void test_destructs()
+{
+    g_live = 0;
+    {
+        BroadcastRing<Tracked, 4, 1> uut;
+        const auto id = uut.subscribe();
+
+        uut.emplace(1U);
+        uut.publish(Tracked(2U));
+        TEST_ASSERT_EQUAL_INT32(2, g_live);
+
+        // Reading copies out, the items stay in the ring until their slots are reused
+        Tracked item;
+        TEST_ASSERT_TRUE(uut.read(id, item));
+        TEST_ASSERT_EQUAL_UINT32(1, item.value);
+        TEST_ASSERT_EQUAL_INT32(3, g_live);
+
+        for (uint32_t i = 3; i < 10; i++) {
+            TEST_ASSERT_TRUE(uut.emplace(i));
+            TEST_ASSERT_TRUE(uut.read(id, item));
+        }
+        TEST_ASSERT_EQUAL_INT32(5, g_live);
+
+        Tracked in[2] = {10U, 11U};
+        TEST_ASSERT_EQUAL_UINT32(2, uut.publishBulk(Span<const Tracked>(in)));
+        TEST_ASSERT_EQUAL_INT32(7, g_live);
+    }
+    TEST_ASSERT_EQUAL_INT32(0, g_live);
+}
+
+void test_threads()
+{
+    constexpr uint32_t kNumItems = 100000U;
+    constexpr size_t kNumConsumers = 3U;
+
+    static BroadcastRing<uint32_t, 64, kNumConsumers> uut;
+    std::atomic<uint32_t> failures {0};
+    std::thread consumers[kNumConsumers];
+
+    for (size_t c = 0; c < kNumConsumers; c++) {
+        const auto id = uut.subscribe();
+        consumers[c] = std::thread([&, id, c]() {
+            uint32_t expected = 0;
+            uint32_t batch[16];
+            while (expected < kNumItems) {
+                // Alternate between single reads and batches
+                const size_t count = (c == 0) ? uut.read(id, batch[0]) :
+                                                uut.readBulk(id, Span<uint32_t>(batch));
+                if (count == 0) {
+                    std::this_thread::yield();
+                }
+                for (size_t i = 0; i < count; i++) {
+                    if (batch[i] != expected) {
+                        failures++;
+                    }
+                    expected++;
+                }
+            }
+        });
+    }
+
+    for (uint32_t i = 0; i < kNumItems; i++) {
+        while (!uut.publish(i)) {
+            std::this_thread::yield();
+        }
+    }
+
+    for (size_t c = 0; c < kNumConsumers; c++) {
+        consumers[c].join();
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(0, failures.load());
+}
+
+void test_threads_lossy()
+{
+    constexpr uint32_t kNumItems = 100000U;
+
+    static BroadcastRing<uint32_t, 16, 1, QueueFullPolicy::kOverwrite> uut;
+    const auto id = uut.subscribe();
+    std::atomic<bool> done {false};
+    std::atomic<uint32_t> failures {0};
+    uint32_t received = 0;
+
+    std::thread consumer([&]() {
+        uint32_t last = 0;
+        bool first = true;
+        for (;;) {
+            const bool finished = done.load();
+            uint32_t item = 0;
+            if (uut.read(id, item)) {
+                // Items may be skipped, but never repeated or reordered
+                if (!first && (item <= last)) {
+                    failures++;
+                }
+                first = false;
+                last = item;
+                received++;
+            } else if (finished) {
+                break;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    for (uint32_t i = 0; i < kNumItems; i++) {
+        uut.publish(i);
+        if ((i % 64U) == 0) {
+            std::this_thread::yield();
+        }
+    }
+    done = true;
+    consumer.join();
+
+    TEST_ASSERT_EQUAL_UINT32(0, failures.load());
+    TEST_ASSERT_EQUAL_UINT32(kNumItems, received + uut.lost(id));
+}
+
+void test_threads_lossy_torn()
+{
+    constexpr uint32_t kNumItems = 100000U;
+    constexpr size_t kBatch = 8U;
+
+    // Every word holds the same value, so a torn copy which was kept shows up as a mismatch
+    struct Wide {
+        uint32_t words[4];
+    };
+
+    static BroadcastRing<Wide, 4, 1, QueueFullPolicy::kOverwrite> uut;
+    const auto id = uut.subscribe();
+    std::atomic<bool> done {false};
+    std::atomic<uint32_t> failures {0};
+    uint32_t received = 0;
+
+    std::thread consumer([&]() {
+        Wide items[kBatch];
+        for (;;) {
+            const bool finished = done.load();
+            const size_t count = uut.readBulk(id, Span<Wide>(items, kBatch));
+            for (size_t i = 0; i < count; i++) {
+                for (uint32_t word : items[i].words) {
+                    if (word != items[i].words[0]) {
+                        failures++;
+                    }
+                }
+            }
+            received += count;
+            if ((count == 0) && finished) {
+                break;
+            }
+        }
+    });
+
+    for (uint32_t i = 0; i < kNumItems; i++) {
+        uut.publish(Wide {{i, i, i, i}});
+        if ((i % 64U) == 0) {
+            std::this_thread::yield();
+        }
+    }
+    done = true;
+    consumer.join();
+
+    TEST_ASSERT_EQUAL_UINT32(0, failures.load());
+    TEST_ASSERT_EQUAL_UINT32(kNumItems, received + uut.lost(id));
+}
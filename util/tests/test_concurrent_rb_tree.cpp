@@ -0,0 +1,203 @@
+/**
+ * @file      test_concurrent_rb_tree.cpp
+ * @brief     This file contains tests for ConcurrentRbTree.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <atomic>
+#include <thread>
+
+#include "unity.h"
+
+#define private public
+#define protected public
+#include "junk/containers/concurrent_rb_tree.h"
+#undef protected
+#undef private
+
+using namespace junk;
+
+/// A routing entry keyed on its destination. The check field detects torn copies.
+struct Route
+{
+    Route() = default;
+    Route(uint32_t dst, uint32_t hop) : destination(dst), next_hop(hop), check(dst ^ hop) {}
+
+    uint32_t destination = 0;
+    uint32_t next_hop = 0;
+    uint32_t check = 0;
+};
+
+struct RouteDestination
+{
+    const uint32_t& operator()(const Route& route) const
+    {
+        return route.destination;
+    }
+};
+
+using RouteTable = ConcurrentRbTree<1024U, Route, util::ThreeWayCompare, RouteDestination>;
+
+void test_empty();
+void test_insert_find();
+void test_find_miss();
+void test_erase();
+void test_full();
+void test_sequence();
+void test_concurrent_readers();
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_empty);
+    RUN_TEST(test_insert_find);
+    RUN_TEST(test_find_miss);
+    RUN_TEST(test_erase);
+    RUN_TEST(test_full);
+    RUN_TEST(test_sequence);
+    RUN_TEST(test_concurrent_readers);
+
+    return UNITY_END();
+}
+
+void test_empty()
+{
+    ConcurrentRbTree<8U, uint32_t> uut;
+
+    TEST_ASSERT_EQUAL_UINT32(0U, uut.size());
+    TEST_ASSERT_EQUAL_UINT32(8U, uut.capacity());
+    TEST_ASSERT_FALSE(uut.contains(0U));
+}
+
+void test_insert_find()
+{
+    RouteTable uut;
+
+    for (uint32_t i = 0; i < 1024U; i++) {
+        TEST_ASSERT_TRUE(uut.emplace((i * 7U) % 1024U, i));
+    }
+    TEST_ASSERT_EQUAL_UINT32(1024U, uut.size());
+
+    for (uint32_t i = 0; i < 1024U; i++) {
+        Route route;
+        TEST_ASSERT_TRUE(uut.find((i * 7U) % 1024U, route));
+        TEST_ASSERT_EQUAL_UINT32((i * 7U) % 1024U, route.destination);
+        TEST_ASSERT_EQUAL_UINT32(i, route.next_hop);
+    }
+}
+
+void test_find_miss()
+{
+    RouteTable uut;
+    TEST_ASSERT_TRUE(uut.insert(Route(10U, 1U)));
+
+    // The output is left untouched when there is no match
+    Route route(99U, 99U);
+    TEST_ASSERT_FALSE(uut.find(11U, route));
+    TEST_ASSERT_EQUAL_UINT32(99U, route.destination);
+    TEST_ASSERT_EQUAL_UINT32(99U, route.next_hop);
+}
+
+void test_erase()
+{
+    RouteTable uut;
+
+    for (uint32_t i = 0; i < 64U; i++) {
+        TEST_ASSERT_TRUE(uut.emplace(i, i));
+    }
+    for (uint32_t i = 0; i < 64U; i += 2U) {
+        TEST_ASSERT_TRUE(uut.erase(i));
+    }
+    TEST_ASSERT_FALSE(uut.erase(0U));
+
+    for (uint32_t i = 0; i < 64U; i++) {
+        TEST_ASSERT_EQUAL((i % 2U) != 0, uut.contains(i));
+    }
+    TEST_ASSERT_EQUAL_UINT32(32U, uut.size());
+}
+
+void test_full()
+{
+    ConcurrentRbTree<4U, uint32_t> uut;
+
+    for (uint32_t i = 0; i < 4U; i++) {
+        TEST_ASSERT_TRUE(uut.insert(i));
+    }
+    TEST_ASSERT_FALSE(uut.insert(4U));
+    TEST_ASSERT_FALSE(uut.contains(4U));
+}
+
+void test_sequence()
+{
+    ConcurrentRbTree<8U, uint32_t> uut;
+    TEST_ASSERT_EQUAL_UINT32(0U, uut.m_sequence.load());
+
+    // Every write leaves the sequence even and two further on, even if it changed nothing
+    TEST_ASSERT_TRUE(uut.insert(1U));
+    TEST_ASSERT_EQUAL_UINT32(2U, uut.m_sequence.load());
+    TEST_ASSERT_FALSE(uut.erase(5U));
+    TEST_ASSERT_EQUAL_UINT32(4U, uut.m_sequence.load());
+
+    // Reads do not change the sequence
+    TEST_ASSERT_TRUE(uut.contains(1U));
+    TEST_ASSERT_EQUAL_UINT32(4U, uut.m_sequence.load());
+}
+
+void test_concurrent_readers()
+{
+    constexpr uint32_t kNumStable = 256U;
+    constexpr uint32_t kNumChurn = 512U;
+    constexpr size_t kNumReaders = 4U;
+
+    static RouteTable uut;
+
+    // Even destinations stay in the table, odd destinations are inserted and erased repeatedly
+    for (uint32_t i = 0; i < kNumStable; i++) {
+        TEST_ASSERT_TRUE(uut.emplace(i * 2U, i));
+    }
+
+    std::atomic<bool> done {false};
+    std::atomic<uint32_t> failures {0};
+
+    std::thread readers[kNumReaders];
+    for (size_t r = 0; r < kNumReaders; r++) {
+        readers[r] = std::thread([&, r]() {
+            uint32_t key = static_cast<uint32_t>(r);
+            while (!done.load(std::memory_order_relaxed)) {
+                key = (key + 1U) % (kNumStable * 2U);
+                Route route;
+                const bool found = uut.find(key, route);
+                if ((key % 2U) == 0) {
+                    // Stable routes must always be found, and must never be torn
+                    if (!found || (route.destination != key) ||
+                        (route.check != (route.destination ^ route.next_hop))) {
+                        failures++;
+                    }
+                } else if (found && ((route.destination != key) ||
+                                     (route.check != (route.destination ^ route.next_hop)))) {
+                    failures++;
+                }
+            }
+        });
+    }
+
+    for (uint32_t round = 0; round < 64U; round++) {
+        for (uint32_t i = 0; i < kNumChurn / 2U; i++) {
+            TEST_ASSERT_TRUE(uut.emplace((i * 2U) + 1U, round));
+        }
+        for (uint32_t i = 0; i < kNumChurn / 2U; i++) {
+            TEST_ASSERT_TRUE(uut.erase((i * 2U) + 1U));
+        }
+    }
+
+    done = true;
+    for (size_t r = 0; r < kNumReaders; r++) {
+        readers[r].join();
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(0U, failures.load());
+    TEST_ASSERT_EQUAL_UINT32(kNumStable, uut.size());
+}
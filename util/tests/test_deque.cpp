@@ -0,0 +1,444 @@
+/**
+ * @file      test_deque.cpp
+ * @brief     This file contains tests for Deque.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <memory>
+
+#include "unity.h"
+#include "tracked.h"
+
+// Mock JUNK_TRAP
+#define JUNK_TRAP(f,l) g_junk_assert_trap = true
+bool g_junk_assert_trap = false;
+
+#include "junk/containers/deque.h"
+
+using namespace junk;
+
+void test_empty();
+void test_full();
+void test_push_pop_back();
+void test_push_pop_front();
+void test_mixed_ends();
+void test_index();
+void test_index_out_of_range();
+void test_emplace();
+void test_move_only_type();
+void test_bulk_back();
+void test_bulk_front();
+void test_bulk_non_trivial();
+void test_destructs();
+void test_fuzz();
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_empty);
+    RUN_TEST(test_full);
+    RUN_TEST(test_push_pop_back);
+    RUN_TEST(test_push_pop_front);
+    RUN_TEST(test_mixed_ends);
+    RUN_TEST(test_index);
+    RUN_TEST(test_index_out_of_range);
+    RUN_TEST(test_emplace);
+    RUN_TEST(test_move_only_type);
+    RUN_TEST(test_bulk_back);
+    RUN_TEST(test_bulk_front);
+    RUN_TEST(test_bulk_non_trivial);
+    RUN_TEST(test_destructs);
+    RUN_TEST(test_fuzz);
+
+    return UNITY_END();
+}
+
+void test_empty()
+{
+    Deque<uint32_t, 8> uut;
+
+    TEST_ASSERT_TRUE(uut.isEmpty());
+    TEST_ASSERT_FALSE(uut.isFull());
+    TEST_ASSERT_EQUAL_UINT32(0, uut.size());
+    TEST_ASSERT_EQUAL_UINT32(8, uut.capacity());
+
+    uint32_t item = 0;
+    TEST_ASSERT_FALSE(uut.popBack(item));
+    TEST_ASSERT_FALSE(uut.popFront(item));
+    TEST_ASSERT_FALSE(uut.popBack());
+    TEST_ASSERT_FALSE(uut.popFront());
+}
+
+void test_full()
+{
+    Deque<uint32_t, 5> uut;
+
+    for (uint32_t i = 0; i < 5; i++) {
+        TEST_ASSERT_TRUE((i % 2U) ? uut.pushFront(i) : uut.pushBack(i));
+    }
+
+    TEST_ASSERT_TRUE(uut.isFull());
+    TEST_ASSERT_FALSE(uut.pushBack(9U));
+    TEST_ASSERT_FALSE(uut.pushFront(9U));
+    TEST_ASSERT_FALSE(uut.emplaceBack(9U));
+    TEST_ASSERT_FALSE(uut.emplaceFront(9U));
+    TEST_ASSERT_EQUAL_UINT32(5, uut.size());
+}
+
+void test_push_pop_back()
+{
+    Deque<uint32_t, 6> uut;
+
+    // A stack at the back, repeated so the head is not always at slot zero
+    for (uint32_t round = 0; round < 3; round++) {
+        uut.pushFront(100U);
+        for (uint32_t i = 0; i < 5; i++) {
+            TEST_ASSERT_TRUE(uut.pushBack(i));
+        }
+        for (uint32_t i = 5; i > 0; i--) {
+            uint32_t item = 0;
+            TEST_ASSERT_TRUE(uut.popBack(item));
+            TEST_ASSERT_EQUAL_UINT32(i - 1U, item);
+        }
+        TEST_ASSERT_TRUE(uut.popBack());
+        TEST_ASSERT_TRUE(uut.isEmpty());
+    }
+}
+
+void test_push_pop_front()
+{
+    Deque<uint32_t, 6> uut;
+
+    // A stack at the front, which wraps backwards past slot zero
+    for (uint32_t round = 0; round < 3; round++) {
+        for (uint32_t i = 0; i < 6; i++) {
+            TEST_ASSERT_TRUE(uut.pushFront(i));
+        }
+        for (uint32_t i = 6; i > 0; i--) {
+            uint32_t item = 0;
+            TEST_ASSERT_TRUE(uut.popFront(item));
+            TEST_ASSERT_EQUAL_UINT32(i - 1U, item);
+        }
+        TEST_ASSERT_TRUE(uut.isEmpty());
+    }
+}
+
+void test_mixed_ends()
+{
+    Deque<uint32_t, 8> uut;
+
+    // A FIFO in both directions
+    for (uint32_t i = 0; i < 20; i++) {
+        TEST_ASSERT_TRUE(uut.pushBack(i));
+        uint32_t item = 99U;
+        TEST_ASSERT_TRUE(uut.popFront(item));
+        TEST_ASSERT_EQUAL_UINT32(i, item);
+    }
+    for (uint32_t i = 0; i < 20; i++) {
+        TEST_ASSERT_TRUE(uut.pushFront(i));
+        uint32_t item = 99U;
+        TEST_ASSERT_TRUE(uut.popBack(item));
+        TEST_ASSERT_EQUAL_UINT32(i, item);
+    }
+
+    uut.pushBack(2U);
+    uut.pushFront(1U);
+    uut.pushBack(3U);
+    TEST_ASSERT_EQUAL_UINT32(1, uut.front());
+    TEST_ASSERT_EQUAL_UINT32(3, uut.back());
+    uut.front() = 10U;
+    uut.back() = 30U;
+    TEST_ASSERT_EQUAL_UINT32(10, uut[0]);
+    TEST_ASSERT_EQUAL_UINT32(30, uut[2]);
+}
+
+void test_index()
+{
+    Deque<uint32_t, 7> uut;
+
+    for (uint32_t i = 0; i < 3; i++) {
+        uut.pushBack(i + 4U);
+        uut.pushFront(3U - i);
+    }
+    uut.pushFront(0U);
+
+    // The items straddle the end of the storage
+    TEST_ASSERT_EQUAL_UINT32(7, uut.size());
+    for (uint32_t i = 0; i < 7; i++) {
+        TEST_ASSERT_EQUAL_UINT32(i, uut[i]);
+        TEST_ASSERT_EQUAL_UINT32(i, uut.at(i));
+    }
+
+    uut[3] = 33U;
+    const Deque<uint32_t, 7>& const_uut = uut;
+    TEST_ASSERT_EQUAL_UINT32(33, const_uut[3]);
+    TEST_ASSERT_EQUAL_UINT32(0, const_uut.front());
+    TEST_ASSERT_EQUAL_UINT32(6, const_uut.back());
+}
+
+void test_index_out_of_range()
+{
+    Deque<uint32_t, 4> uut;
+    uut.pushBack(1U);
+
+    g_junk_assert_trap = false;
+    uut.at(0);
+    TEST_ASSERT_FALSE(g_junk_assert_trap);
+    uut.at(1);
+    TEST_ASSERT_TRUE(g_junk_assert_trap);
+    g_junk_assert_trap = false;
+}
+
+struct Point
+{
+    Point(uint32_t x_, uint32_t y_) : x(x_), y(y_) {}
+
+    uint32_t x;
+    uint32_t y;
+};
+
+void test_emplace()
+{
+    Deque<Point, 4> uut;
+
+    TEST_ASSERT_TRUE(uut.emplaceBack(1U, 2U));
+    TEST_ASSERT_TRUE(uut.emplaceFront(3U, 4U));
+
+    TEST_ASSERT_EQUAL_UINT32(3, uut.front().x);
+    TEST_ASSERT_EQUAL_UINT32(4, uut.front().y);
+    TEST_ASSERT_EQUAL_UINT32(1, uut.back().x);
+    TEST_ASSERT_EQUAL_UINT32(2, uut.back().y);
+}
+
+void test_move_only_type()
+{
+    Deque<std::unique_ptr<uint32_t>, 4> uut;
+
+    TEST_ASSERT_TRUE(uut.pushBack(std::unique_ptr<uint32_t>(new uint32_t(1U))));
+    TEST_ASSERT_TRUE(uut.pushFront(std::unique_ptr<uint32_t>(new uint32_t(0U))));
+    TEST_ASSERT_TRUE(uut.emplaceBack(new uint32_t(2U)));
+
+    std::unique_ptr<uint32_t> item;
+    TEST_ASSERT_TRUE(uut.popFront(item));
+    TEST_ASSERT_EQUAL_UINT32(0, *item);
+    TEST_ASSERT_TRUE(uut.popBack(item));
+    TEST_ASSERT_EQUAL_UINT32(2, *item);
+    TEST_ASSERT_EQUAL_UINT32(1, *uut.front());
+}
+
+void test_bulk_back()
+{
+    Deque<uint8_t, 8> uut;
+    const uint8_t in[6] = {1U, 2U, 3U, 4U, 5U, 6U};
+    uint8_t out[6] = {};
+
+    // Move the head near the end so the bulk copies wrap
+    for (uint32_t i = 0; i < 5; i++) {
+        uut.pushBack(0U);
+        uut.popFront();
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(6, uut.pushBackBulk(Span<const uint8_t>(in)));
+    TEST_ASSERT_EQUAL_UINT32(2, uut.pushBackBulk(Span<const uint8_t>(in)));
+    TEST_ASSERT_TRUE(uut.isFull());
+    TEST_ASSERT_EQUAL_UINT32(0, uut.pushBackBulk(Span<const uint8_t>(in)));
+    TEST_ASSERT_EQUAL_UINT32(2, uut.back());
+
+    TEST_ASSERT_EQUAL_UINT32(6, uut.popFrontBulk(Span<uint8_t>(out)));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(in, out, 6);
+
+    TEST_ASSERT_EQUAL_UINT32(2, uut.popBackBulk(Span<uint8_t>(out)));
+    TEST_ASSERT_EQUAL_UINT8(1, out[0]);
+    TEST_ASSERT_EQUAL_UINT8(2, out[1]);
+    TEST_ASSERT_TRUE(uut.isEmpty());
+}
+
+void test_bulk_front()
+{
+    Deque<uint32_t, 8> uut;
+    const uint32_t in[5] = {1U, 2U, 3U, 4U, 5U};
+    uint32_t out[8] = {};
+
+    uut.pushBack(6U);
+    uut.pushBack(7U);
+
+    // The head is at slot zero, so the new items wrap back to the end of the storage
+    TEST_ASSERT_EQUAL_UINT32(5, uut.pushFrontBulk(Span<const uint32_t>(in)));
+    TEST_ASSERT_EQUAL_UINT32(7, uut.size());
+    for (uint32_t i = 0; i < 7; i++) {
+        TEST_ASSERT_EQUAL_UINT32(i + 1U, uut[i]);
+    }
+
+    // Only the first item fits
+    TEST_ASSERT_EQUAL_UINT32(1, uut.pushFrontBulk(Span<const uint32_t>(in)));
+    TEST_ASSERT_EQUAL_UINT32(1, uut.front());
+
+    TEST_ASSERT_EQUAL_UINT32(3, uut.popBackBulk(Span<uint32_t>(out, 3)));
+    TEST_ASSERT_EQUAL_UINT32(5, out[0]);
+    TEST_ASSERT_EQUAL_UINT32(6, out[1]);
+    TEST_ASSERT_EQUAL_UINT32(7, out[2]);
+
+    TEST_ASSERT_EQUAL_UINT32(5, uut.popFrontBulk(Span<uint32_t>(out)));
+    TEST_ASSERT_EQUAL_UINT32(1, out[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, out[1]);
+    TEST_ASSERT_EQUAL_UINT32(4, out[4]);
+    TEST_ASSERT_TRUE(uut.isEmpty());
+}
+
+int32_t g_live = 0;
+
+void test_bulk_non_trivial()
+{
+    g_live = 0;
+    {
+        Deque<Tracked, 6> uut;
+        Tracked in[4] = {1U, 2U, 3U, 4U};
+        Tracked out[4];
+        TEST_ASSERT_EQUAL_INT32(8, g_live);
+
+        TEST_ASSERT_EQUAL_UINT32(4, uut.pushFrontBulk(Span<const Tracked>(in)));
+        TEST_ASSERT_EQUAL_INT32(12, g_live);
+        TEST_ASSERT_EQUAL_UINT32(2, uut.pushBackBulk(Span<const Tracked>(in)));
+        TEST_ASSERT_EQUAL_INT32(14, g_live);
+
+        TEST_ASSERT_EQUAL_UINT32(4, uut.popBackBulk(Span<Tracked>(out)));
+        TEST_ASSERT_EQUAL_UINT32(3, out[0].value);
+        TEST_ASSERT_EQUAL_UINT32(4, out[1].value);
+        TEST_ASSERT_EQUAL_UINT32(1, out[2].value);
+        TEST_ASSERT_EQUAL_UINT32(2, out[3].value);
+        TEST_ASSERT_EQUAL_INT32(10, g_live);
+
+        TEST_ASSERT_EQUAL_UINT32(2, uut.popFrontBulk(Span<Tracked>(out)));
+        TEST_ASSERT_EQUAL_UINT32(1, out[0].value);
+        TEST_ASSERT_EQUAL_UINT32(2, out[1].value);
+        TEST_ASSERT_EQUAL_INT32(8, g_live);
+
+        uut.pushBack(5U);
+        uut.pushFront(6U);
+    }
+    TEST_ASSERT_EQUAL_INT32(0, g_live);
+}
+
+void test_destructs()
+{
+    g_live = 0;
+    {
+        Deque<Tracked, 4> uut;
+        uut.emplaceBack(1U);
+        uut.emplaceFront(2U);
+        uut.emplaceBack(3U);
+        TEST_ASSERT_EQUAL_INT32(3, g_live);
+
+        TEST_ASSERT_TRUE(uut.popFront());
+        TEST_ASSERT_EQUAL_INT32(2, g_live);
+
+        uut.clear();
+        TEST_ASSERT_EQUAL_INT32(0, g_live);
+        TEST_ASSERT_TRUE(uut.isEmpty());
+        uut.emplaceFront(4U);
+    }
+    TEST_ASSERT_EQUAL_INT32(0, g_live);
+}
+
+void test_fuzz()
+{
+#ifdef FUZZ_SEED
+    uint32_t seed = FUZZ_SEED;
+#else
+    uint32_t seed = std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+    std::cout << "Fuzz seed: " << seed << std::endl;
+    std::srand(seed);
+
+    Deque<uint32_t, 13> uut;
+    std::deque<uint32_t> reference;
+    uint32_t in[5] = {};
+    uint32_t out[5] = {};
+
+    for (uint32_t op = 0; op < 20000U; op++) {
+        const uint32_t value = static_cast<uint32_t>(std::rand());
+        const size_t length = static_cast<size_t>(std::rand()) % 6U;
+        const size_t room = 13U - reference.size();
+
+        switch (std::rand() % 8) {
+        case 0:
+            TEST_ASSERT_EQUAL(room > 0, uut.pushBack(value));
+            if (room > 0) {
+                reference.push_back(value);
+            }
+            break;
+        case 1:
+            TEST_ASSERT_EQUAL(room > 0, uut.pushFront(value));
+            if (room > 0) {
+                reference.push_front(value);
+            }
+            break;
+        case 2: {
+            uint32_t item = 0;
+            TEST_ASSERT_EQUAL(!reference.empty(), uut.popBack(item));
+            if (!reference.empty()) {
+                TEST_ASSERT_EQUAL_UINT32(reference.back(), item);
+                reference.pop_back();
+            }
+            break;
+        }
+        case 3: {
+            uint32_t item = 0;
+            TEST_ASSERT_EQUAL(!reference.empty(), uut.popFront(item));
+            if (!reference.empty()) {
+                TEST_ASSERT_EQUAL_UINT32(reference.front(), item);
+                reference.pop_front();
+            }
+            break;
+        }
+        case 4: {
+            for (size_t i = 0; i < length; i++) {
+                in[i] = value + i;
+            }
+            const size_t taken = util::min(length, room);
+            TEST_ASSERT_EQUAL_UINT32(taken, uut.pushBackBulk(Span<const uint32_t>(in, length)));
+            reference.insert(reference.end(), in, in + taken);
+            break;
+        }
+        case 5: {
+            for (size_t i = 0; i < length; i++) {
+                in[i] = value + i;
+            }
+            const size_t taken = util::min(length, room);
+            TEST_ASSERT_EQUAL_UINT32(taken, uut.pushFrontBulk(Span<const uint32_t>(in, length)));
+            reference.insert(reference.begin(), in, in + taken);
+            break;
+        }
+        case 6: {
+            const size_t count = util::min(length, reference.size());
+            TEST_ASSERT_EQUAL_UINT32(count, uut.popFrontBulk(Span<uint32_t>(out, length)));
+            for (size_t i = 0; i < count; i++) {
+                TEST_ASSERT_EQUAL_UINT32(reference.front(), out[i]);
+                reference.pop_front();
+            }
+            break;
+        }
+        default: {
+            const size_t count = util::min(length, reference.size());
+            TEST_ASSERT_EQUAL_UINT32(count, uut.popBackBulk(Span<uint32_t>(out, length)));
+            for (size_t i = 0; i < count; i++) {
+                TEST_ASSERT_EQUAL_UINT32(reference[reference.size() - count + i], out[i]);
+            }
+            reference.resize(reference.size() - count);
+            break;
+        }
+        }
+
+        TEST_ASSERT_EQUAL_UINT32(reference.size(), uut.size());
+        for (size_t i = 0; i < reference.size(); i++) {
+            TEST_ASSERT_EQUAL_UINT32(reference[i], uut[i]);
+        }
+    }
+}
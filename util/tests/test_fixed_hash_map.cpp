@@ -0,0 +1,392 @@
+/**
+ * @file      test_fixed_hash_map.cpp
+ * @brief     This file contains tests for FixedHashMap.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <unordered_map>
+
+#include "unity.h"
+#include "tracked.h"
+
+#define private public
+#include "junk/containers/fixed_hash_map.h"
+#undef private
+
+using namespace junk;
+
+void test_empty();
+void test_try_emplace();
+void test_try_emplace_existing();
+void test_try_emplace_full();
+void test_in_place_construction();
+void test_insert_or_assign();
+void test_subscript();
+void test_erase();
+void test_erase_collisions();
+void test_wraparound();
+void test_clear_destructs();
+void test_for_each();
+void test_control_group();
+void test_fuzz();
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_empty);
+    RUN_TEST(test_try_emplace);
+    RUN_TEST(test_try_emplace_existing);
+    RUN_TEST(test_try_emplace_full);
+    RUN_TEST(test_in_place_construction);
+    RUN_TEST(test_insert_or_assign);
+    RUN_TEST(test_subscript);
+    RUN_TEST(test_erase);
+    RUN_TEST(test_erase_collisions);
+    RUN_TEST(test_wraparound);
+    RUN_TEST(test_clear_destructs);
+    RUN_TEST(test_for_each);
+    RUN_TEST(test_control_group);
+    RUN_TEST(test_fuzz);
+
+    return UNITY_END();
+}
+
+/// A poor hash which sends every key to the slot given by its value divided by 16.
+struct BucketHash
+{
+    size_t operator()(uint32_t key) const
+    {
+        return (static_cast<size_t>(key / 16U) << 7) | (key & 0x7FU);
+    }
+};
+
+void test_empty()
+{
+    FixedHashMap<uint32_t, uint32_t, 8> uut;
+
+    TEST_ASSERT_TRUE(uut.isEmpty());
+    TEST_ASSERT_FALSE(uut.isFull());
+    TEST_ASSERT_EQUAL_UINT32(0U, uut.size());
+    TEST_ASSERT_EQUAL_UINT32(8U, uut.capacity());
+    TEST_ASSERT_NULL(uut.find(0U));
+    TEST_ASSERT_FALSE(uut.contains(0U));
+    TEST_ASSERT_FALSE(uut.erase(0U));
+}
+
+void test_try_emplace()
+{
+    FixedHashMap<uint32_t, uint32_t, 64> uut;
+
+    for (uint32_t i = 0; i < 64U; i++) {
+        TEST_ASSERT_TRUE(uut.tryEmplace(i * 1000U, i));
+    }
+    TEST_ASSERT_TRUE(uut.isFull());
+
+    for (uint32_t i = 0; i < 64U; i++) {
+        const uint32_t* value = uut.find(i * 1000U);
+        TEST_ASSERT_NOT_NULL(value);
+        TEST_ASSERT_EQUAL_UINT32(i, *value);
+        TEST_ASSERT_FALSE(uut.contains((i * 1000U) + 1U));
+    }
+}
+
+void test_try_emplace_existing()
+{
+    FixedHashMap<uint32_t, uint32_t, 8> uut;
+
+    TEST_ASSERT_TRUE(uut.tryEmplace(1U, 100U));
+    TEST_ASSERT_FALSE(uut.tryEmplace(1U, 200U));
+    TEST_ASSERT_EQUAL_UINT32(1U, uut.size());
+    TEST_ASSERT_EQUAL_UINT32(100U, *uut.find(1U));
+}
+
+void test_try_emplace_full()
+{
+    FixedHashMap<uint32_t, uint32_t, 2> uut;
+
+    TEST_ASSERT_TRUE(uut.tryEmplace(1U, 1U));
+    TEST_ASSERT_TRUE(uut.tryEmplace(2U, 2U));
+    TEST_ASSERT_FALSE(uut.tryEmplace(3U, 3U));
+    TEST_ASSERT_FALSE(uut.insertOrAssign(3U, 3U));
+    TEST_ASSERT_NULL(uut.find(3U));
+
+    // Existing keys can still be assigned when full
+    TEST_ASSERT_TRUE(uut.insertOrAssign(2U, 20U));
+    TEST_ASSERT_EQUAL_UINT32(20U, *uut.find(2U));
+}
+
+uint32_t g_constructions = 0;
+uint32_t g_copies = 0;
+int32_t g_live = 0;
+
+struct TrackedPair
+{
+    TrackedPair() : a(0), b(0) { g_constructions++; g_live++; }
+    TrackedPair(uint32_t a_, uint32_t b_) : a(a_), b(b_) { g_constructions++; g_live++; }
+    TrackedPair(const TrackedPair& t) : a(t.a), b(t.b) { g_copies++; g_live++; }
+    TrackedPair(TrackedPair&& t) : a(t.a), b(t.b) { g_live++; }
+    ~TrackedPair() { g_live--; }
+    TrackedPair& operator =(const TrackedPair& t) { a = t.a; b = t.b; g_copies++; return *this; }
+
+    uint32_t a;
+    uint32_t b;
+};
+
+void test_in_place_construction()
+{
+    FixedHashMap<uint32_t, TrackedPair, 8> uut;
+
+    g_constructions = 0;
+    g_copies = 0;
+
+    TEST_ASSERT_TRUE(uut.tryEmplace(1U, 10U, 20U));
+    TEST_ASSERT_EQUAL_UINT32(1U, g_constructions);
+    TEST_ASSERT_EQUAL_UINT32(0U, g_copies);
+
+    // Nothing is constructed for an existing key
+    TEST_ASSERT_FALSE(uut.tryEmplace(1U, 30U, 40U));
+    TEST_ASSERT_EQUAL_UINT32(1U, g_constructions);
+    TEST_ASSERT_EQUAL_UINT32(0U, g_copies);
+
+    TrackedPair* value = uut.find(1U);
+    TEST_ASSERT_NOT_NULL(value);
+    TEST_ASSERT_EQUAL_UINT32(10U, value->a);
+    TEST_ASSERT_EQUAL_UINT32(20U, value->b);
+}
+
+void test_insert_or_assign()
+{
+    FixedHashMap<uint32_t, uint32_t, 8> uut;
+
+    TEST_ASSERT_TRUE(uut.insertOrAssign(5U, 50U));
+    TEST_ASSERT_EQUAL_UINT32(50U, *uut.find(5U));
+    TEST_ASSERT_TRUE(uut.insertOrAssign(5U, 55U));
+    TEST_ASSERT_EQUAL_UINT32(55U, *uut.find(5U));
+    TEST_ASSERT_EQUAL_UINT32(1U, uut.size());
+}
+
+void test_subscript()
+{
+    FixedHashMap<uint32_t, uint32_t, 8> uut;
+
+    TEST_ASSERT_EQUAL_UINT32(0U, uut[3U]);
+    TEST_ASSERT_EQUAL_UINT32(1U, uut.size());
+
+    uut[3U] = 33U;
+    uut[4U] += 4U;
+    TEST_ASSERT_EQUAL_UINT32(33U, *uut.find(3U));
+    TEST_ASSERT_EQUAL_UINT32(4U, *uut.find(4U));
+    TEST_ASSERT_EQUAL_UINT32(2U, uut.size());
+}
+
+void test_erase()
+{
+    FixedHashMap<uint32_t, uint32_t, 32> uut;
+
+    for (uint32_t i = 0; i < 32U; i++) {
+        TEST_ASSERT_TRUE(uut.tryEmplace(i, i * 2U));
+    }
+
+    for (uint32_t i = 0; i < 32U; i += 2) {
+        TEST_ASSERT_TRUE(uut.erase(i));
+        TEST_ASSERT_FALSE(uut.erase(i));
+    }
+    TEST_ASSERT_EQUAL_UINT32(16U, uut.size());
+
+    for (uint32_t i = 0; i < 32U; i++) {
+        TEST_ASSERT_EQUAL((i % 2U) != 0, uut.contains(i));
+    }
+
+    // Erased slots are reused
+    for (uint32_t i = 0; i < 32U; i += 2) {
+        TEST_ASSERT_TRUE(uut.tryEmplace(i, i));
+    }
+    TEST_ASSERT_TRUE(uut.isFull());
+}
+
+void test_erase_collisions()
+{
+    FixedHashMap<uint32_t, uint32_t, 32, BucketHash> uut;
+
+    // Keys 0..15 share home slot 0 and keys 16..23 share home slot 1, forming one long run
+    for (uint32_t i = 0; i < 24U; i++) {
+        TEST_ASSERT_TRUE(uut.tryEmplace(i, i));
+    }
+
+    // Erasing from the front of the run shifts every following entry back
+    TEST_ASSERT_TRUE(uut.erase(0U));
+    TEST_ASSERT_TRUE(uut.erase(16U));
+    TEST_ASSERT_TRUE(uut.erase(7U));
+
+    for (uint32_t i = 0; i < 24U; i++) {
+        const bool erased = (i == 0U) || (i == 16U) || (i == 7U);
+        TEST_ASSERT_EQUAL(!erased, uut.contains(i));
+    }
+
+    // The run stays contiguous, no tombstones are left behind
+    for (size_t slot = 0; slot < 21U; slot++) {
+        TEST_ASSERT_TRUE(uut.m_ctrl[slot] != ControlGroup::kEmpty);
+    }
+    for (size_t slot = 21U; slot < uut.kNumSlots; slot++) {
+        TEST_ASSERT_TRUE(uut.m_ctrl[slot] == ControlGroup::kEmpty);
+    }
+}
+
+void test_wraparound()
+{
+    using Map = FixedHashMap<uint32_t, uint32_t, 32, BucketHash>;
+    Map uut;
+
+    // Every key homes to the last slot, so the run wraps to the start of the table
+    const uint32_t last = static_cast<uint32_t>(Map::kNumSlots - 1U) * 16U;
+    for (uint32_t i = 0; i < 8U; i++) {
+        TEST_ASSERT_TRUE(uut.tryEmplace(last + i, i));
+    }
+    TEST_ASSERT_TRUE(uut.m_ctrl[0] != ControlGroup::kEmpty);
+
+    // The mirrored control bytes past the end follow the first group
+    for (size_t slot = 0; slot < ControlGroup::kWidth; slot++) {
+        TEST_ASSERT_EQUAL_UINT8(uut.m_ctrl[slot], uut.m_ctrl[Map::kNumSlots + slot]);
+    }
+
+    TEST_ASSERT_TRUE(uut.erase(last));
+    for (uint32_t i = 1; i < 8U; i++) {
+        TEST_ASSERT_EQUAL_UINT32(i, *uut.find(last + i));
+    }
+    TEST_ASSERT_TRUE(uut.m_ctrl[6] == ControlGroup::kEmpty);
+    TEST_ASSERT_TRUE(uut.m_ctrl[Map::kNumSlots + 6U] == ControlGroup::kEmpty);
+}
+
+void test_clear_destructs()
+{
+    g_live = 0;
+    {
+        FixedHashMap<uint32_t, TrackedPair, 16> uut;
+        for (uint32_t i = 0; i < 16U; i++) {
+            TEST_ASSERT_TRUE(uut.tryEmplace(i, i, i));
+        }
+        TEST_ASSERT_EQUAL_INT32(16, g_live);
+
+        TEST_ASSERT_TRUE(uut.erase(3U));
+        TEST_ASSERT_EQUAL_INT32(15, g_live);
+
+        uut.clear();
+        TEST_ASSERT_EQUAL_INT32(0, g_live);
+        TEST_ASSERT_TRUE(uut.isEmpty());
+        TEST_ASSERT_FALSE(uut.contains(4U));
+
+        for (uint32_t i = 0; i < 4U; i++) {
+            uut[i].a = i;
+        }
+        TEST_ASSERT_EQUAL_INT32(4, g_live);
+    }
+    TEST_ASSERT_EQUAL_INT32(0, g_live);
+}
+
+void test_for_each()
+{
+    FixedHashMap<uint32_t, uint32_t, 64> uut;
+
+    for (uint32_t i = 0; i < 64U; i++) {
+        TEST_ASSERT_TRUE(uut.tryEmplace(i, i));
+    }
+
+    uint32_t count = 0;
+    uint32_t sum = 0;
+    uut.forEach([&](const uint32_t& key, uint32_t& value) {
+        TEST_ASSERT_EQUAL_UINT32(key, value);
+        value++;
+        count++;
+        sum += key;
+    });
+    TEST_ASSERT_EQUAL_UINT32(64U, count);
+    TEST_ASSERT_EQUAL_UINT32(2016U, sum);
+    TEST_ASSERT_EQUAL_UINT32(11U, *uut.find(10U));
+}
+
+void test_control_group()
+{
+    uint8_t ctrl[ControlGroup::kWidth];
+    for (size_t i = 0; i < ControlGroup::kWidth; i++) {
+        ctrl[i] = static_cast<uint8_t>(i & 0x3U);
+    }
+    ctrl[5] = ControlGroup::kEmpty;
+
+    ControlGroup::Mask empties = ControlGroup::matchEmpty(ctrl);
+    TEST_ASSERT_TRUE(empties != 0);
+    TEST_ASSERT_EQUAL_UINT32(5U, ControlGroup::lowest(empties));
+    TEST_ASSERT_TRUE(ControlGroup::clearLowest(empties) == 0);
+
+    // Fragment 2 is in slots 2, 6, 10, 14, ...
+    ControlGroup::Mask matches = ControlGroup::match(ctrl, 2U);
+    TEST_ASSERT_EQUAL_UINT32(2U, ControlGroup::lowest(matches));
+    matches = ControlGroup::clearLowest(matches);
+    TEST_ASSERT_EQUAL_UINT32(6U, ControlGroup::lowest(matches));
+
+    // Only the match before the empty slot remains
+    matches = ControlGroup::before(ControlGroup::match(ctrl, 2U), 5U);
+    TEST_ASSERT_EQUAL_UINT32(2U, ControlGroup::lowest(matches));
+    TEST_ASSERT_TRUE(ControlGroup::clearLowest(matches) == 0);
+    TEST_ASSERT_TRUE(ControlGroup::before(matches, 0U) == 0);
+    TEST_ASSERT_TRUE(ControlGroup::before(matches, ControlGroup::kWidth) == matches);
+}
+
+void test_fuzz()
+{
+#ifdef FUZZ_SEED
+    uint32_t seed = FUZZ_SEED;
+#else
+    uint32_t seed = std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+    std::cout << "Fuzz seed: " << seed << std::endl;
+    std::srand(seed);
+
+    static FixedHashMap<uint32_t, uint32_t, 512> uut;
+    std::unordered_map<uint32_t, uint32_t> reference;
+
+    for (uint32_t op = 0; op < 100000U; op++) {
+        // A small key range keeps the map near full so runs are long and erases shift often
+        const uint32_t key = static_cast<uint32_t>(std::rand()) % 768U;
+        const uint32_t value = static_cast<uint32_t>(std::rand());
+
+        switch (std::rand() % 3) {
+        case 0: {
+            const bool inserted = uut.tryEmplace(key, value);
+            const bool expected = (reference.size() < 512U) && (reference.count(key) == 0);
+            TEST_ASSERT_EQUAL_MESSAGE(expected, inserted, "tryEmplace");
+            if (expected) {
+                reference[key] = value;
+            }
+            break;
+        }
+        case 1: {
+            const bool erased = uut.erase(key);
+            TEST_ASSERT_EQUAL_MESSAGE(reference.erase(key) != 0, erased, "erase");
+            break;
+        }
+        default: {
+            const uint32_t* found = uut.find(key);
+            auto it = reference.find(key);
+            if (it == reference.end()) {
+                TEST_ASSERT_NULL(found);
+            } else {
+                TEST_ASSERT_NOT_NULL(found);
+                TEST_ASSERT_EQUAL_UINT32(it->second, *found);
+            }
+            break;
+        }
+        }
+
+        TEST_ASSERT_EQUAL_UINT32(reference.size(), uut.size());
+    }
+
+    for (const auto& pair : reference) {
+        TEST_ASSERT_EQUAL_UINT32(pair.second, *uut.find(pair.first));
+    }
+}
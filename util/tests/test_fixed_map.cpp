@@ -0,0 +1,255 @@
+/**
+ * @file      test_fixed_map.cpp
+ * @brief     This file contains tests for FixedMap.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <cstring>
+
+#include "unity.h"
+
+#include "junk/containers/fixed_map.h"
+
+using namespace junk;
+
+void test_empty();
+void test_try_emplace();
+void test_try_emplace_existing();
+void test_try_emplace_full();
+void test_in_place_construction();
+void test_insert_or_assign();
+void test_subscript();
+void test_erase();
+void test_heterogeneous_lookup();
+void test_single_descent();
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_empty);
+    RUN_TEST(test_try_emplace);
+    RUN_TEST(test_try_emplace_existing);
+    RUN_TEST(test_try_emplace_full);
+    RUN_TEST(test_in_place_construction);
+    RUN_TEST(test_insert_or_assign);
+    RUN_TEST(test_subscript);
+    RUN_TEST(test_erase);
+    RUN_TEST(test_heterogeneous_lookup);
+    RUN_TEST(test_single_descent);
+
+    return UNITY_END();
+}
+
+void test_empty()
+{
+    FixedMap<uint32_t, uint32_t, 8> uut;
+
+    TEST_ASSERT_TRUE(uut.isEmpty());
+    TEST_ASSERT_FALSE(uut.isFull());
+    TEST_ASSERT_EQUAL_UINT32(0U, uut.size());
+    TEST_ASSERT_EQUAL_UINT32(8U, uut.capacity());
+    TEST_ASSERT_NULL(uut.find(0U));
+    TEST_ASSERT_FALSE(uut.contains(0U));
+}
+
+void test_try_emplace()
+{
+    FixedMap<uint32_t, uint32_t, 64> uut;
+
+    for (uint32_t i = 0; i < 64U; i++) {
+        TEST_ASSERT_TRUE(uut.tryEmplace((i * 13U) % 64U, i));
+    }
+    TEST_ASSERT_TRUE(uut.isFull());
+
+    for (uint32_t i = 0; i < 64U; i++) {
+        uint32_t* value = uut.find((i * 13U) % 64U);
+        TEST_ASSERT_NOT_NULL(value);
+        TEST_ASSERT_EQUAL_UINT32(i, *value);
+    }
+}
+
+void test_try_emplace_existing()
+{
+    FixedMap<uint32_t, uint32_t, 8> uut;
+
+    TEST_ASSERT_TRUE(uut.tryEmplace(1U, 100U));
+    TEST_ASSERT_FALSE(uut.tryEmplace(1U, 200U));
+    TEST_ASSERT_EQUAL_UINT32(1U, uut.size());
+    TEST_ASSERT_EQUAL_UINT32(100U, *uut.find(1U));
+}
+
+void test_try_emplace_full()
+{
+    FixedMap<uint32_t, uint32_t, 2> uut;
+
+    TEST_ASSERT_TRUE(uut.tryEmplace(1U, 1U));
+    TEST_ASSERT_TRUE(uut.tryEmplace(2U, 2U));
+    TEST_ASSERT_FALSE(uut.tryEmplace(3U, 3U));
+    TEST_ASSERT_FALSE(uut.insertOrAssign(3U, 3U));
+    TEST_ASSERT_NULL(uut.find(3U));
+
+    // Existing keys can still be assigned when full
+    TEST_ASSERT_TRUE(uut.insertOrAssign(2U, 20U));
+    TEST_ASSERT_EQUAL_UINT32(20U, *uut.find(2U));
+}
+
+uint32_t g_constructions = 0;
+uint32_t g_copies = 0;
+
+struct Tracked
+{
+    Tracked(uint32_t a_, uint32_t b_) : a(a_), b(b_) { g_constructions++; }
+    Tracked(const Tracked& t) : a(t.a), b(t.b) { g_copies++; }
+    Tracked& operator =(const Tracked& t) { a = t.a; b = t.b; g_copies++; return *this; }
+
+    uint32_t a;
+    uint32_t b;
+};
+
+void test_in_place_construction()
+{
+    FixedMap<uint32_t, Tracked, 8> uut;
+
+    g_constructions = 0;
+    g_copies = 0;
+
+    TEST_ASSERT_TRUE(uut.tryEmplace(1U, 10U, 20U));
+    TEST_ASSERT_EQUAL_UINT32(1U, g_constructions);
+    TEST_ASSERT_EQUAL_UINT32(0U, g_copies);
+
+    // Nothing is constructed for an existing key
+    TEST_ASSERT_FALSE(uut.tryEmplace(1U, 30U, 40U));
+    TEST_ASSERT_EQUAL_UINT32(1U, g_constructions);
+    TEST_ASSERT_EQUAL_UINT32(0U, g_copies);
+
+    Tracked* value = uut.find(1U);
+    TEST_ASSERT_NOT_NULL(value);
+    TEST_ASSERT_EQUAL_UINT32(10U, value->a);
+    TEST_ASSERT_EQUAL_UINT32(20U, value->b);
+}
+
+void test_insert_or_assign()
+{
+    FixedMap<uint32_t, uint32_t, 8> uut;
+
+    TEST_ASSERT_TRUE(uut.insertOrAssign(5U, 50U));
+    TEST_ASSERT_EQUAL_UINT32(50U, *uut.find(5U));
+    TEST_ASSERT_TRUE(uut.insertOrAssign(5U, 55U));
+    TEST_ASSERT_EQUAL_UINT32(55U, *uut.find(5U));
+    TEST_ASSERT_EQUAL_UINT32(1U, uut.size());
+}
+
+void test_subscript()
+{
+    FixedMap<uint32_t, uint32_t, 8> uut;
+
+    TEST_ASSERT_EQUAL_UINT32(0U, uut[3U]);
+    TEST_ASSERT_EQUAL_UINT32(1U, uut.size());
+
+    uut[3U] = 33U;
+    uut[4U] += 4U;
+    TEST_ASSERT_EQUAL_UINT32(33U, *uut.find(3U));
+    TEST_ASSERT_EQUAL_UINT32(4U, *uut.find(4U));
+    TEST_ASSERT_EQUAL_UINT32(2U, uut.size());
+}
+
+void test_erase()
+{
+    FixedMap<uint32_t, uint32_t, 32> uut;
+
+    for (uint32_t i = 0; i < 32U; i++) {
+        TEST_ASSERT_TRUE(uut.tryEmplace(i, i * 2U));
+    }
+
+    for (uint32_t i = 0; i < 32U; i += 2) {
+        TEST_ASSERT_TRUE(uut.erase(i));
+        TEST_ASSERT_FALSE(uut.erase(i));
+    }
+    TEST_ASSERT_EQUAL_UINT32(16U, uut.size());
+
+    for (uint32_t i = 0; i < 32U; i++) {
+        TEST_ASSERT_EQUAL((i % 2U) != 0, uut.contains(i));
+    }
+
+    // Erased slots are reused
+    for (uint32_t i = 0; i < 32U; i += 2) {
+        TEST_ASSERT_TRUE(uut.tryEmplace(i, i));
+    }
+    TEST_ASSERT_TRUE(uut.isFull());
+}
+
+struct Name
+{
+    char str[16];
+};
+
+struct NameCompare
+{
+    int operator()(const Name& a, const Name& b) const
+    {
+        return std::strcmp(a.str, b.str);
+    }
+
+    int operator()(const char* a, const Name& b) const
+    {
+        return std::strcmp(a, b.str);
+    }
+};
+
+void test_heterogeneous_lookup()
+{
+    FixedMap<Name, uint32_t, 8, NameCompare> uut;
+
+    Name uart = {"uart0"};
+    Name spi = {"spi1"};
+    TEST_ASSERT_TRUE(uut.tryEmplace(uart, 0x1000U));
+    TEST_ASSERT_TRUE(uut.tryEmplace(spi, 0x2000U));
+
+    // Lookup by string literal without building a Name
+    const uint32_t* value = uut.find("spi1");
+    TEST_ASSERT_NOT_NULL(value);
+    TEST_ASSERT_EQUAL_HEX32(0x2000U, *value);
+    TEST_ASSERT_TRUE(uut.contains("uart0"));
+    TEST_ASSERT_FALSE(uut.contains("i2c0"));
+    TEST_ASSERT_TRUE(uut.erase("uart0"));
+    TEST_ASSERT_FALSE(uut.contains("uart0"));
+}
+
+uint32_t g_compare_count = 0;
+
+struct CountingCompare
+{
+    int operator()(const uint32_t& a, const uint32_t& b) const
+    {
+        g_compare_count++;
+        return (a < b) ? -1 : ((a > b) ? 1 : 0);
+    }
+};
+
+void test_single_descent()
+{
+    FixedMap<uint32_t, uint32_t, 256, CountingCompare> uut;
+
+    // A tree of 256 nodes is at most 2 * log2(257) deep
+    const uint32_t max_depth = 17U;
+
+    for (uint32_t i = 0; i < 256U; i++) {
+        g_compare_count = 0;
+        TEST_ASSERT_TRUE(uut.insertOrAssign(i, i));
+        TEST_ASSERT_TRUE(g_compare_count <= max_depth);
+    }
+
+    for (uint32_t i = 0; i < 256U; i++) {
+        g_compare_count = 0;
+        TEST_ASSERT_TRUE(uut.insertOrAssign(i, i + 1U));
+        TEST_ASSERT_TRUE(g_compare_count <= max_depth);
+
+        g_compare_count = 0;
+        uut[i]++;
+        TEST_ASSERT_TRUE(g_compare_count <= max_depth);
+        TEST_ASSERT_EQUAL_UINT32(i + 2U, *uut.find(i));
+    }
+}
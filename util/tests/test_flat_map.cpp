@@ -0,0 +1,248 @@
+/**
+ * @file      test_flat_map.cpp
+ * @brief     This file contains tests for FlatMap.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <cstring>
+
+#include "unity.h"
+
+#include "junk/containers/flat_map.h"
+
+using namespace junk;
+
+void test_empty();
+void test_try_emplace();
+void test_try_emplace_existing();
+void test_try_emplace_full();
+void test_in_place_construction();
+void test_insert_or_assign();
+void test_subscript();
+void test_erase();
+void test_insert_batch();
+void test_entries();
+void test_heterogeneous_lookup();
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_empty);
+    RUN_TEST(test_try_emplace);
+    RUN_TEST(test_try_emplace_existing);
+    RUN_TEST(test_try_emplace_full);
+    RUN_TEST(test_in_place_construction);
+    RUN_TEST(test_insert_or_assign);
+    RUN_TEST(test_subscript);
+    RUN_TEST(test_erase);
+    RUN_TEST(test_insert_batch);
+    RUN_TEST(test_entries);
+    RUN_TEST(test_heterogeneous_lookup);
+
+    return UNITY_END();
+}
+
+void test_empty()
+{
+    FlatMap<uint32_t, uint32_t, 8> uut;
+
+    TEST_ASSERT_TRUE(uut.isEmpty());
+    TEST_ASSERT_FALSE(uut.isFull());
+    TEST_ASSERT_EQUAL_UINT32(0U, uut.size());
+    TEST_ASSERT_EQUAL_UINT32(8U, uut.capacity());
+    TEST_ASSERT_NULL(uut.find(0U));
+    TEST_ASSERT_FALSE(uut.contains(0U));
+}
+
+void test_try_emplace()
+{
+    FlatMap<uint32_t, uint32_t, 64> uut;
+
+    for (uint32_t i = 0; i < 64U; i++) {
+        TEST_ASSERT_TRUE(uut.tryEmplace((i * 37U) % 64U, i));
+    }
+    TEST_ASSERT_TRUE(uut.isFull());
+
+    for (uint32_t i = 0; i < 64U; i++) {
+        const uint32_t* value = uut.find((i * 37U) % 64U);
+        TEST_ASSERT_NOT_NULL(value);
+        TEST_ASSERT_EQUAL_UINT32(i, *value);
+    }
+}
+
+void test_try_emplace_existing()
+{
+    FlatMap<uint32_t, uint32_t, 8> uut;
+
+    TEST_ASSERT_TRUE(uut.tryEmplace(1U, 100U));
+    TEST_ASSERT_FALSE(uut.tryEmplace(1U, 200U));
+    TEST_ASSERT_EQUAL_UINT32(1U, uut.size());
+    TEST_ASSERT_EQUAL_UINT32(100U, *uut.find(1U));
+}
+
+void test_try_emplace_full()
+{
+    FlatMap<uint32_t, uint32_t, 2> uut;
+
+    TEST_ASSERT_TRUE(uut.tryEmplace(1U, 1U));
+    TEST_ASSERT_TRUE(uut.tryEmplace(2U, 2U));
+    TEST_ASSERT_FALSE(uut.tryEmplace(3U, 3U));
+    TEST_ASSERT_FALSE(uut.insertOrAssign(3U, 3U));
+    TEST_ASSERT_NULL(uut.find(3U));
+
+    // Existing keys can still be assigned when full
+    TEST_ASSERT_TRUE(uut.insertOrAssign(2U, 20U));
+    TEST_ASSERT_EQUAL_UINT32(20U, *uut.find(2U));
+}
+
+uint32_t g_constructions = 0;
+uint32_t g_copies = 0;
+
+struct Tracked
+{
+    Tracked(uint32_t a_, uint32_t b_) : a(a_), b(b_) { g_constructions++; }
+    Tracked(const Tracked& t) : a(t.a), b(t.b) { g_copies++; }
+    Tracked& operator =(const Tracked& t) { a = t.a; b = t.b; g_copies++; return *this; }
+
+    uint32_t a;
+    uint32_t b;
+};
+
+void test_in_place_construction()
+{
+    FlatMap<uint32_t, Tracked, 8> uut;
+
+    g_constructions = 0;
+    g_copies = 0;
+
+    TEST_ASSERT_TRUE(uut.tryEmplace(1U, 10U, 20U));
+    TEST_ASSERT_EQUAL_UINT32(1U, g_constructions);
+    TEST_ASSERT_EQUAL_UINT32(0U, g_copies);
+
+    // Nothing is constructed for an existing key
+    TEST_ASSERT_FALSE(uut.tryEmplace(1U, 30U, 40U));
+    TEST_ASSERT_EQUAL_UINT32(1U, g_constructions);
+    TEST_ASSERT_EQUAL_UINT32(0U, g_copies);
+
+    Tracked* value = uut.find(1U);
+    TEST_ASSERT_NOT_NULL(value);
+    TEST_ASSERT_EQUAL_UINT32(10U, value->a);
+    TEST_ASSERT_EQUAL_UINT32(20U, value->b);
+}
+
+void test_insert_or_assign()
+{
+    FlatMap<uint32_t, uint32_t, 8> uut;
+
+    TEST_ASSERT_TRUE(uut.insertOrAssign(5U, 50U));
+    TEST_ASSERT_EQUAL_UINT32(50U, *uut.find(5U));
+    TEST_ASSERT_TRUE(uut.insertOrAssign(5U, 55U));
+    TEST_ASSERT_EQUAL_UINT32(55U, *uut.find(5U));
+    TEST_ASSERT_EQUAL_UINT32(1U, uut.size());
+}
+
+void test_subscript()
+{
+    FlatMap<uint32_t, uint32_t, 8> uut;
+
+    TEST_ASSERT_EQUAL_UINT32(0U, uut[3U]);
+    TEST_ASSERT_EQUAL_UINT32(1U, uut.size());
+
+    uut[3U] = 33U;
+    uut[4U] += 4U;
+    TEST_ASSERT_EQUAL_UINT32(33U, *uut.find(3U));
+    TEST_ASSERT_EQUAL_UINT32(4U, *uut.find(4U));
+    TEST_ASSERT_EQUAL_UINT32(2U, uut.size());
+}
+
+void test_erase()
+{
+    FlatMap<uint32_t, uint32_t, 32> uut;
+
+    for (uint32_t i = 0; i < 32U; i++) {
+        TEST_ASSERT_TRUE(uut.tryEmplace(i, i * 2U));
+    }
+
+    for (uint32_t i = 0; i < 32U; i += 2) {
+        TEST_ASSERT_TRUE(uut.erase(i));
+        TEST_ASSERT_FALSE(uut.erase(i));
+    }
+    TEST_ASSERT_EQUAL_UINT32(16U, uut.size());
+
+    for (uint32_t i = 0; i < 32U; i++) {
+        TEST_ASSERT_EQUAL((i % 2U) != 0, uut.contains(i));
+    }
+}
+
+void test_insert_batch()
+{
+    using Map = FlatMap<uint32_t, uint32_t, 16>;
+    Map uut;
+    TEST_ASSERT_TRUE(uut.tryEmplace(4U, 400U));
+
+    const Map::Entry batch[5] = {{8U, 800U}, {2U, 200U}, {4U, 999U}, {6U, 600U}, {0U, 0U}};
+    TEST_ASSERT_TRUE(uut.insertBatch(batch));
+    TEST_ASSERT_EQUAL_UINT32(5U, uut.size());
+
+    // The existing value is kept
+    TEST_ASSERT_EQUAL_UINT32(400U, *uut.find(4U));
+    for (uint32_t i = 0; i <= 8U; i += 2U) {
+        TEST_ASSERT_EQUAL_UINT32(i * 100U, *uut.find(i));
+    }
+}
+
+void test_entries()
+{
+    FlatMap<uint32_t, uint32_t, 8> uut;
+    TEST_ASSERT_TRUE(uut.tryEmplace(3U, 30U));
+    TEST_ASSERT_TRUE(uut.tryEmplace(1U, 10U));
+    TEST_ASSERT_TRUE(uut.tryEmplace(2U, 20U));
+
+    const auto entries = uut.entries();
+    TEST_ASSERT_EQUAL_UINT32(3U, entries.length());
+    for (size_t i = 0; i < entries.length(); i++) {
+        TEST_ASSERT_EQUAL_UINT32(i + 1U, entries[i].key);
+        TEST_ASSERT_EQUAL_UINT32((i + 1U) * 10U, entries[i].value);
+    }
+    TEST_ASSERT_EQUAL_PTR(uut.find(1U), &entries[0].value);
+}
+
+struct Name
+{
+    char str[16];
+};
+
+struct NameCompare
+{
+    int operator()(const Name& a, const Name& b) const
+    {
+        return std::strcmp(a.str, b.str);
+    }
+
+    int operator()(const char* a, const Name& b) const
+    {
+        return std::strcmp(a, b.str);
+    }
+};
+
+void test_heterogeneous_lookup()
+{
+    FlatMap<Name, uint32_t, 8, NameCompare> uut;
+
+    Name uart = {"uart0"};
+    Name spi = {"spi1"};
+    TEST_ASSERT_TRUE(uut.tryEmplace(uart, 0x1000U));
+    TEST_ASSERT_TRUE(uut.tryEmplace(spi, 0x2000U));
+
+    // Lookup by string literal without building a Name
+    const uint32_t* value = uut.find("spi1");
+    TEST_ASSERT_NOT_NULL(value);
+    TEST_ASSERT_EQUAL_HEX32(0x2000U, *value);
+    TEST_ASSERT_TRUE(uut.contains("uart0"));
+    TEST_ASSERT_FALSE(uut.contains("i2c0"));
+    TEST_ASSERT_TRUE(uut.erase("uart0"));
+    TEST_ASSERT_FALSE(uut.contains("uart0"));
+}
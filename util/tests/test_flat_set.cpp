@@ -0,0 +1,337 @@
+/**
+ * @file      test_flat_set.cpp
+ * @brief     This file contains tests for FlatSet.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <set>
+
+#include "unity.h"
+#include "tracked.h"
+
+#include "junk/containers/flat_set.h"
+
+using namespace junk;
+
+void test_empty();
+void test_insert();
+void test_insert_existing();
+void test_insert_full();
+void test_erase();
+void test_view();
+void test_insert_batch_empty();
+void test_insert_batch_append();
+void test_insert_batch_merge();
+void test_insert_batch_duplicates();
+void test_insert_batch_full();
+void test_key_of();
+void test_destructs();
+void test_fuzz();
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_empty);
+    RUN_TEST(test_insert);
+    RUN_TEST(test_insert_existing);
+    RUN_TEST(test_insert_full);
+    RUN_TEST(test_erase);
+    RUN_TEST(test_view);
+    RUN_TEST(test_insert_batch_empty);
+    RUN_TEST(test_insert_batch_append);
+    RUN_TEST(test_insert_batch_merge);
+    RUN_TEST(test_insert_batch_duplicates);
+    RUN_TEST(test_insert_batch_full);
+    RUN_TEST(test_key_of);
+    RUN_TEST(test_destructs);
+    RUN_TEST(test_fuzz);
+
+    return UNITY_END();
+}
+
+/// Check that a set holds strictly increasing items.
+template <typename Set>
+void checkSorted(const Set& set)
+{
+    const auto view = set.view();
+    TEST_ASSERT_EQUAL_UINT32(set.size(), view.length());
+    for (size_t i = 1; i < view.length(); i++) {
+        TEST_ASSERT_TRUE(view[i - 1U] < view[i]);
+    }
+}
+
+void test_empty()
+{
+    FlatSet<uint32_t, 8> uut;
+
+    TEST_ASSERT_TRUE(uut.isEmpty());
+    TEST_ASSERT_FALSE(uut.isFull());
+    TEST_ASSERT_EQUAL_UINT32(0U, uut.size());
+    TEST_ASSERT_EQUAL_UINT32(8U, uut.capacity());
+    TEST_ASSERT_NULL(uut.find(0U));
+    TEST_ASSERT_FALSE(uut.contains(0U));
+    TEST_ASSERT_FALSE(uut.erase(0U));
+    TEST_ASSERT_EQUAL_UINT32(0U, uut.view().length());
+}
+
+void test_insert()
+{
+    FlatSet<uint32_t, 64> uut;
+
+    for (uint32_t i = 0; i < 64U; i++) {
+        TEST_ASSERT_TRUE(uut.insert((i * 37U) % 64U));
+    }
+    TEST_ASSERT_TRUE(uut.isFull());
+    checkSorted(uut);
+
+    for (uint32_t i = 0; i < 64U; i++) {
+        const uint32_t* item = uut.find(i);
+        TEST_ASSERT_NOT_NULL(item);
+        TEST_ASSERT_EQUAL_UINT32(i, *item);
+    }
+    TEST_ASSERT_FALSE(uut.contains(64U));
+}
+
+void test_insert_existing()
+{
+    FlatSet<uint32_t, 8> uut;
+
+    TEST_ASSERT_TRUE(uut.insert(5U));
+    TEST_ASSERT_FALSE(uut.insert(5U));
+    TEST_ASSERT_EQUAL_UINT32(1U, uut.size());
+}
+
+void test_insert_full()
+{
+    FlatSet<uint32_t, 2> uut;
+
+    TEST_ASSERT_TRUE(uut.insert(1U));
+    TEST_ASSERT_TRUE(uut.insert(2U));
+    TEST_ASSERT_FALSE(uut.insert(0U));
+    TEST_ASSERT_FALSE(uut.contains(0U));
+}
+
+void test_erase()
+{
+    FlatSet<uint32_t, 32> uut;
+
+    for (uint32_t i = 0; i < 32U; i++) {
+        TEST_ASSERT_TRUE(uut.insert(i));
+    }
+    for (uint32_t i = 0; i < 32U; i += 2U) {
+        TEST_ASSERT_TRUE(uut.erase(i));
+        TEST_ASSERT_FALSE(uut.erase(i));
+    }
+    TEST_ASSERT_EQUAL_UINT32(16U, uut.size());
+    checkSorted(uut);
+
+    for (uint32_t i = 0; i < 32U; i++) {
+        TEST_ASSERT_EQUAL((i % 2U) != 0, uut.contains(i));
+    }
+}
+
+void test_view()
+{
+    FlatSet<uint32_t, 8> uut;
+    TEST_ASSERT_TRUE(uut.insert(30U));
+    TEST_ASSERT_TRUE(uut.insert(10U));
+    TEST_ASSERT_TRUE(uut.insert(20U));
+
+    // The view refers to the set's storage, no items are copied
+    Span<const uint32_t> view = uut.view();
+    TEST_ASSERT_EQUAL_UINT32(3U, view.length());
+    TEST_ASSERT_EQUAL_PTR(uut.find(10U), &view[0]);
+    TEST_ASSERT_EQUAL_UINT32(10U, view[0]);
+    TEST_ASSERT_EQUAL_UINT32(20U, view[1]);
+    TEST_ASSERT_EQUAL_UINT32(30U, view[2]);
+}
+
+void test_insert_batch_empty()
+{
+    FlatSet<uint32_t, 16> uut;
+
+    const uint32_t batch[8] = {7U, 3U, 5U, 1U, 6U, 0U, 2U, 4U};
+    TEST_ASSERT_TRUE(uut.insertBatch(batch));
+    TEST_ASSERT_EQUAL_UINT32(8U, uut.size());
+    checkSorted(uut);
+
+    TEST_ASSERT_TRUE(uut.insertBatch(nullptr, 0));
+    TEST_ASSERT_EQUAL_UINT32(8U, uut.size());
+}
+
+void test_insert_batch_append()
+{
+    FlatSet<uint32_t, 16> uut;
+
+    const uint32_t first[4] = {3U, 1U, 2U, 0U};
+    const uint32_t second[4] = {7U, 5U, 4U, 6U};
+    TEST_ASSERT_TRUE(uut.insertBatch(first));
+    TEST_ASSERT_TRUE(uut.insertBatch(second));
+    TEST_ASSERT_EQUAL_UINT32(8U, uut.size());
+    checkSorted(uut);
+}
+
+void test_insert_batch_merge()
+{
+    FlatSet<uint32_t, 256> uut;
+
+    // Interleaved batches force a merge on every call
+    for (uint32_t b = 0; b < 8U; b++) {
+        uint32_t batch[32];
+        for (uint32_t i = 0; i < 32U; i++) {
+            batch[i] = (((i * 13U) % 32U) * 8U) + b;
+        }
+        TEST_ASSERT_TRUE(uut.insertBatch(batch));
+        TEST_ASSERT_EQUAL_UINT32((b + 1U) * 32U, uut.size());
+        checkSorted(uut);
+    }
+
+    for (uint32_t i = 0; i < 256U; i++) {
+        TEST_ASSERT_EQUAL_UINT32(i, uut.view()[i]);
+    }
+}
+
+void test_insert_batch_duplicates()
+{
+    FlatSet<uint32_t, 16> uut;
+    TEST_ASSERT_TRUE(uut.insert(4U));
+    TEST_ASSERT_TRUE(uut.insert(8U));
+
+    // Duplicates within the batch and of existing items are dropped
+    const uint32_t batch[8] = {8U, 2U, 4U, 2U, 6U, 0U, 6U, 2U};
+    TEST_ASSERT_TRUE(uut.insertBatch(batch));
+    TEST_ASSERT_EQUAL_UINT32(5U, uut.size());
+    checkSorted(uut);
+    for (uint32_t i = 0; i <= 8U; i += 2U) {
+        TEST_ASSERT_TRUE(uut.contains(i));
+    }
+}
+
+void test_insert_batch_full()
+{
+    FlatSet<uint32_t, 8> uut;
+    const uint32_t batch[6] = {5U, 4U, 3U, 2U, 1U, 0U};
+    TEST_ASSERT_TRUE(uut.insertBatch(batch));
+
+    // The whole batch must fit, even if some of it would be dropped as duplicates
+    TEST_ASSERT_FALSE(uut.insertBatch(batch));
+    TEST_ASSERT_EQUAL_UINT32(6U, uut.size());
+    checkSorted(uut);
+}
+
+/// A record keyed on its id, which keeps the payload of the first insert.
+struct Record
+{
+    uint32_t id;
+    uint32_t payload;
+};
+
+struct RecordId
+{
+    const uint32_t& operator()(const Record& record) const
+    {
+        return record.id;
+    }
+};
+
+void test_key_of()
+{
+    FlatSet<Record, 16, util::ThreeWayCompare, RecordId> uut;
+
+    const Record batch[4] = {{30U, 3U}, {10U, 1U}, {20U, 2U}, {40U, 4U}};
+    TEST_ASSERT_TRUE(uut.insertBatch(batch));
+    TEST_ASSERT_FALSE(uut.insert(Record{20U, 99U}));
+
+    // Lookups take only the key
+    const Record* record = uut.find(20U);
+    TEST_ASSERT_NOT_NULL(record);
+    TEST_ASSERT_EQUAL_UINT32(2U, record->payload);
+
+    // An existing item wins over a batch item with the same key
+    const Record again[2] = {{20U, 98U}, {5U, 0U}};
+    TEST_ASSERT_TRUE(uut.insertBatch(again));
+    TEST_ASSERT_EQUAL_UINT32(5U, uut.size());
+    TEST_ASSERT_EQUAL_UINT32(2U, uut.find(20U)->payload);
+    TEST_ASSERT_EQUAL_UINT32(5U, uut.view()[0].id);
+}
+
+int32_t g_live = 0;
+
+void test_destructs()
+{
+    g_live = 0;
+    {
+        FlatSet<Tracked, 16> uut;
+        const Tracked batch[4] = {Tracked(3U), Tracked(1U), Tracked(3U), Tracked(2U)};
+        TEST_ASSERT_EQUAL_INT32(4, g_live);
+
+        TEST_ASSERT_TRUE(uut.insertBatch(batch));
+        TEST_ASSERT_EQUAL_INT32(7, g_live);
+
+        TEST_ASSERT_TRUE(uut.insert(Tracked(0U)));
+        TEST_ASSERT_EQUAL_INT32(8, g_live);
+        TEST_ASSERT_TRUE(uut.erase(Tracked(1U)));
+        TEST_ASSERT_EQUAL_INT32(7, g_live);
+
+        uut.clear();
+        TEST_ASSERT_EQUAL_INT32(4, g_live);
+        TEST_ASSERT_TRUE(uut.insertBatch(batch));
+    }
+    TEST_ASSERT_EQUAL_INT32(0, g_live);
+}
+
+void test_fuzz()
+{
+#ifdef FUZZ_SEED
+    uint32_t seed = FUZZ_SEED;
+#else
+    uint32_t seed = std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+    std::cout << "Fuzz seed: " << seed << std::endl;
+    std::srand(seed);
+
+    static FlatSet<uint32_t, 1024> uut;
+    std::set<uint32_t> reference;
+
+    for (uint32_t round = 0; round < 2000U; round++) {
+        const uint32_t op = static_cast<uint32_t>(std::rand()) % 4U;
+        if (op == 0) {
+            // A batch of random size, with keys which may collide with each other
+            uint32_t batch[64];
+            const size_t count = static_cast<size_t>(std::rand()) % 64U;
+            for (size_t i = 0; i < count; i++) {
+                batch[i] = static_cast<uint32_t>(std::rand()) % 2048U;
+            }
+            const bool fits = (count <= (1024U - reference.size()));
+            TEST_ASSERT_EQUAL(fits, uut.insertBatch(batch, count));
+            if (fits) {
+                reference.insert(&batch[0], &batch[count]);
+            }
+        } else {
+            const uint32_t key = static_cast<uint32_t>(std::rand()) % 2048U;
+            if (op == 1) {
+                const bool expected = (reference.size() < 1024U) && (reference.count(key) == 0);
+                TEST_ASSERT_EQUAL(expected, uut.insert(key));
+                if (expected) {
+                    reference.insert(key);
+                }
+            } else {
+                TEST_ASSERT_EQUAL(reference.erase(key) != 0, uut.erase(key));
+            }
+        }
+
+        TEST_ASSERT_EQUAL_UINT32(reference.size(), uut.size());
+    }
+
+    size_t i = 0;
+    for (uint32_t key : reference) {
+        TEST_ASSERT_EQUAL_UINT32(key, uut.view()[i++]);
+        TEST_ASSERT_TRUE(uut.contains(key));
+    }
+}
@@ -0,0 +1,230 @@
+/**
+ * @file      test_interval_tree.cpp
+ * @brief     This file contains tests for IntervalTree.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "unity.h"
+
+#define private public
+#define protected public
+#include "junk/containers/interval_tree.h"
+#undef protected
+#undef private
+
+using namespace junk;
+
+using Tree = IntervalTree<256U, int32_t, uint32_t>;
+using Item = Tree::Item;
+
+int32_t checkMaxEndpoints(const Tree::Node* node, bool& valid)
+{
+    if (node == nullptr) {
+        return INT32_MIN;
+    }
+
+    int32_t max_high = node->item.high;
+    int32_t left = checkMaxEndpoints(node->left, valid);
+    int32_t right = checkMaxEndpoints(node->right, valid);
+    if (left > max_high) {
+        max_high = left;
+    }
+    if (right > max_high) {
+        max_high = right;
+    }
+    if (max_high != node->max_high) {
+        valid = false;
+    }
+
+    return max_high;
+}
+
+bool checkMaxEndpoints(const Tree& tree)
+{
+    bool valid = true;
+    checkMaxEndpoints(tree.m_root, valid);
+    return valid;
+}
+
+void test_empty();
+void test_find_overlap();
+void test_for_each_overlap();
+void test_for_each_containing();
+void test_erase();
+void test_fuzzy_overlap();
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_empty);
+    RUN_TEST(test_find_overlap);
+    RUN_TEST(test_for_each_overlap);
+    RUN_TEST(test_for_each_containing);
+    RUN_TEST(test_erase);
+    for (uint32_t i = 0; i < 8U; i++) {
+        RUN_TEST(test_fuzzy_overlap);
+    }
+
+    return UNITY_END();
+}
+
+void test_empty()
+{
+    Tree uut;
+
+    TEST_ASSERT_NULL(uut.findOverlap(0, 100));
+    size_t calls = 0;
+    TEST_ASSERT_EQUAL_UINT32(0U, uut.forEachOverlap(0, 100, [&](const Item&) { calls++; }));
+    TEST_ASSERT_EQUAL_UINT32(0U, calls);
+}
+
+void test_find_overlap()
+{
+    Tree uut;
+
+    // Reservations [0,9], [10,19], ... [90,99] with a gap after each
+    for (int32_t i = 0; i < 10; i++) {
+        TEST_ASSERT_TRUE(uut.insert(Item(i * 20, i * 20 + 9, i)));
+        TEST_ASSERT_TRUE(checkMaxEndpoints(uut));
+    }
+
+    const Item* item = uut.findOverlap(45, 62);
+    TEST_ASSERT_NOT_NULL(item);
+    TEST_ASSERT_EQUAL_UINT32(3U, item->value);
+
+    item = uut.findOverlap(29, 29);
+    TEST_ASSERT_NOT_NULL(item);
+    TEST_ASSERT_EQUAL_UINT32(1U, item->value);
+
+    TEST_ASSERT_NULL(uut.findOverlap(10, 19));
+    TEST_ASSERT_NULL(uut.findOverlap(190, 300));
+    TEST_ASSERT_NULL(uut.findOverlap(-10, -1));
+}
+
+void test_for_each_overlap()
+{
+    Tree uut;
+
+    TEST_ASSERT_TRUE(uut.insert(Item(0, 100, 0U)));
+    TEST_ASSERT_TRUE(uut.insert(Item(10, 20, 1U)));
+    TEST_ASSERT_TRUE(uut.insert(Item(15, 30, 2U)));
+    TEST_ASSERT_TRUE(uut.insert(Item(40, 50, 3U)));
+    TEST_ASSERT_TRUE(uut.insert(Item(60, 60, 4U)));
+
+    uint32_t mask = 0;
+    TEST_ASSERT_EQUAL_UINT32(3U, uut.forEachOverlap(18, 35, [&](const Item& i) {
+        mask |= (1U << i.value);
+    }));
+    TEST_ASSERT_EQUAL_HEX32(0x07U, mask);
+
+    mask = 0;
+    TEST_ASSERT_EQUAL_UINT32(2U, uut.forEachOverlap(55, 65, [&](const Item& i) {
+        mask |= (1U << i.value);
+    }));
+    TEST_ASSERT_EQUAL_HEX32(0x11U, mask);
+
+    mask = 0;
+    TEST_ASSERT_EQUAL_UINT32(0U, uut.forEachOverlap(101, 200, [&](const Item& i) {
+        mask |= (1U << i.value);
+    }));
+    TEST_ASSERT_EQUAL_HEX32(0x00U, mask);
+}
+
+void test_for_each_containing()
+{
+    Tree uut;
+
+    TEST_ASSERT_TRUE(uut.insert(Item(0, 100, 0U)));
+    TEST_ASSERT_TRUE(uut.insert(Item(10, 20, 1U)));
+    TEST_ASSERT_TRUE(uut.insert(Item(20, 30, 2U)));
+
+    uint32_t mask = 0;
+    TEST_ASSERT_EQUAL_UINT32(3U, uut.forEachContaining(20, [&](const Item& i) {
+        mask |= (1U << i.value);
+    }));
+    TEST_ASSERT_EQUAL_HEX32(0x07U, mask);
+
+    mask = 0;
+    TEST_ASSERT_EQUAL_UINT32(1U, uut.forEachContaining(31, [&](const Item& i) {
+        mask |= (1U << i.value);
+    }));
+    TEST_ASSERT_EQUAL_HEX32(0x01U, mask);
+}
+
+void test_erase()
+{
+    Tree uut;
+
+    for (int32_t i = 0; i < 64; i++) {
+        TEST_ASSERT_TRUE(uut.insert(Item(i, 100, static_cast<uint32_t>(i))));
+    }
+    TEST_ASSERT_TRUE(checkMaxEndpoints(uut));
+
+    // Remove the intervals in a scrambled order, checking the stored endpoints each time
+    for (int32_t i = 0; i < 64; i++) {
+        int32_t low = (i * 5) % 64;
+        TEST_ASSERT_TRUE(uut.erase(Item(low, 100, 0U)));
+        TEST_ASSERT_TRUE(checkMaxEndpoints(uut));
+        TEST_ASSERT_EQUAL_UINT32(63U - i, uut.forEachContaining(99, [](const Item&) {}));
+    }
+}
+
+void test_fuzzy_overlap()
+{
+    Tree uut;
+    std::vector<Item> reference;
+
+#ifdef FUZZ_SEED
+    uint32_t seed = FUZZ_SEED;
+#else
+    uint32_t seed = std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+    std::cout << "Fuzz seed: " << seed << std::endl;
+    srand(seed);
+
+    for (uint32_t i = 0; i < 2048U; i++) {
+        if ((reference.size() == 256U) || ((rand() % 3 == 0) && !reference.empty())) {
+            size_t victim = static_cast<size_t>(rand()) % reference.size();
+            TEST_ASSERT_TRUE(uut.erase(reference[victim]));
+            reference.erase(reference.begin() + victim);
+        } else {
+            int32_t low = rand() % 1000;
+            Item item(low, low + (rand() % 50), i);
+            TEST_ASSERT_TRUE(uut.insert(item));
+            reference.push_back(item);
+        }
+    }
+    TEST_ASSERT_TRUE(checkMaxEndpoints(uut));
+
+    for (int32_t low = -20; low < 1100; low += 13) {
+        int32_t high = low + (rand() % 40);
+        size_t expected = 0;
+        for (const Item& item : reference) {
+            if ((item.low <= high) && (item.high >= low)) {
+                expected++;
+            }
+        }
+
+        size_t found = 0;
+        TEST_ASSERT_EQUAL_UINT32(expected, uut.forEachOverlap(low, high, [&](const Item& item) {
+            TEST_ASSERT_TRUE((item.low <= high) && (item.high >= low));
+            found++;
+        }));
+        TEST_ASSERT_EQUAL_UINT32(expected, found);
+
+        const Item* any = uut.findOverlap(low, high);
+        if (expected == 0) {
+            TEST_ASSERT_NULL(any);
+        } else {
+            TEST_ASSERT_NOT_NULL(any);
+        }
+    }
+}
@@ -0,0 +1,294 @@
+/**
+ * @file      test_key_value_table.cpp
+ * @brief     This file contains tests for KeyValueTable.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <map>
+
+#include "unity.h"
+#include "tracked.h"
+
+#include "junk/containers/key_value_table.h"
+
+using namespace junk;
+
+void test_empty();
+void test_try_emplace();
+void test_try_emplace_existing();
+void test_try_emplace_full();
+void test_insert_or_assign();
+void test_subscript();
+void test_erase();
+void test_index();
+void test_views();
+void test_heterogeneous_lookup();
+void test_destructs();
+void test_fuzz();
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_empty);
+    RUN_TEST(test_try_emplace);
+    RUN_TEST(test_try_emplace_existing);
+    RUN_TEST(test_try_emplace_full);
+    RUN_TEST(test_insert_or_assign);
+    RUN_TEST(test_subscript);
+    RUN_TEST(test_erase);
+    RUN_TEST(test_index);
+    RUN_TEST(test_views);
+    RUN_TEST(test_heterogeneous_lookup);
+    RUN_TEST(test_destructs);
+    RUN_TEST(test_fuzz);
+
+    return UNITY_END();
+}
+
+void test_empty()
+{
+    KeyValueTable<uint32_t, uint32_t, 8> uut;
+
+    TEST_ASSERT_TRUE(uut.isEmpty());
+    TEST_ASSERT_FALSE(uut.isFull());
+    TEST_ASSERT_EQUAL_UINT32(0U, uut.size());
+    TEST_ASSERT_EQUAL_UINT32(8U, uut.capacity());
+    TEST_ASSERT_NULL(uut.find(0U));
+    TEST_ASSERT_FALSE(uut.contains(0U));
+    TEST_ASSERT_TRUE(uut.indexOf(0U) == uut.kNotFound);
+    TEST_ASSERT_FALSE(uut.erase(0U));
+}
+
+void test_try_emplace()
+{
+    KeyValueTable<uint32_t, uint32_t, 64> uut;
+
+    for (uint32_t i = 0; i < 64U; i++) {
+        TEST_ASSERT_TRUE(uut.tryEmplace((i * 37U) % 64U, i));
+    }
+    TEST_ASSERT_TRUE(uut.isFull());
+
+    for (uint32_t i = 0; i < 64U; i++) {
+        const uint32_t* value = uut.find((i * 37U) % 64U);
+        TEST_ASSERT_NOT_NULL(value);
+        TEST_ASSERT_EQUAL_UINT32(i, *value);
+    }
+}
+
+void test_try_emplace_existing()
+{
+    KeyValueTable<uint32_t, uint32_t, 8> uut;
+
+    TEST_ASSERT_TRUE(uut.tryEmplace(1U, 100U));
+    TEST_ASSERT_FALSE(uut.tryEmplace(1U, 200U));
+    TEST_ASSERT_EQUAL_UINT32(1U, uut.size());
+    TEST_ASSERT_EQUAL_UINT32(100U, *uut.find(1U));
+}
+
+void test_try_emplace_full()
+{
+    KeyValueTable<uint32_t, uint32_t, 2> uut;
+
+    TEST_ASSERT_TRUE(uut.tryEmplace(1U, 1U));
+    TEST_ASSERT_TRUE(uut.tryEmplace(2U, 2U));
+    TEST_ASSERT_FALSE(uut.tryEmplace(3U, 3U));
+    TEST_ASSERT_FALSE(uut.insertOrAssign(3U, 3U));
+    TEST_ASSERT_NULL(uut.find(3U));
+
+    // Existing keys can still be assigned when full
+    TEST_ASSERT_TRUE(uut.insertOrAssign(2U, 20U));
+    TEST_ASSERT_EQUAL_UINT32(20U, *uut.find(2U));
+}
+
+void test_insert_or_assign()
+{
+    KeyValueTable<uint32_t, uint32_t, 8> uut;
+
+    TEST_ASSERT_TRUE(uut.insertOrAssign(5U, 50U));
+    TEST_ASSERT_EQUAL_UINT32(50U, *uut.find(5U));
+    TEST_ASSERT_TRUE(uut.insertOrAssign(5U, 55U));
+    TEST_ASSERT_EQUAL_UINT32(55U, *uut.find(5U));
+    TEST_ASSERT_EQUAL_UINT32(1U, uut.size());
+}
+
+void test_subscript()
+{
+    KeyValueTable<uint32_t, uint32_t, 8> uut;
+
+    TEST_ASSERT_EQUAL_UINT32(0U, uut[3U]);
+    TEST_ASSERT_EQUAL_UINT32(1U, uut.size());
+
+    uut[3U] = 33U;
+    uut[4U] += 4U;
+    TEST_ASSERT_EQUAL_UINT32(33U, *uut.find(3U));
+    TEST_ASSERT_EQUAL_UINT32(4U, *uut.find(4U));
+    TEST_ASSERT_EQUAL_UINT32(2U, uut.size());
+}
+
+void test_erase()
+{
+    KeyValueTable<uint32_t, uint32_t, 32> uut;
+
+    for (uint32_t i = 0; i < 32U; i++) {
+        TEST_ASSERT_TRUE(uut.tryEmplace(i, i * 2U));
+    }
+
+    for (uint32_t i = 0; i < 32U; i += 2) {
+        TEST_ASSERT_TRUE(uut.erase(i));
+        TEST_ASSERT_FALSE(uut.erase(i));
+    }
+    TEST_ASSERT_EQUAL_UINT32(16U, uut.size());
+
+    // Keys and values stay paired after the shift
+    for (uint32_t i = 0; i < 32U; i++) {
+        TEST_ASSERT_EQUAL((i % 2U) != 0, uut.contains(i));
+        if ((i % 2U) != 0) {
+            TEST_ASSERT_EQUAL_UINT32(i * 2U, *uut.find(i));
+        }
+    }
+}
+
+void test_index()
+{
+    KeyValueTable<uint32_t, uint32_t, 8> uut;
+    TEST_ASSERT_TRUE(uut.tryEmplace(30U, 3U));
+    TEST_ASSERT_TRUE(uut.tryEmplace(10U, 1U));
+    TEST_ASSERT_TRUE(uut.tryEmplace(20U, 2U));
+
+    const size_t index = uut.indexOf(20U);
+    TEST_ASSERT_EQUAL_UINT32(1U, index);
+    TEST_ASSERT_EQUAL_UINT32(20U, uut.keyAt(index));
+    TEST_ASSERT_EQUAL_UINT32(2U, uut.valueAt(index));
+
+    uut.valueAt(index) = 22U;
+    TEST_ASSERT_EQUAL_UINT32(22U, *uut.find(20U));
+    TEST_ASSERT_TRUE(uut.indexOf(25U) == uut.kNotFound);
+}
+
+void test_views()
+{
+    KeyValueTable<uint32_t, uint64_t, 8> uut;
+    for (uint32_t i = 4U; i > 0; i--) {
+        TEST_ASSERT_TRUE(uut.tryEmplace(i, i * 100ULL));
+    }
+
+    // The keys are contiguous and sorted, the values are parallel to them
+    const Span<const uint32_t> keys = uut.keys();
+    Span<uint64_t> values = uut.values();
+    TEST_ASSERT_EQUAL_UINT32(4U, keys.length());
+    TEST_ASSERT_EQUAL_UINT32(4U, values.length());
+    for (size_t i = 0; i < keys.length(); i++) {
+        TEST_ASSERT_EQUAL_UINT32(i + 1U, keys[i]);
+        TEST_ASSERT_TRUE(values[i] == ((i + 1U) * 100ULL));
+        TEST_ASSERT_EQUAL_PTR(&keys[0] + i, &keys[i]);
+    }
+
+    values[0] = 7U;
+    TEST_ASSERT_TRUE(*uut.find(1U) == 7U);
+}
+
+struct Name
+{
+    char str[16];
+};
+
+struct NameCompare
+{
+    int operator()(const Name& a, const Name& b) const
+    {
+        return std::strcmp(a.str, b.str);
+    }
+
+    int operator()(const char* a, const Name& b) const
+    {
+        return std::strcmp(a, b.str);
+    }
+};
+
+void test_heterogeneous_lookup()
+{
+    KeyValueTable<Name, uint32_t, 8, NameCompare> uut;
+
+    Name uart = {"uart0"};
+    Name spi = {"spi1"};
+    TEST_ASSERT_TRUE(uut.tryEmplace(uart, 0x1000U));
+    TEST_ASSERT_TRUE(uut.tryEmplace(spi, 0x2000U));
+
+    // Lookup by string literal without building a Name
+    const uint32_t* value = uut.find("spi1");
+    TEST_ASSERT_NOT_NULL(value);
+    TEST_ASSERT_EQUAL_HEX32(0x2000U, *value);
+    TEST_ASSERT_TRUE(uut.contains("uart0"));
+    TEST_ASSERT_FALSE(uut.contains("i2c0"));
+    TEST_ASSERT_TRUE(uut.erase("uart0"));
+    TEST_ASSERT_FALSE(uut.contains("uart0"));
+}
+
+int32_t g_live = 0;
+
+void test_destructs()
+{
+    g_live = 0;
+    {
+        KeyValueTable<uint32_t, Tracked, 16> uut;
+        for (uint32_t i = 16U; i > 0; i--) {
+            TEST_ASSERT_TRUE(uut.tryEmplace(i, i));
+        }
+        TEST_ASSERT_EQUAL_INT32(16, g_live);
+
+        TEST_ASSERT_TRUE(uut.erase(8U));
+        TEST_ASSERT_EQUAL_INT32(15, g_live);
+
+        uut.clear();
+        TEST_ASSERT_EQUAL_INT32(0, g_live);
+
+        uut[1U].value = 1U;
+        uut[2U].value = 2U;
+        TEST_ASSERT_EQUAL_INT32(2, g_live);
+    }
+    TEST_ASSERT_EQUAL_INT32(0, g_live);
+}
+
+void test_fuzz()
+{
+#ifdef FUZZ_SEED
+    uint32_t seed = FUZZ_SEED;
+#else
+    uint32_t seed = std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+    std::cout << "Fuzz seed: " << seed << std::endl;
+    std::srand(seed);
+
+    static KeyValueTable<uint32_t, uint32_t, 256> uut;
+    std::map<uint32_t, uint32_t> reference;
+
+    for (uint32_t op = 0; op < 20000U; op++) {
+        const uint32_t key = static_cast<uint32_t>(std::rand()) % 384U;
+        const uint32_t value = static_cast<uint32_t>(std::rand());
+
+        if ((std::rand() % 2) == 0) {
+            const bool expected = (reference.size() < 256U) || (reference.count(key) != 0);
+            TEST_ASSERT_EQUAL(expected, uut.insertOrAssign(key, value));
+            if (expected) {
+                reference[key] = value;
+            }
+        } else {
+            TEST_ASSERT_EQUAL(reference.erase(key) != 0, uut.erase(key));
+        }
+        TEST_ASSERT_EQUAL_UINT32(reference.size(), uut.size());
+    }
+
+    size_t i = 0;
+    for (const auto& pair : reference) {
+        TEST_ASSERT_EQUAL_UINT32(pair.first, uut.keyAt(i));
+        TEST_ASSERT_EQUAL_UINT32(pair.second, uut.valueAt(i));
+        i++;
+    }
+}
@@ -0,0 +1,338 @@
+/**
+ * @file      test_lru_cache.cpp
+ * @brief     This file contains tests for LruCache.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <list>
+#include <unordered_map>
+
+#include "unity.h"
+#include "tracked.h"
+
+#include "junk/containers/lru_cache.h"
+
+using namespace junk;
+
+void test_empty();
+void test_put_get();
+void test_put_assign();
+void test_evict_oldest();
+void test_get_refreshes();
+void test_peek_keeps_order();
+void test_try_emplace();
+void test_erase();
+void test_stats();
+void test_destructs();
+void test_fuzz();
+void test_put_evicted_value();
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_empty);
+    RUN_TEST(test_put_get);
+    RUN_TEST(test_put_assign);
+    RUN_TEST(test_evict_oldest);
+    RUN_TEST(test_get_refreshes);
+    RUN_TEST(test_peek_keeps_order);
+    RUN_TEST(test_try_emplace);
+    RUN_TEST(test_erase);
+    RUN_TEST(test_stats);
+    RUN_TEST(test_destructs);
+    RUN_TEST(test_fuzz);
+    RUN_TEST(test_put_evicted_value);
+
+    return UNITY_END();
+}
+
+void test_empty()
+{
+    LruCache<uint32_t, uint32_t, 4> uut;
+
+    TEST_ASSERT_TRUE(uut.isEmpty());
+    TEST_ASSERT_FALSE(uut.isFull());
+    TEST_ASSERT_EQUAL_UINT32(0U, uut.size());
+    TEST_ASSERT_EQUAL_UINT32(4U, uut.capacity());
+    TEST_ASSERT_NULL(uut.get(1U));
+    TEST_ASSERT_NULL(uut.peek(1U));
+    TEST_ASSERT_NULL(uut.oldest());
+    TEST_ASSERT_FALSE(uut.erase(1U));
+}
+
+void test_put_get()
+{
+    LruCache<uint32_t, uint32_t, 4> uut;
+
+    for (uint32_t i = 0; i < 4U; i++) {
+        uint32_t* value = uut.put(i, i * 10U);
+        TEST_ASSERT_NOT_NULL(value);
+        TEST_ASSERT_EQUAL_UINT32(i * 10U, *value);
+    }
+    TEST_ASSERT_TRUE(uut.isFull());
+
+    for (uint32_t i = 0; i < 4U; i++) {
+        uint32_t* value = uut.get(i);
+        TEST_ASSERT_NOT_NULL(value);
+        TEST_ASSERT_EQUAL_UINT32(i * 10U, *value);
+    }
+}
+
+void test_put_assign()
+{
+    LruCache<uint32_t, uint32_t, 4> uut;
+
+    uut.put(1U, 10U);
+    uut.put(2U, 20U);
+    uut.put(1U, 11U);
+    TEST_ASSERT_EQUAL_UINT32(2U, uut.size());
+    TEST_ASSERT_EQUAL_UINT32(11U, *uut.peek(1U));
+
+    // Assigning also marks the entry as used
+    TEST_ASSERT_EQUAL_UINT32(2U, *uut.oldest());
+}
+
+void test_evict_oldest()
+{
+    LruCache<uint32_t, uint32_t, 3> uut;
+
+    uut.put(1U, 1U);
+    uut.put(2U, 2U);
+    uut.put(3U, 3U);
+    TEST_ASSERT_EQUAL_UINT32(1U, *uut.oldest());
+
+    uut.put(4U, 4U);
+    TEST_ASSERT_EQUAL_UINT32(3U, uut.size());
+    TEST_ASSERT_FALSE(uut.contains(1U));
+    TEST_ASSERT_TRUE(uut.contains(2U));
+    TEST_ASSERT_TRUE(uut.contains(4U));
+    TEST_ASSERT_EQUAL_UINT32(2U, *uut.oldest());
+    TEST_ASSERT_EQUAL_UINT32(1U, uut.stats().evictions);
+}
+
+void test_get_refreshes()
+{
+    LruCache<uint32_t, uint32_t, 3> uut;
+
+    uut.put(1U, 1U);
+    uut.put(2U, 2U);
+    uut.put(3U, 3U);
+
+    // 1 becomes the most recent, so 2 is evicted next
+    TEST_ASSERT_NOT_NULL(uut.get(1U));
+    uut.put(4U, 4U);
+    TEST_ASSERT_TRUE(uut.contains(1U));
+    TEST_ASSERT_FALSE(uut.contains(2U));
+
+    // The most recent entry can be refreshed again without change
+    TEST_ASSERT_NOT_NULL(uut.get(4U));
+    TEST_ASSERT_NOT_NULL(uut.get(4U));
+    TEST_ASSERT_EQUAL_UINT32(3U, *uut.oldest());
+}
+
+void test_peek_keeps_order()
+{
+    LruCache<uint32_t, uint32_t, 2> uut;
+
+    uut.put(1U, 1U);
+    uut.put(2U, 2U);
+    TEST_ASSERT_NOT_NULL(uut.peek(1U));
+    TEST_ASSERT_TRUE(uut.contains(1U));
+
+    uut.put(3U, 3U);
+    TEST_ASSERT_FALSE(uut.contains(1U));
+    TEST_ASSERT_EQUAL_UINT32(0U, uut.stats().hits);
+    TEST_ASSERT_EQUAL_UINT32(0U, uut.stats().misses);
+}
+
+struct Config
+{
+    Config(uint32_t b, uint32_t p) : baud(b), parity(p) {}
+
+    uint32_t baud;
+    uint32_t parity;
+};
+
+void test_try_emplace()
+{
+    LruCache<uint32_t, Config, 2> uut;
+
+    TEST_ASSERT_TRUE(uut.tryEmplace(1U, 9600U, 0U));
+    TEST_ASSERT_TRUE(uut.tryEmplace(2U, 115200U, 1U));
+    TEST_ASSERT_FALSE(uut.tryEmplace(1U, 0U, 0U));
+    TEST_ASSERT_EQUAL_UINT32(9600U, uut.peek(1U)->baud);
+
+    // The failed emplace still refreshed key 1
+    TEST_ASSERT_TRUE(uut.tryEmplace(3U, 57600U, 0U));
+    TEST_ASSERT_TRUE(uut.contains(1U));
+    TEST_ASSERT_FALSE(uut.contains(2U));
+}
+
+void test_erase()
+{
+    LruCache<uint32_t, uint32_t, 4> uut;
+
+    for (uint32_t i = 0; i < 4U; i++) {
+        uut.put(i, i);
+    }
+
+    // Erase from the middle, the oldest and the newest end of the list
+    TEST_ASSERT_TRUE(uut.erase(1U));
+    TEST_ASSERT_TRUE(uut.erase(0U));
+    TEST_ASSERT_TRUE(uut.erase(3U));
+    TEST_ASSERT_FALSE(uut.erase(3U));
+    TEST_ASSERT_EQUAL_UINT32(1U, uut.size());
+    TEST_ASSERT_EQUAL_UINT32(2U, *uut.oldest());
+
+    // Freed nodes are reused without evicting
+    for (uint32_t i = 10U; i < 13U; i++) {
+        uut.put(i, i);
+    }
+    TEST_ASSERT_TRUE(uut.contains(2U));
+    TEST_ASSERT_EQUAL_UINT32(0U, uut.stats().evictions);
+}
+
+void test_stats()
+{
+    LruCache<uint32_t, uint32_t, 2> uut;
+
+    uut.put(1U, 1U);
+    uut.get(1U);
+    uut.get(1U);
+    uut.get(2U);
+    uut.put(2U, 2U);
+    uut.put(3U, 3U);
+
+    TEST_ASSERT_EQUAL_UINT32(2U, uut.stats().hits);
+    TEST_ASSERT_EQUAL_UINT32(1U, uut.stats().misses);
+    TEST_ASSERT_EQUAL_UINT32(1U, uut.stats().evictions);
+
+    uut.resetStats();
+    TEST_ASSERT_EQUAL_UINT32(0U, uut.stats().hits);
+    TEST_ASSERT_EQUAL_UINT32(0U, uut.stats().misses);
+    TEST_ASSERT_EQUAL_UINT32(0U, uut.stats().evictions);
+}
+
+int32_t g_live = 0;
+
+void test_destructs()
+{
+    g_live = 0;
+    {
+        LruCache<uint32_t, Tracked, 4> uut;
+        for (uint32_t i = 0; i < 8U; i++) {
+            uut.tryEmplace(i, i);
+        }
+        TEST_ASSERT_EQUAL_INT32(4, g_live);
+
+        TEST_ASSERT_TRUE(uut.erase(7U));
+        TEST_ASSERT_EQUAL_INT32(3, g_live);
+
+        uut.clear();
+        TEST_ASSERT_EQUAL_INT32(0, g_live);
+        TEST_ASSERT_NULL(uut.oldest());
+
+        uut.tryEmplace(1U, 1U);
+    }
+    TEST_ASSERT_EQUAL_INT32(0, g_live);
+}
+
+void test_fuzz()
+{
+#ifdef FUZZ_SEED
+    uint32_t seed = FUZZ_SEED;
+#else
+    uint32_t seed = std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+    std::cout << "Fuzz seed: " << seed << std::endl;
+    std::srand(seed);
+
+    static LruCache<uint32_t, uint32_t, 64> uut;
+
+    // Reference LRU: most recent at the front of the list
+    std::list<std::pair<uint32_t, uint32_t>> order;
+    std::unordered_map<uint32_t, std::list<std::pair<uint32_t, uint32_t>>::iterator> index;
+
+    for (uint32_t op = 0; op < 50000U; op++) {
+        const uint32_t key = static_cast<uint32_t>(std::rand()) % 128U;
+
+        switch (std::rand() % 3) {
+        case 0: {
+            uint32_t* value = uut.get(key);
+            auto it = index.find(key);
+            if (it == index.end()) {
+                TEST_ASSERT_NULL(value);
+            } else {
+                TEST_ASSERT_NOT_NULL(value);
+                TEST_ASSERT_EQUAL_UINT32(it->second->second, *value);
+                order.splice(order.begin(), order, it->second);
+            }
+            break;
+        }
+        case 1: {
+            const uint32_t value = static_cast<uint32_t>(std::rand());
+            uut.put(key, value);
+            auto it = index.find(key);
+            if (it != index.end()) {
+                it->second->second = value;
+                order.splice(order.begin(), order, it->second);
+            } else {
+                if (order.size() == 64U) {
+                    index.erase(order.back().first);
+                    order.pop_back();
+                }
+                order.emplace_front(key, value);
+                index[key] = order.begin();
+            }
+            break;
+        }
+        default: {
+            const bool erased = (index.count(key) != 0);
+            TEST_ASSERT_EQUAL(erased, uut.erase(key));
+            if (erased) {
+                order.erase(index[key]);
+                index.erase(key);
+            }
+            break;
+        }
+        }
+
+        TEST_ASSERT_EQUAL_UINT32(order.size(), uut.size());
+        if (!order.empty()) {
+            TEST_ASSERT_EQUAL_UINT32(order.back().first, *uut.oldest());
+        }
+    }
+}
+
+/// A value which is zeroed when destructed, so reading it afterwards is detected.
+struct Poisoned
+{
+    explicit Poisoned(uint32_t v) : value(v) {}
+    Poisoned(const Poisoned& p) = default;
+    ~Poisoned() { value = 0U; }
+
+    uint32_t value;
+};
+
+void test_put_evicted_value()
+{
+    LruCache<uint32_t, Poisoned, 2> uut;
+    uut.tryEmplace(1U, 10U);
+    uut.tryEmplace(2U, 20U);
+
+    // Copy the value of the entry which is about to be evicted into the new entry
+    uut.put(3U, *uut.peek(*uut.oldest()));
+    TEST_ASSERT_FALSE(uut.contains(1U));
+    TEST_ASSERT_EQUAL_UINT32(10U, uut.peek(3U)->value);
+    TEST_ASSERT_EQUAL_UINT32(20U, uut.peek(2U)->value);
+    TEST_ASSERT_EQUAL_UINT32(1U, uut.stats().evictions);
+
+    uut.put(4U, *uut.peek(*uut.oldest()));
+    TEST_ASSERT_EQUAL_UINT32(20U, uut.peek(4U)->value);
+}
@@ -0,0 +1,230 @@
+/**
+ * @file      test_mpmc_queue.cpp
+ * @brief     This file contains tests for MpmcQueue.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include "unity.h"
+#include "tracked.h"
+
+#include "junk/containers/mpmc_queue.h"
+
+using namespace junk;
+
+void test_empty();
+void test_full();
+void test_drain();
+void test_wrap();
+void test_emplace();
+void test_move_only_type();
+void test_destructs();
+void test_many_threads();
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_empty);
+    RUN_TEST(test_full);
+    RUN_TEST(test_drain);
+    RUN_TEST(test_wrap);
+    RUN_TEST(test_emplace);
+    RUN_TEST(test_move_only_type);
+    RUN_TEST(test_destructs);
+    RUN_TEST(test_many_threads);
+
+    return UNITY_END();
+}
+
+void test_empty()
+{
+    MpmcQueue<uint32_t, 8> uut;
+
+    TEST_ASSERT_EQUAL_UINT32(0, uut.size());
+    TEST_ASSERT_EQUAL_UINT32(8, uut.capacity());
+    TEST_ASSERT_TRUE(uut.isEmpty());
+
+    uint32_t item = 0;
+    TEST_ASSERT_FALSE(uut.dequeue(item));
+}
+
+void test_full()
+{
+    MpmcQueue<uint32_t, 8> uut;
+
+    for (uint8_t i = 0; i < 8; i++) {
+        TEST_ASSERT_EQUAL_UINT32(i, uut.size());
+        TEST_ASSERT_TRUE(uut.enqueue(i));
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(8, uut.size());
+    TEST_ASSERT_FALSE(uut.enqueue(8U));
+}
+
+void test_drain()
+{
+    MpmcQueue<uint32_t, 8> uut;
+
+    for (uint8_t i = 0; i < 8; i++) {
+        TEST_ASSERT_TRUE(uut.enqueue(i));
+    }
+
+    for (uint8_t i = 0; i < 8; i++) {
+        TEST_ASSERT_EQUAL_UINT32((size_t)(8-i), uut.size());
+        uint32_t item = 0;
+        TEST_ASSERT_TRUE(uut.dequeue(item));
+        TEST_ASSERT_EQUAL_UINT32(i, item);
+    }
+
+    TEST_ASSERT(uut.isEmpty());
+}
+
+void test_wrap()
+{
+    // A capacity which is not a power of two
+    MpmcQueue<uint32_t, 3> uut;
+
+    uint32_t next_in = 0;
+    uint32_t next_out = 0;
+    TEST_ASSERT_TRUE(uut.enqueue(next_in++));
+    for (uint8_t i = 0; i < 24; i++) {
+        TEST_ASSERT_TRUE(uut.enqueue(next_in++));
+        TEST_ASSERT_TRUE(uut.enqueue(next_in++));
+        TEST_ASSERT_FALSE(uut.enqueue(next_in));
+
+        uint32_t item = 0;
+        TEST_ASSERT_TRUE(uut.dequeue(item));
+        TEST_ASSERT_EQUAL_UINT32(next_out++, item);
+        TEST_ASSERT_TRUE(uut.dequeue(item));
+        TEST_ASSERT_EQUAL_UINT32(next_out++, item);
+        TEST_ASSERT_EQUAL_UINT32(1, uut.size());
+    }
+}
+
+void test_emplace()
+{
+    class Stuff
+    {
+    public:
+        Stuff(uint32_t a_, uint8_t b_) : a(a_), b(b_) {};
+
+        uint32_t a;
+        uint8_t b;
+    };
+
+    MpmcQueue<Stuff, 8> uut;
+
+    for (uint8_t i = 0; i < 8; i++) {
+        TEST_ASSERT_TRUE(uut.emplace(1234U, i));
+
+        Stuff s(0U,0U);
+        TEST_ASSERT_TRUE(uut.dequeue(s));
+        TEST_ASSERT_EQUAL_UINT32(1234U, s.a);
+        TEST_ASSERT_EQUAL_UINT32(i, s.b);
+    }
+}
+
+void test_move_only_type()
+{
+    MpmcQueue<std::unique_ptr<uint32_t>, 4> uut;
+
+    std::unique_ptr<uint32_t> in(new uint32_t(1234U));
+    TEST_ASSERT_TRUE(uut.enqueue(std::move(in)));
+    TEST_ASSERT_NULL(in.get());
+
+    std::unique_ptr<uint32_t> out;
+    TEST_ASSERT_TRUE(uut.dequeue(out));
+    TEST_ASSERT_NOT_NULL(out.get());
+    TEST_ASSERT_EQUAL_UINT32(1234U, *out);
+}
+
+int32_t g_live = 0;
+
+void test_destructs()
+{
+    g_live = 0;
+    {
+        MpmcQueue<Tracked, 4> uut;
+        for (uint8_t i = 0; i < 4; i++) {
+            TEST_ASSERT_TRUE(uut.emplace());
+        }
+        TEST_ASSERT_EQUAL_INT32(4, g_live);
+
+        Tracked out;
+        TEST_ASSERT_TRUE(uut.dequeue(out));
+        TEST_ASSERT_TRUE(uut.emplace());
+        TEST_ASSERT_EQUAL_INT32(5, g_live);
+    }
+    TEST_ASSERT_EQUAL_INT32(0, g_live);
+}
+
+void test_many_threads()
+{
+    constexpr uint32_t kNumProducers = 4U;
+    constexpr uint32_t kNumConsumers = 4U;
+    constexpr uint32_t kItemsPerProducer = 50000U;
+
+    static MpmcQueue<uint32_t, 64> uut;
+    std::atomic<uint32_t> consumed {0};
+    std::atomic<uint32_t> failures {0};
+    std::atomic<uint64_t> sums[kNumProducers];
+    for (uint32_t p = 0; p < kNumProducers; p++) {
+        sums[p] = 0;
+    }
+
+    // Items are tagged with their producer, each consumer must see every producer's items in order
+    std::thread consumers[kNumConsumers];
+    for (uint32_t c = 0; c < kNumConsumers; c++) {
+        consumers[c] = std::thread([&]() {
+            uint32_t last[kNumProducers] = {};
+            while (consumed.load() < (kNumProducers * kItemsPerProducer)) {
+                uint32_t item = 0;
+                if (!uut.dequeue(item)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                const uint32_t producer = item >> 24;
+                const uint32_t sequence = item & 0xFFFFFFU;
+                if ((producer >= kNumProducers) || (sequence <= last[producer])) {
+                    failures++;
+                } else {
+                    last[producer] = sequence;
+                    sums[producer] += sequence;
+                }
+                consumed++;
+            }
+        });
+    }
+
+    std::thread producers[kNumProducers];
+    for (uint32_t p = 0; p < kNumProducers; p++) {
+        producers[p] = std::thread([&, p]() {
+            for (uint32_t i = 1U; i <= kItemsPerProducer; i++) {
+                while (!uut.enqueue((p << 24) | i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (uint32_t p = 0; p < kNumProducers; p++) {
+        producers[p].join();
+    }
+    for (uint32_t c = 0; c < kNumConsumers; c++) {
+        consumers[c].join();
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(0, failures.load());
+    TEST_ASSERT_TRUE(uut.isEmpty());
+    const uint64_t expected = (uint64_t)kItemsPerProducer * (kItemsPerProducer + 1U) / 2U;
+    for (uint32_t p = 0; p < kNumProducers; p++) {
+        TEST_ASSERT_TRUE(sums[p].load() == expected);
+    }
+}
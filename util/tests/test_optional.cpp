@@ -0,0 +1,140 @@
+/**
+ * @file      test_optional.cpp
+ * @brief     This file contains tests for Optional.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <memory>
+
+#include "unity.h"
+#include "tracked.h"
+
+// Mock JUNK_TRAP
+#define JUNK_TRAP(f,l) g_junk_assert_trap = true
+bool g_junk_assert_trap = false;
+
+#include "junk/containers/optional.h"
+
+using namespace junk;
+
+void test_empty();
+void test_value();
+void test_emplace_reset();
+void test_copy_move();
+void test_move_only_type();
+void test_lifetime();
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_empty);
+    RUN_TEST(test_value);
+    RUN_TEST(test_emplace_reset);
+    RUN_TEST(test_copy_move);
+    RUN_TEST(test_move_only_type);
+    RUN_TEST(test_lifetime);
+
+    return UNITY_END();
+}
+
+void test_empty()
+{
+    Optional<uint32_t> uut;
+
+    TEST_ASSERT_FALSE(uut.hasValue());
+    TEST_ASSERT_FALSE(static_cast<bool>(uut));
+    TEST_ASSERT_EQUAL_UINT32(5, uut.valueOr(5U));
+
+    g_junk_assert_trap = false;
+    *uut;
+    TEST_ASSERT_TRUE(g_junk_assert_trap);
+    g_junk_assert_trap = false;
+}
+
+void test_value()
+{
+    Optional<uint32_t> uut(7U);
+
+    TEST_ASSERT_TRUE(uut.hasValue());
+    TEST_ASSERT_EQUAL_UINT32(7, *uut);
+    TEST_ASSERT_EQUAL_UINT32(7, uut.valueOr(5U));
+
+    *uut = 8U;
+    const Optional<uint32_t>& const_uut = uut;
+    TEST_ASSERT_EQUAL_UINT32(8, *const_uut);
+}
+
+void test_emplace_reset()
+{
+    struct Stuff
+    {
+        Stuff(uint32_t a_, uint8_t b_) : a(a_), b(b_) {};
+
+        uint32_t a;
+        uint8_t b;
+    };
+
+    Optional<Stuff> uut;
+    Stuff& item = uut.emplace(1234U, 5U);
+    TEST_ASSERT_EQUAL_PTR(&item, &*uut);
+    TEST_ASSERT_EQUAL_UINT32(1234, uut->a);
+    TEST_ASSERT_EQUAL_UINT8(5, uut->b);
+
+    uut.reset();
+    TEST_ASSERT_FALSE(uut.hasValue());
+    uut.reset();
+    TEST_ASSERT_FALSE(uut.hasValue());
+}
+
+void test_copy_move()
+{
+    Optional<uint32_t> a(3U);
+    Optional<uint32_t> b(a);
+    TEST_ASSERT_TRUE(b.hasValue());
+    TEST_ASSERT_EQUAL_UINT32(3, *b);
+
+    Optional<uint32_t> empty;
+    b = empty;
+    TEST_ASSERT_FALSE(b.hasValue());
+
+    b = std::move(a);
+    TEST_ASSERT_EQUAL_UINT32(3, *b);
+
+    Optional<uint32_t> c(std::move(empty));
+    TEST_ASSERT_FALSE(c.hasValue());
+}
+
+void test_move_only_type()
+{
+    Optional<std::unique_ptr<uint32_t>> a(std::unique_ptr<uint32_t>(new uint32_t(9U)));
+    Optional<std::unique_ptr<uint32_t>> b(std::move(a));
+
+    TEST_ASSERT_EQUAL_UINT32(9, **b);
+    // A moved from Optional still holds its (moved from) item
+    TEST_ASSERT_TRUE(a.hasValue());
+    TEST_ASSERT_NULL(a->get());
+}
+
+int32_t g_live = 0;
+
+void test_lifetime()
+{
+    g_live = 0;
+    {
+        Optional<Tracked> uut;
+        TEST_ASSERT_EQUAL_INT32(0, g_live);
+        uut.emplace();
+        TEST_ASSERT_EQUAL_INT32(1, g_live);
+        uut.emplace();
+        TEST_ASSERT_EQUAL_INT32(1, g_live);
+
+        Optional<Tracked> copy(uut);
+        TEST_ASSERT_EQUAL_INT32(2, g_live);
+        copy = Optional<Tracked>();
+        TEST_ASSERT_EQUAL_INT32(1, g_live);
+    }
+    TEST_ASSERT_EQUAL_INT32(0, g_live);
+}
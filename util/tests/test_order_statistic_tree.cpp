@@ -0,0 +1,208 @@
+/**
+ * @file      test_order_statistic_tree.cpp
+ * @brief     This file contains tests for OrderStatisticTree.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "unity.h"
+
+#define private public
+#define protected public
+#include "junk/containers/order_statistic_tree.h"
+#undef protected
+#undef private
+
+using namespace junk;
+
+using Tree = OrderStatisticTree<256U, int>;
+
+size_t checkCounts(const Tree::Node* node, bool& valid)
+{
+    if (node == nullptr) {
+        return 0;
+    }
+
+    size_t count = 1 + checkCounts(node->left, valid) + checkCounts(node->right, valid);
+    if (count != node->count) {
+        valid = false;
+    }
+
+    return count;
+}
+
+bool checkCounts(const Tree& tree)
+{
+    bool valid = true;
+    checkCounts(tree.m_root, valid);
+    return valid;
+}
+
+void test_empty();
+void test_select();
+void test_rank();
+void test_count_in_range();
+void test_percentile();
+void test_duplicates();
+void test_fuzzy_insert_erase();
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_empty);
+    RUN_TEST(test_select);
+    RUN_TEST(test_rank);
+    RUN_TEST(test_count_in_range);
+    RUN_TEST(test_percentile);
+    RUN_TEST(test_duplicates);
+    for (uint32_t i = 0; i < 8U; i++) {
+        RUN_TEST(test_fuzzy_insert_erase);
+    }
+
+    return UNITY_END();
+}
+
+void test_empty()
+{
+    Tree uut;
+
+    TEST_ASSERT_EQUAL_UINT32(0U, uut.size());
+    TEST_ASSERT_NULL(uut.select(0));
+    TEST_ASSERT_EQUAL_UINT32(0U, uut.rank(10));
+    TEST_ASSERT_EQUAL_UINT32(0U, uut.countInRange(0, 10));
+    TEST_ASSERT_NULL(uut.percentile(50));
+}
+
+void test_select()
+{
+    Tree uut;
+
+    // Insert in a scrambled order
+    for (int i = 0; i < 200; i++) {
+        TEST_ASSERT_TRUE(uut.insert((i * 37) % 200));
+        TEST_ASSERT_TRUE(checkCounts(uut));
+    }
+
+    for (int i = 0; i < 200; i++) {
+        const int* item = uut.select(i);
+        TEST_ASSERT_NOT_NULL(item);
+        TEST_ASSERT_EQUAL_INT32(i, *item);
+    }
+    TEST_ASSERT_NULL(uut.select(200));
+}
+
+void test_rank()
+{
+    Tree uut;
+
+    for (int i = 0; i < 100; i++) {
+        TEST_ASSERT_TRUE(uut.insert(i * 2));
+    }
+
+    for (int i = 0; i < 100; i++) {
+        TEST_ASSERT_EQUAL_UINT32(i, uut.rank(i * 2));
+        TEST_ASSERT_EQUAL_UINT32(i + 1, uut.rank(i * 2 + 1));
+    }
+    TEST_ASSERT_EQUAL_UINT32(0U, uut.rank(-5));
+    TEST_ASSERT_EQUAL_UINT32(100U, uut.rank(1000));
+}
+
+void test_count_in_range()
+{
+    Tree uut;
+
+    for (int i = 0; i < 100; i++) {
+        TEST_ASSERT_TRUE(uut.insert(i * 2));
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(100U, uut.countInRange(0, 198));
+    TEST_ASSERT_EQUAL_UINT32(100U, uut.countInRange(-10, 1000));
+    TEST_ASSERT_EQUAL_UINT32(6U, uut.countInRange(10, 20));
+    TEST_ASSERT_EQUAL_UINT32(5U, uut.countInRange(11, 20));
+    TEST_ASSERT_EQUAL_UINT32(1U, uut.countInRange(10, 10));
+    TEST_ASSERT_EQUAL_UINT32(0U, uut.countInRange(11, 11));
+    TEST_ASSERT_EQUAL_UINT32(0U, uut.countInRange(20, 10));
+}
+
+void test_percentile()
+{
+    Tree uut;
+
+    for (int i = 1; i <= 100; i++) {
+        TEST_ASSERT_TRUE(uut.insert(i));
+    }
+
+    TEST_ASSERT_EQUAL_INT32(1, *uut.percentile(0));
+    TEST_ASSERT_EQUAL_INT32(1, *uut.percentile(1));
+    TEST_ASSERT_EQUAL_INT32(50, *uut.percentile(50));
+    TEST_ASSERT_EQUAL_INT32(99, *uut.percentile(99));
+    TEST_ASSERT_EQUAL_INT32(100, *uut.percentile(100));
+    TEST_ASSERT_NULL(uut.percentile(101));
+}
+
+void test_duplicates()
+{
+    Tree uut;
+
+    for (int i = 0; i < 10; i++) {
+        TEST_ASSERT_TRUE(uut.insert(5));
+        TEST_ASSERT_TRUE(uut.insert(i));
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(5U, uut.rank(5));
+    TEST_ASSERT_EQUAL_UINT32(11U, uut.countInRange(5, 5));
+    TEST_ASSERT_EQUAL_INT32(5, *uut.select(15));
+    TEST_ASSERT_EQUAL_INT32(6, *uut.select(16));
+}
+
+void test_fuzzy_insert_erase()
+{
+    Tree uut;
+    std::vector<int> reference;
+
+#ifdef FUZZ_SEED
+    uint32_t seed = FUZZ_SEED;
+#else
+    uint32_t seed = std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+    std::cout << "Fuzz seed: " << seed << std::endl;
+    srand(seed);
+
+    // Model a sliding set of samples
+    for (uint32_t i = 0; i < 4096U; i++) {
+        int sample = rand() % 512;
+        if ((reference.size() == 256U) || ((rand() % 3 == 0) && !reference.empty())) {
+            int victim = reference[static_cast<size_t>(rand()) % reference.size()];
+            TEST_ASSERT_TRUE(uut.erase(victim));
+            reference.erase(std::find(reference.begin(), reference.end(), victim));
+        } else {
+            TEST_ASSERT_TRUE(uut.insert(sample));
+            reference.push_back(sample);
+        }
+    }
+    TEST_ASSERT_TRUE(checkCounts(uut));
+    TEST_ASSERT_EQUAL_UINT32(reference.size(), uut.size());
+
+    std::sort(reference.begin(), reference.end());
+    for (size_t k = 0; k < reference.size(); k++) {
+        TEST_ASSERT_EQUAL_INT32(reference[k], *uut.select(k));
+    }
+
+    for (int key = -1; key <= 512; key += 7) {
+        size_t expected = std::lower_bound(reference.begin(), reference.end(), key) -
+                          reference.begin();
+        TEST_ASSERT_EQUAL_UINT32(expected, uut.rank(key));
+
+        size_t in_range = std::upper_bound(reference.begin(), reference.end(), key + 20) -
+                          std::lower_bound(reference.begin(), reference.end(), key);
+        TEST_ASSERT_EQUAL_UINT32(in_range, uut.countInRange(key, key + 20));
+    }
+}
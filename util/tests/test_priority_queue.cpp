@@ -0,0 +1,382 @@
+/**
+ * @file      test_priority_queue.cpp
+ * @brief     This file contains tests for PriorityQueue.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
+
+#include "unity.h"
+#include "tracked.h"
+
+#include "junk/containers/priority_queue.h"
+
+using namespace junk;
+
+void test_empty();
+void test_push_pop_order();
+void test_full();
+void test_top_peek();
+void test_emplace();
+void test_max_heap();
+void test_update();
+void test_erase();
+void test_stale_handle();
+void test_move_only_type();
+void test_destructs();
+void test_fuzz_binary();
+void test_fuzz_octonary();
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_empty);
+    RUN_TEST(test_push_pop_order);
+    RUN_TEST(test_full);
+    RUN_TEST(test_top_peek);
+    RUN_TEST(test_emplace);
+    RUN_TEST(test_max_heap);
+    RUN_TEST(test_update);
+    RUN_TEST(test_erase);
+    RUN_TEST(test_stale_handle);
+    RUN_TEST(test_move_only_type);
+    RUN_TEST(test_destructs);
+    RUN_TEST(test_fuzz_binary);
+    RUN_TEST(test_fuzz_octonary);
+
+    return UNITY_END();
+}
+
+void test_empty()
+{
+    PriorityQueue<uint32_t, 8> uut;
+
+    TEST_ASSERT_TRUE(uut.isEmpty());
+    TEST_ASSERT_FALSE(uut.isFull());
+    TEST_ASSERT_EQUAL_UINT32(0, uut.size());
+    TEST_ASSERT_EQUAL_UINT32(8, uut.capacity());
+
+    uint32_t item = 0;
+    TEST_ASSERT_FALSE(uut.peek(item));
+    TEST_ASSERT_FALSE(uut.pop(item));
+    TEST_ASSERT_FALSE(uut.pop());
+    TEST_ASSERT_FALSE(uut.contains(0));
+    TEST_ASSERT_NULL(uut.find(0));
+}
+
+void test_push_pop_order()
+{
+    PriorityQueue<uint32_t, 32> uut;
+
+    for (uint32_t i = 0; i < 32; i++) {
+        TEST_ASSERT_TRUE(uut.push((i * 13U) % 32U) != uut.kInvalidHandle);
+    }
+
+    for (uint32_t i = 0; i < 32; i++) {
+        uint32_t item = 99U;
+        TEST_ASSERT_TRUE(uut.pop(item));
+        TEST_ASSERT_EQUAL_UINT32(i, item);
+    }
+    TEST_ASSERT_TRUE(uut.isEmpty());
+}
+
+void test_full()
+{
+    PriorityQueue<uint32_t, 4> uut;
+
+    for (uint32_t i = 0; i < 4; i++) {
+        TEST_ASSERT_TRUE(uut.push(i) != uut.kInvalidHandle);
+    }
+    TEST_ASSERT_TRUE(uut.isFull());
+    TEST_ASSERT_TRUE(uut.push(0U) == uut.kInvalidHandle);
+    TEST_ASSERT_EQUAL_UINT32(4, uut.size());
+}
+
+void test_top_peek()
+{
+    PriorityQueue<uint32_t, 8> uut;
+
+    uut.push(5U);
+    uut.push(3U);
+    uut.push(7U);
+
+    TEST_ASSERT_EQUAL_UINT32(3, uut.top());
+    uint32_t item = 0;
+    TEST_ASSERT_TRUE(uut.peek(item));
+    TEST_ASSERT_EQUAL_UINT32(3, item);
+    TEST_ASSERT_EQUAL_UINT32(3, uut.size());
+
+    TEST_ASSERT_TRUE(uut.pop());
+    TEST_ASSERT_EQUAL_UINT32(5, uut.top());
+}
+
+struct Timer
+{
+    Timer(uint32_t d, uint8_t i) : deadline(d), id(i) {}
+
+    uint32_t deadline;
+    uint8_t id;
+};
+
+struct TimerCompare
+{
+    int operator()(const Timer& a, const Timer& b) const
+    {
+        return (a.deadline < b.deadline) ? -1 : ((a.deadline == b.deadline) ? 0 : 1);
+    }
+};
+
+void test_emplace()
+{
+    PriorityQueue<Timer, 8, TimerCompare> uut;
+
+    TEST_ASSERT_TRUE(uut.emplace(300U, 1U) != uut.kInvalidHandle);
+    TEST_ASSERT_TRUE(uut.emplace(100U, 2U) != uut.kInvalidHandle);
+    TEST_ASSERT_TRUE(uut.emplace(200U, 3U) != uut.kInvalidHandle);
+
+    TEST_ASSERT_EQUAL_UINT8(2U, uut.top().id);
+    TEST_ASSERT_TRUE(uut.pop());
+    TEST_ASSERT_EQUAL_UINT8(3U, uut.top().id);
+}
+
+struct Greater
+{
+    int operator()(uint32_t a, uint32_t b) const
+    {
+        return (a > b) ? -1 : ((a == b) ? 0 : 1);
+    }
+};
+
+void test_max_heap()
+{
+    PriorityQueue<uint32_t, 16, Greater, 2> uut;
+
+    for (uint32_t i = 0; i < 16; i++) {
+        uut.push((i * 7U) % 16U);
+    }
+    for (uint32_t i = 16; i > 0; i--) {
+        uint32_t item = 0;
+        TEST_ASSERT_TRUE(uut.pop(item));
+        TEST_ASSERT_EQUAL_UINT32(i - 1U, item);
+    }
+}
+
+void test_update()
+{
+    PriorityQueue<Timer, 8, TimerCompare> uut;
+
+    const auto a = uut.emplace(100U, 1U);
+    const auto b = uut.emplace(200U, 2U);
+    const auto c = uut.emplace(300U, 3U);
+
+    // Bring the last deadline forward
+    TEST_ASSERT_TRUE(uut.update(c, Timer(50U, 3U)));
+    TEST_ASSERT_EQUAL_UINT8(3U, uut.top().id);
+
+    // Push the first deadline back
+    TEST_ASSERT_TRUE(uut.update(c, Timer(400U, 3U)));
+    TEST_ASSERT_TRUE(uut.update(a, Timer(250U, 1U)));
+    TEST_ASSERT_EQUAL_UINT8(2U, uut.top().id);
+    TEST_ASSERT_EQUAL_UINT32(250U, uut.find(a)->deadline);
+
+    uint8_t order[3] = {};
+    for (uint8_t i = 0; i < 3; i++) {
+        order[i] = uut.top().id;
+        TEST_ASSERT_TRUE(uut.pop());
+    }
+    TEST_ASSERT_EQUAL_UINT8(2U, order[0]);
+    TEST_ASSERT_EQUAL_UINT8(1U, order[1]);
+    TEST_ASSERT_EQUAL_UINT8(3U, order[2]);
+    TEST_ASSERT_FALSE(uut.update(b, Timer(0U, 2U)));
+}
+
+void test_erase()
+{
+    PriorityQueue<uint32_t, 16> uut;
+
+    PriorityQueue<uint32_t, 16>::Handle handles[16];
+    for (uint32_t i = 0; i < 16; i++) {
+        handles[i] = uut.push(i);
+    }
+
+    // Erase the top, a leaf and items from the middle of the heap
+    TEST_ASSERT_TRUE(uut.erase(handles[0]));
+    TEST_ASSERT_TRUE(uut.erase(handles[15]));
+    TEST_ASSERT_TRUE(uut.erase(handles[5]));
+    TEST_ASSERT_TRUE(uut.erase(handles[9]));
+    TEST_ASSERT_FALSE(uut.erase(handles[9]));
+    TEST_ASSERT_EQUAL_UINT32(12, uut.size());
+
+    // The remaining handles still find their items
+    for (uint32_t i = 0; i < 16; i++) {
+        const bool erased = (i == 0) || (i == 15) || (i == 5) || (i == 9);
+        TEST_ASSERT_EQUAL(!erased, uut.contains(handles[i]));
+        if (!erased) {
+            TEST_ASSERT_EQUAL_UINT32(i, *uut.find(handles[i]));
+        }
+    }
+
+    uint32_t last = 0;
+    while (!uut.isEmpty()) {
+        uint32_t item = 0;
+        TEST_ASSERT_TRUE(uut.pop(item));
+        TEST_ASSERT_TRUE(item >= last);
+        last = item;
+    }
+}
+
+void test_stale_handle()
+{
+    PriorityQueue<uint32_t, 4> uut;
+
+    const auto handle = uut.push(1U);
+    TEST_ASSERT_TRUE(uut.pop());
+    TEST_ASSERT_FALSE(uut.contains(handle));
+    TEST_ASSERT_FALSE(uut.update(handle, 2U));
+    TEST_ASSERT_FALSE(uut.erase(handle));
+    TEST_ASSERT_FALSE(uut.contains(uut.kInvalidHandle));
+}
+
+struct PtrCompare
+{
+    int operator()(const std::unique_ptr<uint32_t>& a, const std::unique_ptr<uint32_t>& b) const
+    {
+        return (*a < *b) ? -1 : ((*a == *b) ? 0 : 1);
+    }
+};
+
+void test_move_only_type()
+{
+    PriorityQueue<std::unique_ptr<uint32_t>, 8, PtrCompare> uut;
+
+    for (uint32_t i = 0; i < 8; i++) {
+        TEST_ASSERT_TRUE(uut.push(std::unique_ptr<uint32_t>(new uint32_t(7U - i))) !=
+                         uut.kInvalidHandle);
+    }
+
+    for (uint32_t i = 0; i < 8; i++) {
+        std::unique_ptr<uint32_t> out;
+        TEST_ASSERT_TRUE(uut.pop(out));
+        TEST_ASSERT_EQUAL_UINT32(i, *out);
+    }
+}
+
+int32_t g_live = 0;
+
+void test_destructs()
+{
+    g_live = 0;
+    {
+        PriorityQueue<Tracked, 8> uut;
+        for (uint32_t i = 0; i < 8; i++) {
+            uut.emplace(8U - i);
+        }
+        TEST_ASSERT_EQUAL_INT32(8, g_live);
+
+        TEST_ASSERT_TRUE(uut.pop());
+        TEST_ASSERT_TRUE(uut.erase(uut.push(Tracked(3U))));
+        TEST_ASSERT_EQUAL_INT32(7, g_live);
+
+        uut.clear();
+        TEST_ASSERT_EQUAL_INT32(0, g_live);
+        uut.emplace(1U);
+    }
+    TEST_ASSERT_EQUAL_INT32(0, g_live);
+}
+
+template <size_t Arity>
+void fuzz()
+{
+#ifdef FUZZ_SEED
+    uint32_t seed = FUZZ_SEED;
+#else
+    uint32_t seed = std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+    std::cout << "Fuzz seed: " << seed << std::endl;
+    std::srand(seed);
+
+    using Queue = PriorityQueue<uint32_t, 128, util::ThreeWayCompare, Arity>;
+    static Queue uut;
+    uut.clear();
+    std::map<typename Queue::Handle, uint32_t> reference;
+
+    for (uint32_t op = 0; op < 20000U; op++) {
+        const uint32_t value = static_cast<uint32_t>(std::rand()) % 1000U;
+
+        switch (std::rand() % 4) {
+        case 0: {
+            const auto handle = uut.push(value);
+            TEST_ASSERT_EQUAL(reference.size() < 128U, handle != uut.kInvalidHandle);
+            if (handle != uut.kInvalidHandle) {
+                TEST_ASSERT_EQUAL_UINT32(0, reference.count(handle));
+                reference[handle] = value;
+            }
+            break;
+        }
+        case 1: {
+            uint32_t item = 0;
+            TEST_ASSERT_EQUAL(!reference.empty(), uut.pop(item));
+            if (!reference.empty()) {
+                // The popped item is the smallest, drop one reference entry holding it
+                auto smallest = reference.begin();
+                for (auto it = reference.begin(); it != reference.end(); ++it) {
+                    if (it->second < smallest->second) {
+                        smallest = it;
+                    }
+                }
+                TEST_ASSERT_EQUAL_UINT32(smallest->second, item);
+                for (auto it = reference.begin(); it != reference.end(); ++it) {
+                    if ((it->second == item) && !uut.contains(it->first)) {
+                        reference.erase(it);
+                        break;
+                    }
+                }
+            }
+            break;
+        }
+        case 2: {
+            if (!reference.empty()) {
+                auto it = reference.begin();
+                std::advance(it, std::rand() % reference.size());
+                TEST_ASSERT_TRUE(uut.update(it->first, value));
+                it->second = value;
+            }
+            break;
+        }
+        default: {
+            if (!reference.empty()) {
+                auto it = reference.begin();
+                std::advance(it, std::rand() % reference.size());
+                TEST_ASSERT_TRUE(uut.erase(it->first));
+                reference.erase(it);
+            }
+            break;
+        }
+        }
+
+        TEST_ASSERT_EQUAL_UINT32(reference.size(), uut.size());
+    }
+
+    for (const auto& entry : reference) {
+        TEST_ASSERT_NOT_NULL(uut.find(entry.first));
+        TEST_ASSERT_EQUAL_UINT32(entry.second, *uut.find(entry.first));
+    }
+}
+
+void test_fuzz_binary()
+{
+    fuzz<2>();
+}
+
+void test_fuzz_octonary()
+{
+    fuzz<8>();
+}
@@ -6,7 +6,10 @@
  * @copyright Copyright (c) 2018 Liam Bucci. See included LICENSE file.
  */
 
+#include <string>
+
 #include "unity.h"
+#include "tracked.h"
 
 // Mock JUNK_TRAP
 #define JUNK_TRAP(f,l) g_junk_assert_trap = true
@@ -20,13 +23,32 @@ void test_empty();
 void test_full();
 void test_drain();
 void test_wrap();
+void test_wrap_non_pow2();
 void test_peek();
 void test_enqueue_move();
 void test_emplace();
+void test_bulk();
+void test_bulk_wrap();
+void test_bulk_non_trivial();
+void test_reserve_commit();
+void test_peek_release();
+void test_release_non_trivial();
+void test_overwrite();
+void test_overwrite_bulk();
+void test_overwrite_non_trivial();
 void test_trivial_type();
 void test_pod_type();
 void test_non_pod_type();
 void test_derived_type();
+void test_at();
+void test_at_out_of_range();
+void test_segments();
+void test_front();
+void test_try_dequeue();
+void test_consume();
+void test_no_copies();
+void test_overwrite_from_front();
+void test_reject_no_counter();
 
 int main(int argc, char** argv)
 {
@@ -36,13 +58,32 @@ int main(int argc, char** argv)
     RUN_TEST(test_full);
     RUN_TEST(test_drain);
     RUN_TEST(test_wrap);
+    RUN_TEST(test_wrap_non_pow2);
     RUN_TEST(test_peek);
     RUN_TEST(test_enqueue_move);
     RUN_TEST(test_emplace);
+    RUN_TEST(test_bulk);
+    RUN_TEST(test_bulk_wrap);
+    RUN_TEST(test_bulk_non_trivial);
+    RUN_TEST(test_reserve_commit);
+    RUN_TEST(test_peek_release);
+    RUN_TEST(test_release_non_trivial);
+    RUN_TEST(test_overwrite);
+    RUN_TEST(test_overwrite_bulk);
+    RUN_TEST(test_overwrite_non_trivial);
     RUN_TEST(test_trivial_type);
     RUN_TEST(test_pod_type);
     RUN_TEST(test_non_pod_type);
     RUN_TEST(test_derived_type);
+    RUN_TEST(test_at);
+    RUN_TEST(test_at_out_of_range);
+    RUN_TEST(test_segments);
+    RUN_TEST(test_front);
+    RUN_TEST(test_try_dequeue);
+    RUN_TEST(test_consume);
+    RUN_TEST(test_no_copies);
+    RUN_TEST(test_overwrite_from_front);
+    RUN_TEST(test_reject_no_counter);
 
     return UNITY_END();
 }
@@ -105,6 +146,31 @@ void test_wrap()
     }
 }
 
+void test_wrap_non_pow2()
+{
+    // Five slots are tracked by wrapping indices and a count rather than by masked positions
+    Queue<uint32_t, 5> uut;
+
+    uint32_t next_in = 0;
+    uint32_t next_out = 0;
+    for (uint8_t i = 0; i < 3; i++) {
+        TEST_ASSERT_TRUE(uut.enqueue(next_in++));
+    }
+    for (uint8_t i = 0; i < 24; i++) {
+        TEST_ASSERT_TRUE(uut.enqueue(next_in++));
+        TEST_ASSERT_TRUE(uut.enqueue(next_in++));
+        TEST_ASSERT_TRUE(uut.isFull());
+        TEST_ASSERT_FALSE(uut.enqueue(next_in));
+
+        uint32_t item = 0;
+        TEST_ASSERT_TRUE(uut.dequeue(item));
+        TEST_ASSERT_EQUAL_UINT32(next_out++, item);
+        TEST_ASSERT_TRUE(uut.dequeue(item));
+        TEST_ASSERT_EQUAL_UINT32(next_out++, item);
+        TEST_ASSERT_EQUAL_UINT32(3, uut.size());
+    }
+}
+
 void test_peek()
 {
     Queue<uint32_t, 8> uut;
@@ -129,6 +195,9 @@ void test_enqueue_move()
     class Moveable
     {
     public:
+        Moveable() = default;
+        Moveable(Moveable&& m) : a(m.a) { m.a = 0; }
+
         Moveable& operator =(Moveable&& m)
         {
             a = m.a;
@@ -176,6 +245,295 @@ void test_emplace()
     }
 }
 
+void test_bulk()
+{
+    Queue<uint8_t, 16> uut;
+
+    uint8_t in[24];
+    for (uint8_t i = 0; i < 24; i++) {
+        in[i] = i;
+    }
+
+    // Only as many items as fit are stored
+    TEST_ASSERT_EQUAL_UINT32(10, uut.enqueueBulk(Span<const uint8_t>(in, 10)));
+    TEST_ASSERT_EQUAL_UINT32(6, uut.enqueueBulk(Span<const uint8_t>(in + 10, 14)));
+    TEST_ASSERT_TRUE(uut.isFull());
+    TEST_ASSERT_EQUAL_UINT32(0, uut.enqueueBulk(Span<const uint8_t>(in, 1)));
+
+    // Only as many items as are queued are retrieved
+    uint8_t out[24] = {};
+    TEST_ASSERT_EQUAL_UINT32(4, uut.dequeueBulk(Span<uint8_t>(out, 4)));
+    TEST_ASSERT_EQUAL_UINT32(12, uut.dequeueBulk(Span<uint8_t>(out + 4, 20)));
+    TEST_ASSERT_TRUE(uut.isEmpty());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(in, out, 16);
+    TEST_ASSERT_EQUAL_UINT32(0, uut.dequeueBulk(Span<uint8_t>(out, 1)));
+}
+
+void test_bulk_wrap()
+{
+    // Both a masked and a wrapping capacity, with runs split across the end of the storage
+    Queue<uint32_t, 8> pow2;
+    Queue<uint32_t, 7> general;
+
+    uint32_t next_in = 0;
+    uint32_t next_out = 0;
+    for (uint8_t round = 0; round < 20; round++) {
+        uint32_t in[5];
+        for (uint8_t i = 0; i < 5; i++) {
+            in[i] = next_in++;
+        }
+        TEST_ASSERT_EQUAL_UINT32(5, pow2.enqueueBulk(Span<const uint32_t>(in)));
+        TEST_ASSERT_EQUAL_UINT32(5, general.enqueueBulk(Span<const uint32_t>(in)));
+
+        uint32_t out_pow2[5] = {};
+        uint32_t out_general[5] = {};
+        TEST_ASSERT_EQUAL_UINT32(5, pow2.dequeueBulk(Span<uint32_t>(out_pow2)));
+        TEST_ASSERT_EQUAL_UINT32(5, general.dequeueBulk(Span<uint32_t>(out_general)));
+        for (uint8_t i = 0; i < 5; i++) {
+            TEST_ASSERT_EQUAL_UINT32(next_out, out_pow2[i]);
+            TEST_ASSERT_EQUAL_UINT32(next_out, out_general[i]);
+            next_out++;
+        }
+
+        // Single item operations stay in step with the bulk ones
+        TEST_ASSERT_TRUE(pow2.enqueue(next_in));
+        TEST_ASSERT_TRUE(general.enqueue(next_in));
+        next_in++;
+        uint32_t item = 0;
+        TEST_ASSERT_TRUE(pow2.dequeue(item));
+        TEST_ASSERT_EQUAL_UINT32(next_out, item);
+        TEST_ASSERT_TRUE(general.dequeue(item));
+        TEST_ASSERT_EQUAL_UINT32(next_out, item);
+        next_out++;
+    }
+}
+
+int32_t g_live = 0;
+
+void test_bulk_non_trivial()
+{
+    g_live = 0;
+    {
+        Queue<Tracked, 6> uut;
+        Tracked in[4] = {1U, 2U, 3U, 4U};
+        Tracked out[4];
+        TEST_ASSERT_EQUAL_INT32(8, g_live);
+
+        TEST_ASSERT_EQUAL_UINT32(4, uut.enqueueBulk(Span<const Tracked>(in)));
+        TEST_ASSERT_EQUAL_INT32(12, g_live);
+        TEST_ASSERT_EQUAL_UINT32(3, uut.dequeueBulk(Span<Tracked>(out, 3)));
+        TEST_ASSERT_EQUAL_INT32(9, g_live);
+
+        // Wraps around the end of the six slots
+        TEST_ASSERT_EQUAL_UINT32(4, uut.enqueueBulk(Span<const Tracked>(in)));
+        TEST_ASSERT_EQUAL_UINT32(4, uut.dequeueBulk(Span<Tracked>(out)));
+        TEST_ASSERT_EQUAL_UINT32(4, out[0].value);
+        TEST_ASSERT_EQUAL_UINT32(1, out[1].value);
+        TEST_ASSERT_EQUAL_UINT32(3, out[3].value);
+        TEST_ASSERT_EQUAL_INT32(9, g_live);
+    }
+    TEST_ASSERT_EQUAL_INT32(0, g_live);
+}
+
+void test_reserve_commit()
+{
+    Queue<uint8_t, 10> uut;
+
+    // Move the positions to slot 6 so a reservation runs into the end of the storage
+    for (uint8_t i = 0; i < 6; i++) {
+        TEST_ASSERT_TRUE(uut.enqueue(i));
+    }
+    uint8_t scratch[6];
+    TEST_ASSERT_EQUAL_UINT32(6, uut.dequeueBulk(Span<uint8_t>(scratch)));
+
+    Span<uint8_t> region = uut.reserve(8);
+    TEST_ASSERT_EQUAL_UINT32(4, region.length());
+    for (uint8_t i = 0; i < 4; i++) {
+        region[i] = 100U + i;
+    }
+
+    // Nothing is queued until committed, and no more than the region can be committed
+    TEST_ASSERT_TRUE(uut.isEmpty());
+    TEST_ASSERT_FALSE(uut.commit(5));
+    TEST_ASSERT_TRUE(uut.commit(4));
+    TEST_ASSERT_EQUAL_UINT32(4, uut.size());
+
+    // The next reservation starts at the front, and is limited by the free space
+    region = uut.reserve(20);
+    TEST_ASSERT_EQUAL_UINT32(6, region.length());
+    region[0] = 104U;
+    region[1] = 105U;
+    TEST_ASSERT_TRUE(uut.commit(2));
+
+    region = uut.reserve(4);
+    TEST_ASSERT_EQUAL_UINT32(4, region.length());
+    TEST_ASSERT_TRUE(uut.commit(4));
+    TEST_ASSERT_TRUE(uut.isFull());
+    TEST_ASSERT_EQUAL_UINT32(0, uut.reserve(1).length());
+    TEST_ASSERT_TRUE(uut.commit(0));
+
+    for (uint8_t i = 0; i < 6; i++) {
+        uint8_t item = 0;
+        TEST_ASSERT_TRUE(uut.dequeue(item));
+        TEST_ASSERT_EQUAL_UINT8(100U + i, item);
+    }
+}
+
+void test_peek_release()
+{
+    Queue<uint8_t, 8> uut;
+
+    TEST_ASSERT_EQUAL_UINT32(0, uut.peekContiguous().length());
+    TEST_ASSERT_FALSE(uut.release(1));
+
+    // Five items starting at slot 5 are stored as a run of three and a run of two
+    uint8_t in[5] = {1U, 2U, 3U, 4U, 5U};
+    uint8_t scratch[5];
+    TEST_ASSERT_EQUAL_UINT32(5, uut.enqueueBulk(Span<const uint8_t>(in)));
+    TEST_ASSERT_EQUAL_UINT32(5, uut.dequeueBulk(Span<uint8_t>(scratch)));
+    TEST_ASSERT_EQUAL_UINT32(5, uut.enqueueBulk(Span<const uint8_t>(in)));
+
+    Span<const uint8_t> region = uut.peekContiguous();
+    TEST_ASSERT_EQUAL_UINT32(3, region.length());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(in, region.cget(), 3);
+    TEST_ASSERT_EQUAL_UINT32(5, uut.size());
+
+    TEST_ASSERT_TRUE(uut.release(2));
+    region = uut.peekContiguous();
+    TEST_ASSERT_EQUAL_UINT32(1, region.length());
+    TEST_ASSERT_EQUAL_UINT8(3U, region[0]);
+    TEST_ASSERT_TRUE(uut.release(1));
+
+    region = uut.peekContiguous();
+    TEST_ASSERT_EQUAL_UINT32(2, region.length());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(&in[3], region.cget(), 2);
+    TEST_ASSERT_FALSE(uut.release(3));
+    TEST_ASSERT_TRUE(uut.release(2));
+    TEST_ASSERT_TRUE(uut.isEmpty());
+}
+
+void test_release_non_trivial()
+{
+    g_live = 0;
+    {
+        Queue<Tracked, 4> uut;
+        for (uint32_t i = 0; i < 3; i++) {
+            TEST_ASSERT_TRUE(uut.emplace(i));
+        }
+        Tracked out;
+        TEST_ASSERT_TRUE(uut.dequeue(out));
+        TEST_ASSERT_TRUE(uut.emplace(3U));
+        TEST_ASSERT_TRUE(uut.emplace(4U));
+        TEST_ASSERT_EQUAL_INT32(5, g_live);
+
+        // Released items are destructed, across the end of the storage
+        TEST_ASSERT_TRUE(uut.release(3));
+        TEST_ASSERT_EQUAL_INT32(2, g_live);
+        TEST_ASSERT_EQUAL_UINT32(4, uut.peekContiguous()[0].value);
+    }
+    TEST_ASSERT_EQUAL_INT32(0, g_live);
+}
+
+void test_overwrite()
+{
+    // Both a masked and a wrapping capacity keep the latest items
+    Queue<uint32_t, 4, QueueFullPolicy::kOverwrite> pow2;
+    Queue<uint32_t, 3, QueueFullPolicy::kOverwrite> general;
+
+    for (uint32_t i = 0; i < 10; i++) {
+        TEST_ASSERT_TRUE(pow2.enqueue(i));
+        TEST_ASSERT_TRUE(general.emplace(i));
+    }
+    TEST_ASSERT_TRUE(pow2.isFull());
+    TEST_ASSERT_EQUAL_UINT32(6, pow2.dropped());
+    TEST_ASSERT_EQUAL_UINT32(7, general.dropped());
+
+    uint32_t item = 0;
+    for (uint32_t i = 6; i < 10; i++) {
+        TEST_ASSERT_TRUE(pow2.dequeue(item));
+        TEST_ASSERT_EQUAL_UINT32(i, item);
+    }
+    for (uint32_t i = 7; i < 10; i++) {
+        TEST_ASSERT_TRUE(general.dequeue(item));
+        TEST_ASSERT_EQUAL_UINT32(i, item);
+    }
+
+    // Nothing is dropped while there is room
+    pow2.resetDropped();
+    TEST_ASSERT_TRUE(pow2.enqueue(1U));
+    TEST_ASSERT_EQUAL_UINT32(0, pow2.dropped());
+
+    // A rejecting queue never counts drops
+    Queue<uint32_t, 1> reject;
+    TEST_ASSERT_TRUE(reject.enqueue(1U));
+    TEST_ASSERT_FALSE(reject.enqueue(2U));
+    TEST_ASSERT_EQUAL_UINT32(0, reject.dropped());
+}
+
+void test_overwrite_bulk()
+{
+    Queue<uint8_t, 8, QueueFullPolicy::kOverwrite> uut;
+
+    uint8_t in[12];
+    for (uint8_t i = 0; i < 12; i++) {
+        in[i] = i;
+    }
+
+    // Old items are dropped to fit the new ones
+    TEST_ASSERT_EQUAL_UINT32(6, uut.enqueueBulk(Span<const uint8_t>(in, 6)));
+    TEST_ASSERT_EQUAL_UINT32(5, uut.enqueueBulk(Span<const uint8_t>(in + 6, 5)));
+    TEST_ASSERT_EQUAL_UINT32(3, uut.dropped());
+    uint8_t out[8] = {};
+    TEST_ASSERT_EQUAL_UINT32(8, uut.dequeueBulk(Span<uint8_t>(out)));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(&in[3], out, 8);
+
+    // More items than fit at all, only the last eight are kept
+    uut.resetDropped();
+    TEST_ASSERT_TRUE(uut.enqueue(99U));
+    TEST_ASSERT_EQUAL_UINT32(12, uut.enqueueBulk(Span<const uint8_t>(in)));
+    TEST_ASSERT_EQUAL_UINT32(5, uut.dropped());
+    TEST_ASSERT_EQUAL_UINT32(8, uut.dequeueBulk(Span<uint8_t>(out)));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(&in[4], out, 8);
+}
+
+void test_overwrite_non_trivial()
+{
+    g_live = 0;
+    {
+        Queue<Tracked, 3, QueueFullPolicy::kOverwrite> uut;
+        for (uint32_t i = 0; i < 5; i++) {
+            TEST_ASSERT_TRUE(uut.emplace(i));
+        }
+        TEST_ASSERT_EQUAL_INT32(3, g_live);
+        TEST_ASSERT_EQUAL_UINT32(2, uut.dropped());
+        TEST_ASSERT_EQUAL_UINT32(2, uut.peekContiguous()[0].value);
+
+        // Copies are constructed in the slot of the dropped item, never assigned over it
+        const Tracked in(9U);
+        TEST_ASSERT_TRUE(uut.enqueue(in));
+        TEST_ASSERT_EQUAL_INT32(4, g_live);
+        TEST_ASSERT_EQUAL_UINT32(3, uut.front().value);
+        TEST_ASSERT_TRUE(uut.enqueue(Tracked(10U)));
+        TEST_ASSERT_EQUAL_INT32(4, g_live);
+        TEST_ASSERT_TRUE(uut.enqueue(std::move(in)));
+        TEST_ASSERT_EQUAL_INT32(4, g_live);
+        TEST_ASSERT_EQUAL_UINT32(5, uut.dropped());
+        TEST_ASSERT_EQUAL_UINT32(9, uut.at(0).value);
+        TEST_ASSERT_EQUAL_UINT32(10, uut.at(1).value);
+        TEST_ASSERT_EQUAL_UINT32(9, uut.at(2).value);
+    }
+    TEST_ASSERT_EQUAL_INT32(0, g_live);
+
+    // Items owning memory, a use after free if the dropped slot were assigned to
+    Queue<std::string, 2, QueueFullPolicy::kOverwrite> strings;
+    const std::string a(64U, 'a');
+    for (uint32_t i = 0; i < 4; i++) {
+        TEST_ASSERT_TRUE(strings.enqueue(a));
+    }
+    TEST_ASSERT_EQUAL_UINT32(2, strings.dropped());
+    TEST_ASSERT_TRUE(strings.front() == a);
+}
+
 void test_trivial_type()
 {
     Queue<uint32_t, 1> uut;
@@ -249,3 +607,240 @@ void test_derived_type()
     TEST_ASSERT_EQUAL_UINT32(1234U, out.a);
     TEST_ASSERT_EQUAL_UINT8(255U, out.b);
 }
+
+template <typename Q>
+void checkAt(Q& uut)
+{
+    // Six items starting at slot 5 wrap around the end of the storage
+    for (uint32_t i = 0; i < 5; i++) {
+        uut.enqueue(0U);
+    }
+    uut.release(5);
+    for (uint32_t i = 0; i < 6; i++) {
+        uut.enqueue(i);
+    }
+
+    for (uint32_t i = 0; i < 6; i++) {
+        TEST_ASSERT_EQUAL_UINT32(i, uut.at(i));
+        TEST_ASSERT_EQUAL_UINT32(5U - i, uut.atBack(i));
+    }
+
+    uut.at(4) = 40U;
+    const Q& const_uut = uut;
+    TEST_ASSERT_EQUAL_UINT32(40, const_uut.at(4));
+    TEST_ASSERT_EQUAL_UINT32(40, const_uut.atBack(1));
+}
+
+void test_at()
+{
+    Queue<uint32_t, 8> pow2;
+    checkAt(pow2);
+
+    Queue<uint32_t, 7> general;
+    checkAt(general);
+}
+
+void test_at_out_of_range()
+{
+    Queue<uint32_t, 4> uut;
+    uut.enqueue(1U);
+
+    g_junk_assert_trap = false;
+    uut.at(0);
+    uut.atBack(0);
+    TEST_ASSERT_FALSE(g_junk_assert_trap);
+    uut.at(1);
+    TEST_ASSERT_TRUE(g_junk_assert_trap);
+    g_junk_assert_trap = false;
+    uut.atBack(1);
+    TEST_ASSERT_TRUE(g_junk_assert_trap);
+    g_junk_assert_trap = false;
+}
+
+void test_segments()
+{
+    Queue<uint8_t, 8> uut;
+    Span<const uint8_t> first;
+    Span<const uint8_t> second;
+
+    uut.segments(first, second);
+    TEST_ASSERT_EQUAL_UINT32(0, first.length());
+    TEST_ASSERT_EQUAL_UINT32(0, second.length());
+
+    uint8_t in[5] = {1U, 2U, 3U, 4U, 5U};
+    uut.enqueueBulk(Span<const uint8_t>(in));
+    uut.segments(first, second);
+    TEST_ASSERT_EQUAL_UINT32(5, first.length());
+    TEST_ASSERT_EQUAL_UINT32(0, second.length());
+
+    // Starting at slot 5, the items are split three and two
+    uut.release(5);
+    uut.enqueueBulk(Span<const uint8_t>(in));
+    uut.segments(first, second);
+    TEST_ASSERT_EQUAL_UINT32(3, first.length());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(in, first.cget(), 3);
+    TEST_ASSERT_EQUAL_UINT32(2, second.length());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(&in[3], second.cget(), 2);
+}
+
+void test_front()
+{
+    Queue<uint32_t, 4> uut;
+
+    g_junk_assert_trap = false;
+    uut.front();
+    TEST_ASSERT_TRUE(g_junk_assert_trap);
+    g_junk_assert_trap = false;
+
+    uut.enqueue(1U);
+    uut.enqueue(2U);
+    TEST_ASSERT_EQUAL_UINT32(1, uut.front());
+
+    // The reference is to the item in the queue
+    uut.front() = 10U;
+    const Queue<uint32_t, 4>& const_uut = uut;
+    TEST_ASSERT_EQUAL_UINT32(10, const_uut.front());
+    TEST_ASSERT_EQUAL_UINT32(2, uut.size());
+    TEST_ASSERT_FALSE(g_junk_assert_trap);
+}
+
+void test_try_dequeue()
+{
+    struct NoDefault
+    {
+        explicit NoDefault(uint32_t a_) : a(a_) {};
+        uint32_t a;
+    };
+
+    Queue<NoDefault, 3> uut;
+    TEST_ASSERT_FALSE(uut.tryDequeue().hasValue());
+
+    for (uint32_t i = 0; i < 5; i++) {
+        uut.emplace(i);
+        Optional<NoDefault> item = uut.tryDequeue();
+        TEST_ASSERT_TRUE(item.hasValue());
+        TEST_ASSERT_EQUAL_UINT32(i, item->a);
+    }
+    TEST_ASSERT_TRUE(uut.isEmpty());
+    TEST_ASSERT_FALSE(uut.tryDequeue());
+}
+
+void test_consume()
+{
+    g_live = 0;
+    {
+        Queue<Tracked, 4> uut;
+        uint32_t seen = 0;
+
+        TEST_ASSERT_FALSE(uut.consume([&](Tracked& t) { seen = t.value; }));
+        TEST_ASSERT_EQUAL_UINT32(0, seen);
+
+        uut.emplace(7U);
+        uut.emplace(8U);
+        TEST_ASSERT_EQUAL_INT32(2, g_live);
+        TEST_ASSERT_TRUE(uut.consume([&](Tracked& t) { seen = t.value; }));
+        TEST_ASSERT_EQUAL_UINT32(7, seen);
+        TEST_ASSERT_EQUAL_INT32(1, g_live);
+        TEST_ASSERT_EQUAL_UINT32(8, uut.front().value);
+    }
+    TEST_ASSERT_EQUAL_INT32(0, g_live);
+}
+
+/// Counts the copies and moves made of it.
+struct Counted
+{
+    static uint32_t copies;
+    static uint32_t moves;
+
+    explicit Counted(uint32_t v) : value(v) {}
+    Counted(const Counted& c) : value(c.value) { copies++; }
+    Counted(Counted&& c) : value(c.value) { moves++; }
+    Counted& operator =(const Counted& c) { value = c.value; copies++; return *this; }
+    Counted& operator =(Counted&& c) { value = c.value; moves++; return *this; }
+
+    uint32_t value;
+};
+
+uint32_t Counted::copies = 0;
+uint32_t Counted::moves = 0;
+
+void test_no_copies()
+{
+    Queue<Counted, 4> uut;
+    Counted::copies = 0;
+    Counted::moves = 0;
+
+    uut.emplace(1U);
+    uut.emplace(2U);
+    uut.enqueue(Counted(3U));
+    TEST_ASSERT_EQUAL_UINT32(0, Counted::copies);
+    TEST_ASSERT_EQUAL_UINT32(1, Counted::moves);
+
+    // Looking at the front, consuming and taking an item never copy
+    TEST_ASSERT_EQUAL_UINT32(1, uut.front().value);
+    uint32_t seen = 0;
+    uut.consume([&](const Counted& c) { seen = c.value; });
+    TEST_ASSERT_EQUAL_UINT32(1, seen);
+    Optional<Counted> item = uut.tryDequeue();
+    TEST_ASSERT_EQUAL_UINT32(2, item->value);
+    TEST_ASSERT_EQUAL_UINT32(0, Counted::copies);
+    TEST_ASSERT_EQUAL_UINT32(2, Counted::moves);
+}
+
+/// A value which is set to -1 when destructed, so reading it afterwards is detected.
+struct Poisoned
+{
+    explicit Poisoned(int32_t v) : value(v) {}
+    Poisoned(const Poisoned& p) = default;
+    Poisoned(Poisoned&& p) = default;
+    ~Poisoned() { value = -1; }
+
+    int32_t value;
+};
+
+template <size_t S>
+void checkOverwriteFromFront()
+{
+    Queue<Poisoned, S, QueueFullPolicy::kOverwrite> uut;
+    for (size_t i = 0; i < S; i++) {
+        uut.emplace(static_cast<int32_t>(10U + i));
+    }
+
+    // The oldest item is copied before it is dropped to make room
+    TEST_ASSERT_TRUE(uut.enqueue(uut.front()));
+    TEST_ASSERT_EQUAL_INT32(10, uut.atBack(0).value);
+    TEST_ASSERT_TRUE(uut.enqueue(uut.at(0)));
+    TEST_ASSERT_EQUAL_INT32(11, uut.atBack(0).value);
+    TEST_ASSERT_TRUE(uut.enqueue(std::move(uut.front())));
+    TEST_ASSERT_EQUAL_INT32(12, uut.atBack(0).value);
+    TEST_ASSERT_EQUAL_UINT32(3, uut.dropped());
+    TEST_ASSERT_EQUAL_UINT32(S, uut.size());
+}
+
+void test_overwrite_from_front()
+{
+    checkOverwriteFromFront<4>();
+    checkOverwriteFromFront<5>();
+
+    Queue<std::string, 2, QueueFullPolicy::kOverwrite> strings;
+    const std::string a(64U, 'a');
+    TEST_ASSERT_TRUE(strings.enqueue(a));
+    TEST_ASSERT_TRUE(strings.enqueue(std::string(64U, 'b')));
+    TEST_ASSERT_TRUE(strings.enqueue(strings.front()));
+    TEST_ASSERT_TRUE(strings.atBack(0) == a);
+}
+
+void test_reject_no_counter()
+{
+    // Only an overwriting queue pays for the dropped counter
+    TEST_ASSERT_EQUAL_UINT32(sizeof(QueueIndices<8>) + (8U * sizeof(uint32_t)),
+                             sizeof(Queue<uint32_t, 8>));
+    TEST_ASSERT_EQUAL_UINT32(sizeof(Queue<uint32_t, 8>) + sizeof(size_t),
+                             sizeof(Queue<uint32_t, 8, QueueFullPolicy::kOverwrite>));
+
+    Queue<uint32_t, 2> uut;
+    for (uint32_t i = 0; i < 3; i++) {
+        uut.enqueue(i);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, uut.dropped());
+}
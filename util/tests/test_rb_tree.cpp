@@ -30,11 +30,11 @@ std::ostream &operator<<(std::ostream &os, KeyPair<Key,Value> const &pair) {
     return os << '{' << pair.key << ',' << pair.value << '}';
 }
 
-template <size_t N, typename T>
-void printNode(typename RbTree<N,T>::Node* node)
+template <size_t N, typename T, typename C = util::ThreeWayCompare, typename K = util::Identity, typename A = NoAugmentation>
+void printNode(typename PooledRbTree<N,T,C,K,A>::Node* node)
 {
     std::cout << '{' << node->item << ':';
-    if (node->color == RbTree<N,T>::Node::Color::kBlack) {
+    if (node->color == PooledRbTree<N,T,C,K,A>::Node::Color::kBlack) {
         std::cout << 'B';
     } else {
         std::cout << 'R';
@@ -43,30 +43,30 @@ void printNode(typename RbTree<N,T>::Node* node)
 }
 
 uint32_t g_depth = 0;
-template <size_t N, typename T>
-void printTree(typename RbTree<N,T>::Node* node)
+template <size_t N, typename T, typename C = util::ThreeWayCompare, typename K = util::Identity, typename A = NoAugmentation>
+void printTree(typename PooledRbTree<N,T,C,K,A>::Node* node)
 {
     if ((node->left == nullptr) && (node->right == nullptr)) {
         std::cout << "leaf" << std::endl;
-        printNode<N,T>(node);
+        printNode<N,T,C,K,A>(node);
         return;
     }
 
-    printNode<N,T>(node);
+    printNode<N,T,C,K,A>(node);
 
     if (node->left != nullptr) {
         std::cout << "left" << std::endl;
-        printTree<N,T>(node->left);
+        printTree<N,T,C,K,A>(node->left);
     }
 
     if (node->right != nullptr) {
         std::cout << "right" << std::endl;
-        printTree<N,T>(node->right);
+        printTree<N,T,C,K,A>(node->right);
     }
 }
 
-template <size_t N, typename T>
-uint32_t treeDepth(typename RbTree<N,T>::Node* node)
+template <size_t N, typename T, typename C = util::ThreeWayCompare, typename K = util::Identity, typename A = NoAugmentation>
+uint32_t treeDepth(typename PooledRbTree<N,T,C,K,A>::Node* node)
 {
     if (node == nullptr) {
         return 0;
@@ -79,30 +79,30 @@ uint32_t treeDepth(typename RbTree<N,T>::Node* node)
     uint32_t depth = 0;
 
     if (node->left != nullptr) {
-        depth = treeDepth<N,T>(node->left);
+        depth = treeDepth<N,T,C,K,A>(node->left);
     }
 
     if (node->right != nullptr) {
-        depth = util::max(depth,treeDepth<N,T>(node->right));
+        depth = util::max(depth,treeDepth<N,T,C,K,A>(node->right));
     }
 
     return depth + 1;
 }
 
-template <size_t N, typename T>
-bool checkBlackChildren(typename RbTree<N,T>::Node* node)
+template <size_t N, typename T, typename C = util::ThreeWayCompare, typename K = util::Identity, typename A = NoAugmentation>
+bool checkBlackChildren(typename PooledRbTree<N,T,C,K,A>::Node* node)
 {
     if (node == nullptr) {
         return true;
     }
 
-    if (node->color == RbTree<N,T>::Node::Color::kRed) {
+    if (node->color == PooledRbTree<N,T,C,K,A>::Node::Color::kRed) {
         if ((node->left != nullptr) &&
-            (node->left->color != RbTree<N,T>::Node::Color::kBlack)) {
+            (node->left->color != PooledRbTree<N,T,C,K,A>::Node::Color::kBlack)) {
             return false;
         }
         if ((node->right != nullptr) &&
-            (node->right->color != RbTree<N,T>::Node::Color::kBlack)) {
+            (node->right->color != PooledRbTree<N,T,C,K,A>::Node::Color::kBlack)) {
             return false;
         }
     }
@@ -110,18 +110,18 @@ bool checkBlackChildren(typename RbTree<N,T>::Node* node)
     bool result = true;
 
     if (node->left != nullptr) {
-        result = result && checkBlackChildren<N,T>(node->left);
+        result = result && checkBlackChildren<N,T,C,K,A>(node->left);
     }
 
     if (node->right != nullptr) {
-        result = result && checkBlackChildren<N,T>(node->right);
+        result = result && checkBlackChildren<N,T,C,K,A>(node->right);
     }
 
     return result;
 }
 
-template <size_t N, typename T>
-int32_t checkTraversal(typename RbTree<N,T>::Node* node)
+template <size_t N, typename T, typename C = util::ThreeWayCompare, typename K = util::Identity, typename A = NoAugmentation>
+int32_t checkTraversal(typename PooledRbTree<N,T,C,K,A>::Node* node)
 {
     if (node == nullptr) {
         return 0;
@@ -131,14 +131,14 @@ int32_t checkTraversal(typename RbTree<N,T>::Node* node)
     if (node->left == nullptr) {
         left_black_depth = 1;
     } else {
-        left_black_depth = checkTraversal<N,T>(node->left);
+        left_black_depth = checkTraversal<N,T,C,K,A>(node->left);
     }
 
     int32_t right_black_depth = 0;
     if (node->right == nullptr) {
         right_black_depth = 1;
     } else {
-        right_black_depth = checkTraversal<N,T>(node->right);
+        right_black_depth = checkTraversal<N,T,C,K,A>(node->right);
     }
 
     if ((left_black_depth < 0) || (right_black_depth < 0)) {
@@ -149,42 +149,42 @@ int32_t checkTraversal(typename RbTree<N,T>::Node* node)
         return -1;
     }
 
-    if (node->color == RbTree<N,T>::Node::Color::kBlack) {
+    if (node->color == PooledRbTree<N,T,C,K,A>::Node::Color::kBlack) {
         left_black_depth++;
     }
 
     return left_black_depth;
 }
 
-template <size_t N, typename T>
-bool checkRbTree(const RbTree<N,T>& tree)
+template <size_t N, typename T, typename C = util::ThreeWayCompare, typename K = util::Identity, typename A = NoAugmentation>
+bool checkRbTree(const PooledRbTree<N,T,C,K,A>& tree)
 {
-    uint32_t tree_depth = treeDepth<N,T>(tree.m_root);
+    uint32_t tree_depth = treeDepth<N,T,C,K,A>(tree.m_root);
     if (tree_depth == 0) {
         return true;
     }
 
-    if (tree.m_root->color != RbTree<N,T>::Node::Color::kBlack) {
-        printTree<N,T>(tree.m_root);
+    if (tree.m_root->color != PooledRbTree<N,T,C,K,A>::Node::Color::kBlack) {
+        printTree<N,T,C,K,A>(tree.m_root);
         std::cout << "Root was not black." << std::endl;
         return false;
     }
 
-    if (!checkBlackChildren<N,T>(tree.m_root)) {
-        printTree<N,T>(tree.m_root);
+    if (!checkBlackChildren<N,T,C,K,A>(tree.m_root)) {
+        printTree<N,T,C,K,A>(tree.m_root);
         std::cout << "A red node had one or more red children." << std::endl;
         return false;
     }
 
-    int32_t black_depth = checkTraversal<N,T>(tree.m_root);
+    int32_t black_depth = checkTraversal<N,T,C,K,A>(tree.m_root);
     if (black_depth < 0) {
-        printTree<N,T>(tree.m_root);
+        printTree<N,T,C,K,A>(tree.m_root);
         std::cout << "Not all paths have the same black depth." << std::endl;
         return false;
     }
 
     if (tree_depth > (2 * (uint32_t)black_depth)) {
-        printTree<N,T>(tree.m_root);
+        printTree<N,T,C,K,A>(tree.m_root);
         std::cout << "Depth > 2*B: B=" << black_depth << ", D=" << tree_depth << std::endl;
         return false;
     }
@@ -227,6 +227,31 @@ void test_insert_move_loop();
 void test_search_unknown();
 void test_const_search_unknown();
 void test_fuzzy_insert_search();
+void test_custom_compare();
+void test_search_single_compare();
+void test_erase_unknown();
+void test_erase_loop();
+void test_erase_keeps_pointers();
+void test_fuzzy_insert_erase();
+void test_insert_append();
+void test_insert_prepend();
+void test_insert_hint();
+void test_insert_bad_hint();
+void test_min_max_erase();
+void test_key_of_record();
+void test_key_of_search_by_id();
+void test_emplace_no_copy();
+void test_emplace_full();
+void test_split();
+void test_split_edges();
+void test_split_keeps_pointers();
+void test_split_single_descent();
+void test_split_invalid();
+void test_join_append();
+void test_join_prepend();
+void test_join_empty();
+void test_join_overlap();
+void test_fuzzy_split_join();
 
 int main(int argc, char** argv)
 {
@@ -269,6 +294,35 @@ int main(int argc, char** argv)
     for (uint32_t i = 0; i < 32U; i++) {
         RUN_TEST(test_fuzzy_insert_search);
     }
+    RUN_TEST(test_custom_compare);
+    RUN_TEST(test_search_single_compare);
+    RUN_TEST(test_erase_unknown);
+    RUN_TEST(test_erase_loop);
+    RUN_TEST(test_erase_keeps_pointers);
+    for (uint32_t i = 0; i < 8U; i++) {
+        RUN_TEST(test_fuzzy_insert_erase);
+    }
+    RUN_TEST(test_insert_append);
+    RUN_TEST(test_insert_prepend);
+    RUN_TEST(test_insert_hint);
+    RUN_TEST(test_insert_bad_hint);
+    RUN_TEST(test_min_max_erase);
+    RUN_TEST(test_key_of_record);
+    RUN_TEST(test_key_of_search_by_id);
+    RUN_TEST(test_emplace_no_copy);
+    RUN_TEST(test_emplace_full);
+    RUN_TEST(test_split);
+    RUN_TEST(test_split_edges);
+    RUN_TEST(test_split_keeps_pointers);
+    RUN_TEST(test_split_single_descent);
+    RUN_TEST(test_split_invalid);
+    RUN_TEST(test_join_append);
+    RUN_TEST(test_join_prepend);
+    RUN_TEST(test_join_empty);
+    RUN_TEST(test_join_overlap);
+    for (int i = 0; i < 8; i++) {
+        RUN_TEST(test_fuzzy_split_join);
+    }
 
     return UNITY_END();
 }
@@ -898,7 +952,7 @@ void test_const_search_unknown()
     }
 
     for (int i = 256; i < 1024; i++) {
-        const int* value = static_cast<const RbTree<256U,int>>(rb).search(i);
+        const int* value = static_cast<const RbTree<256U,int>&>(rb).search(i);
         TEST_ASSERT_NULL(value);
     }
 }
@@ -954,3 +1008,714 @@ void test_fuzzy_insert_search()
     std::cout << "Hits: " << hits << std::endl;
     std::cout << "Misses: " << misses << std::endl;
 }
+
+// Test Compare ===================================================================
+
+struct ReverseCompare
+{
+    int operator()(const int& a, const int& b) const
+    {
+        return b - a;
+    }
+};
+
+void test_custom_compare()
+{
+    RbTree<16U,int,ReverseCompare> rb;
+
+    for (int i = 0; i < 16; i++) {
+        TEST_ASSERT_TRUE(rb.insert(i));
+        TEST_ASSERT_TRUE(checkRbTree(rb));
+    }
+
+    // Reverse ordering puts the largest item on the far left
+    RbTree<16U,int,ReverseCompare>::Node* node = rb.m_root;
+    while (node->left != nullptr) {
+        node = node->left;
+    }
+    TEST_ASSERT_EQUAL_INT32(15, node->item);
+
+    for (int i = 0; i < 16; i++) {
+        int* value = rb.search(i);
+        TEST_ASSERT_NOT_NULL(value);
+        TEST_ASSERT_EQUAL_INT32(i, *value);
+    }
+    TEST_ASSERT_NULL(rb.search(16));
+}
+
+uint32_t g_compare_count = 0;
+
+struct CountingCompare
+{
+    int operator()(const uint32_t& a, const uint32_t& b) const
+    {
+        g_compare_count++;
+        return (a < b) ? -1 : ((a > b) ? 1 : 0);
+    }
+};
+
+void test_search_single_compare()
+{
+    RbTree<256U,uint32_t,CountingCompare> rb;
+
+    for (uint32_t i = 0; i < 256U; i++) {
+        g_compare_count = 0;
+        TEST_ASSERT_TRUE(rb.insert(i));
+        // Inserting descends to a leaf, one comparison per level
+        uint32_t depth = treeDepth<256U,uint32_t,CountingCompare>(rb.m_root);
+        TEST_ASSERT_TRUE(g_compare_count <= depth);
+    }
+
+    uint32_t depth = treeDepth<256U,uint32_t,CountingCompare>(rb.m_root);
+    for (uint32_t i = 0; i < 512U; i++) {
+        g_compare_count = 0;
+        rb.search(i);
+        TEST_ASSERT_TRUE(g_compare_count <= depth);
+    }
+}
+
+// Test Erase =====================================================================
+
+void test_erase_unknown()
+{
+    RbTree<16U,int> rb;
+
+    TEST_ASSERT_FALSE(rb.erase(0));
+
+    for (int i = 0; i < 16; i++) {
+        TEST_ASSERT_TRUE(rb.insert(i));
+    }
+
+    TEST_ASSERT_FALSE(rb.erase(16));
+    TEST_ASSERT_FALSE(rb.erase(-1));
+    TEST_ASSERT_EQUAL_UINT32(16U, rb.size());
+}
+
+void test_erase_loop()
+{
+    RbTree<256U,int> rb;
+
+    for (int i = 0; i < 256; i++) {
+        TEST_ASSERT_TRUE(rb.insert(i));
+    }
+
+    // Erase every other item, then the rest, checking the tree each time
+    for (int i = 0; i < 256; i += 2) {
+        TEST_ASSERT_TRUE(rb.erase(i));
+        TEST_ASSERT_TRUE(checkRbTree(rb));
+        TEST_ASSERT_NULL(rb.search(i));
+    }
+    TEST_ASSERT_EQUAL_UINT32(128U, rb.size());
+
+    for (int i = 1; i < 256; i += 2) {
+        int* value = rb.search(i);
+        TEST_ASSERT_NOT_NULL(value);
+        TEST_ASSERT_EQUAL_INT32(i, *value);
+    }
+
+    for (int i = 255; i > 0; i -= 2) {
+        TEST_ASSERT_TRUE(rb.erase(i));
+        TEST_ASSERT_TRUE(checkRbTree(rb));
+    }
+    TEST_ASSERT_EQUAL_UINT32(0U, rb.size());
+    TEST_ASSERT_NULL(rb.m_root);
+
+    // Freed nodes can be reused
+    for (int i = 0; i < 256; i++) {
+        TEST_ASSERT_TRUE(rb.insert(i));
+    }
+    TEST_ASSERT_TRUE(checkRbTree(rb));
+}
+
+void test_erase_keeps_pointers()
+{
+    RbTree<64U,int> rb;
+
+    for (int i = 0; i < 64; i++) {
+        TEST_ASSERT_TRUE(rb.insert(i));
+    }
+
+    int* pointers[64];
+    for (int i = 0; i < 64; i++) {
+        pointers[i] = rb.search(i);
+    }
+
+    // Erasing nodes with two children must not move the items of other nodes
+    for (int i = 0; i < 64; i += 3) {
+        TEST_ASSERT_TRUE(rb.erase(i));
+    }
+    for (int i = 0; i < 64; i++) {
+        if ((i % 3) != 0) {
+            TEST_ASSERT_EQUAL_PTR(pointers[i], rb.search(i));
+            TEST_ASSERT_EQUAL_INT32(i, *pointers[i]);
+        }
+    }
+}
+
+void test_fuzzy_insert_erase()
+{
+    RbTree<1024U,KeyPair<uint32_t,uint32_t>> rb;
+    std::unordered_map<uint32_t,uint32_t> map;
+
+#ifdef FUZZ_SEED
+    uint32_t seed = FUZZ_SEED;
+#else
+    uint32_t seed = std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+    std::cout << "Fuzz seed: " << seed << std::endl;
+    srand(seed);
+
+    // Randomly insert and erase keys from a small key space so both happen often
+    for (uint32_t i = 0; i < 8192U; i++) {
+        uint32_t key = static_cast<uint32_t>(rand()) % 1024U;
+        if (map.find(key) != map.end()) {
+            TEST_ASSERT_TRUE(rb.erase(key));
+            map.erase(key);
+        } else {
+            TEST_ASSERT_TRUE(rb.insert(KeyPair<uint32_t,uint32_t>(key, i)));
+            map.insert({key, i});
+        }
+        TEST_ASSERT_EQUAL_UINT32(map.size(), rb.size());
+    }
+    TEST_ASSERT_TRUE(checkRbTree(rb));
+
+    for (uint32_t key = 0; key < 1024U; key++) {
+        KeyPair<uint32_t,uint32_t>* result = rb.search(key);
+        if (map.find(key) != map.end()) {
+            TEST_ASSERT_NOT_NULL(result);
+            TEST_ASSERT_EQUAL_UINT32(map.find(key)->second, result->value);
+        } else {
+            TEST_ASSERT_NULL(result);
+        }
+    }
+}
+
+// Test Append and Hinted Insert ==================================================
+
+void test_insert_append()
+{
+    RbTree<256U,uint32_t,CountingCompare> rb;
+
+    for (uint32_t i = 0; i < 256U; i++) {
+        g_compare_count = 0;
+        TEST_ASSERT_TRUE(rb.insert(i));
+        // Appending only compares against the largest item
+        TEST_ASSERT_TRUE(g_compare_count <= 1U);
+        TEST_ASSERT_EQUAL_UINT32(0U, rb.m_min->item);
+        TEST_ASSERT_EQUAL_UINT32(i, rb.m_max->item);
+    }
+    TEST_ASSERT_TRUE(checkRbTree(rb));
+
+    for (uint32_t i = 0; i < 256U; i++) {
+        uint32_t* value = rb.search(i);
+        TEST_ASSERT_NOT_NULL(value);
+        TEST_ASSERT_EQUAL_UINT32(i, *value);
+    }
+}
+
+void test_insert_prepend()
+{
+    RbTree<256U,uint32_t,CountingCompare> rb;
+
+    for (uint32_t i = 256U; i > 0; i--) {
+        g_compare_count = 0;
+        TEST_ASSERT_TRUE(rb.insert(i));
+        // Prepending compares against the largest and the smallest item
+        TEST_ASSERT_TRUE(g_compare_count <= 2U);
+        TEST_ASSERT_EQUAL_UINT32(i, rb.m_min->item);
+        TEST_ASSERT_EQUAL_UINT32(256U, rb.m_max->item);
+    }
+    TEST_ASSERT_TRUE(checkRbTree(rb));
+}
+
+void test_insert_hint()
+{
+    RbTree<256U,uint32_t,CountingCompare> rb;
+
+    // Fill even numbers, then insert each odd number using its lower neighbour as the hint
+    for (uint32_t i = 0; i < 256U; i += 2) {
+        TEST_ASSERT_TRUE(rb.insert(i));
+    }
+
+    for (uint32_t i = 1; i < 256U; i += 2) {
+        const uint32_t* hint = rb.search(i - 1U);
+        g_compare_count = 0;
+        uint32_t* item = rb.insert(hint, i);
+        TEST_ASSERT_NOT_NULL(item);
+        TEST_ASSERT_EQUAL_UINT32(i, *item);
+        // Compared against the hint and its successor only
+        TEST_ASSERT_TRUE(g_compare_count <= 2U);
+        TEST_ASSERT_TRUE(checkRbTree(rb));
+    }
+
+    for (uint32_t i = 0; i < 256U; i++) {
+        uint32_t* value = rb.search(i);
+        TEST_ASSERT_NOT_NULL(value);
+        TEST_ASSERT_EQUAL_UINT32(i, *value);
+    }
+}
+
+void test_insert_bad_hint()
+{
+    RbTree<64U,int> rb;
+    int outside = 0;
+
+    // A hint which is not in the tree, or on the wrong side, falls back to a normal insert
+    int* item = rb.insert(&outside, 10);
+    TEST_ASSERT_NOT_NULL(item);
+    for (int i = 0; i < 32; i++) {
+        item = rb.insert(item, (i * 7) % 32);
+        TEST_ASSERT_NOT_NULL(item);
+        TEST_ASSERT_TRUE(checkRbTree(rb));
+    }
+
+    for (int i = 0; i < 32; i++) {
+        TEST_ASSERT_NOT_NULL(rb.search(i));
+    }
+    TEST_ASSERT_EQUAL_UINT32(33U, rb.size());
+}
+
+void test_min_max_erase()
+{
+    RbTree<64U,int> rb;
+
+    for (int i = 0; i < 64; i++) {
+        TEST_ASSERT_TRUE(rb.insert((i * 5) % 64));
+    }
+    TEST_ASSERT_EQUAL_INT32(0, rb.m_min->item);
+    TEST_ASSERT_EQUAL_INT32(63, rb.m_max->item);
+
+    for (int i = 0; i < 32; i++) {
+        TEST_ASSERT_TRUE(rb.erase(i));
+        TEST_ASSERT_TRUE(rb.erase(63 - i));
+        if (i < 31) {
+            TEST_ASSERT_EQUAL_INT32(i + 1, rb.m_min->item);
+            TEST_ASSERT_EQUAL_INT32(62 - i, rb.m_max->item);
+        }
+    }
+    TEST_ASSERT_NULL(rb.m_min);
+    TEST_ASSERT_NULL(rb.m_max);
+
+    // An emptied tree starts over correctly
+    TEST_ASSERT_TRUE(rb.insert(5));
+    TEST_ASSERT_TRUE(rb.insert(3));
+    TEST_ASSERT_EQUAL_INT32(3, rb.m_min->item);
+    TEST_ASSERT_EQUAL_INT32(5, rb.m_max->item);
+}
+
+// Test KeyOf =====================================================================
+
+uint32_t g_record_copies = 0;
+
+/// A large record keyed on one of its fields.
+struct Record
+{
+    Record(uint32_t i, uint8_t fill) : id(i)
+    {
+        for (size_t j = 0; j < sizeof(payload); j++) {
+            payload[j] = fill;
+        }
+    }
+
+    Record(const Record& other) : id(other.id)
+    {
+        g_record_copies++;
+        for (size_t j = 0; j < sizeof(payload); j++) {
+            payload[j] = other.payload[j];
+        }
+    }
+
+    uint32_t id;
+    uint8_t payload[64];
+};
+
+std::ostream &operator<<(std::ostream &os, Record const &record) {
+    return os << record.id;
+}
+
+struct RecordId
+{
+    const uint32_t& operator()(const Record& record) const
+    {
+        return record.id;
+    }
+};
+
+/// Orders ids from largest to smallest.
+struct DescendingId
+{
+    int operator()(const uint32_t& a, const uint32_t& b) const
+    {
+        return (a > b) ? -1 : ((a < b) ? 1 : 0);
+    }
+};
+
+void test_key_of_record()
+{
+    RbTree<64U,Record,DescendingId,RecordId> rb;
+
+    for (uint32_t i = 0; i < 64U; i++) {
+        TEST_ASSERT_TRUE(rb.insert(Record((i * 7U) % 64U, static_cast<uint8_t>(i))));
+        TEST_ASSERT_TRUE((checkRbTree<64U,Record,DescendingId,RecordId>(rb)));
+    }
+
+    // The custom predicate puts the largest id first
+    TEST_ASSERT_EQUAL_UINT32(63U, rb.m_min->item.id);
+    TEST_ASSERT_EQUAL_UINT32(0U, rb.m_max->item.id);
+
+    for (uint32_t i = 0; i < 32U; i++) {
+        TEST_ASSERT_TRUE(rb.erase(i * 2U));
+        TEST_ASSERT_TRUE((checkRbTree<64U,Record,DescendingId,RecordId>(rb)));
+    }
+    TEST_ASSERT_EQUAL_UINT32(32U, rb.size());
+    TEST_ASSERT_EQUAL_UINT32(1U, rb.m_max->item.id);
+}
+
+void test_key_of_search_by_id()
+{
+    RbTree<16U,Record,util::ThreeWayCompare,RecordId> rb;
+
+    for (uint32_t i = 0; i < 16U; i++) {
+        TEST_ASSERT_TRUE(rb.emplace(i * 10U, static_cast<uint8_t>(i)));
+    }
+
+    // Lookups take a bare id, no Record is constructed
+    for (uint32_t i = 0; i < 16U; i++) {
+        const Record* record = rb.search(i * 10U);
+        TEST_ASSERT_NOT_NULL(record);
+        TEST_ASSERT_EQUAL_UINT32(i * 10U, record->id);
+        TEST_ASSERT_EQUAL_UINT8(i, record->payload[63]);
+    }
+    TEST_ASSERT_NULL(rb.search(5U));
+    TEST_ASSERT_NULL(rb.search(160U));
+}
+
+void test_emplace_no_copy()
+{
+    RbTree<256U,Record,util::ThreeWayCompare,RecordId> rb;
+
+    g_record_copies = 0;
+    for (uint32_t i = 0; i < 256U; i++) {
+        TEST_ASSERT_TRUE(rb.emplace((i * 37U) % 256U, static_cast<uint8_t>(i)));
+    }
+    TEST_ASSERT_TRUE((checkRbTree<256U,Record,util::ThreeWayCompare,RecordId>(rb)));
+    TEST_ASSERT_EQUAL_UINT32(0U, g_record_copies);
+
+    for (uint32_t i = 0; i < 256U; i++) {
+        TEST_ASSERT_NOT_NULL(rb.search(i));
+    }
+}
+
+void test_emplace_full()
+{
+    RbTree<4U,Record,util::ThreeWayCompare,RecordId> rb;
+
+    for (uint32_t i = 0; i < 4U; i++) {
+        TEST_ASSERT_TRUE(rb.emplace(i, 0U));
+    }
+    TEST_ASSERT_FALSE(rb.emplace(4U, 0U));
+    TEST_ASSERT_EQUAL_UINT32(4U, rb.size());
+    TEST_ASSERT_NULL(rb.search(4U));
+}
+
+// Test Split/Join ================================================================
+
+/// Check that a tree holds exactly the items [first, last) in order, with correct extreme nodes.
+template <size_t N, typename C, typename K, typename A>
+bool checkRange(const PooledRbTree<N,int,C,K,A>& tree, int first, int last)
+{
+    using Node = typename PooledRbTree<N,int,C,K,A>::Node;
+
+    if (first == last) {
+        return (tree.m_root == nullptr) && (tree.m_min == nullptr) && (tree.m_max == nullptr) &&
+               (tree.size() == 0);
+    }
+
+    if ((tree.m_min == nullptr) || (tree.m_min != PooledRbTree<N,int,C,K,A>::minimum(tree.m_root)) ||
+        (tree.m_max != PooledRbTree<N,int,C,K,A>::maximum(tree.m_root))) {
+        return false;
+    }
+
+    int expected = first;
+    for (Node* node = tree.m_min; node != nullptr; node = PooledRbTree<N,int,C,K,A>::successor(node)) {
+        if (node->item != expected) {
+            return false;
+        }
+        expected++;
+    }
+
+    return (expected == last) && (tree.size() == static_cast<size_t>(last - first));
+}
+
+/// Check that the subtree sizes stored in every node are correct.
+template <typename Node>
+size_t checkCounts(const Node* node, bool& ok)
+{
+    if (node == nullptr) {
+        return 0;
+    }
+
+    const size_t count = 1 + checkCounts(node->left, ok) + checkCounts(node->right, ok);
+    if (node->count != count) {
+        ok = false;
+    }
+
+    return count;
+}
+
+void test_split()
+{
+    RbTree<64U,int> rb;
+    for (int i = 0; i < 64; i++) {
+        TEST_ASSERT_TRUE(rb.insert(i));
+    }
+
+    PooledRbTree<64U,int> upper(rb.pool());
+    TEST_ASSERT_TRUE(rb.split(20, upper));
+
+    TEST_ASSERT_TRUE(checkRbTree(rb));
+    TEST_ASSERT_TRUE(checkRbTree(upper));
+    TEST_ASSERT_TRUE(checkRange(rb, 0, 20));
+    TEST_ASSERT_TRUE(checkRange(upper, 20, 64));
+
+    // Both trees keep working independently
+    TEST_ASSERT_TRUE(upper.erase(30));
+    TEST_ASSERT_TRUE(rb.insert(30));
+    TEST_ASSERT_NOT_NULL(rb.search(30));
+    TEST_ASSERT_NULL(upper.search(30));
+    TEST_ASSERT_EQUAL_UINT32(21U, rb.size());
+    TEST_ASSERT_EQUAL_UINT32(43U, upper.size());
+    TEST_ASSERT_TRUE(checkRbTree(rb));
+    TEST_ASSERT_TRUE(checkRbTree(upper));
+}
+
+void test_split_edges()
+{
+    RbTree<32U,int> rb;
+    PooledRbTree<32U,int> upper(rb.pool());
+
+    // Splitting an empty tree
+    TEST_ASSERT_TRUE(rb.split(0, upper));
+    TEST_ASSERT_TRUE(checkRange(rb, 0, 0));
+    TEST_ASSERT_TRUE(checkRange(upper, 0, 0));
+
+    for (int i = 0; i < 32; i++) {
+        TEST_ASSERT_TRUE(rb.insert(i));
+    }
+
+    // Below the smallest item everything moves
+    TEST_ASSERT_TRUE(rb.split(-1, upper));
+    TEST_ASSERT_TRUE(checkRange(rb, 0, 0));
+    TEST_ASSERT_TRUE(checkRange(upper, 0, 32));
+    TEST_ASSERT_TRUE(checkRbTree(upper));
+
+    // Above the largest item nothing moves
+    TEST_ASSERT_TRUE(rb.join(upper));
+    TEST_ASSERT_TRUE(rb.split(32, upper));
+    TEST_ASSERT_TRUE(checkRange(rb, 0, 32));
+    TEST_ASSERT_TRUE(checkRange(upper, 0, 0));
+    TEST_ASSERT_TRUE(checkRbTree(rb));
+
+    // The smallest item is not less than itself so it moves
+    TEST_ASSERT_TRUE(rb.split(0, upper));
+    TEST_ASSERT_TRUE(checkRange(upper, 0, 32));
+}
+
+void test_split_keeps_pointers()
+{
+    RbTree<128U,int> rb;
+    int* items[128];
+    for (int i = 0; i < 128; i++) {
+        TEST_ASSERT_TRUE(rb.insert((i * 37) % 128));
+    }
+    for (int i = 0; i < 128; i++) {
+        items[i] = rb.search(i);
+    }
+
+    PooledRbTree<128U,int> upper(rb.pool());
+    TEST_ASSERT_TRUE(rb.split(77, upper));
+
+    for (int i = 0; i < 128; i++) {
+        if (i < 77) {
+            TEST_ASSERT_EQUAL_PTR(items[i], rb.search(i));
+        } else {
+            TEST_ASSERT_EQUAL_PTR(items[i], upper.search(i));
+        }
+    }
+
+    TEST_ASSERT_TRUE(rb.join(upper));
+    for (int i = 0; i < 128; i++) {
+        TEST_ASSERT_EQUAL_PTR(items[i], rb.search(i));
+    }
+}
+
+void test_split_single_descent()
+{
+    RbTree<4096U,uint32_t,CountingCompare> rb;
+    for (uint32_t i = 0; i < 4096U; i++) {
+        TEST_ASSERT_TRUE(rb.insert(i));
+    }
+    uint32_t depth = treeDepth<4096U,uint32_t,CountingCompare>(rb.m_root);
+
+    PooledRbTree<4096U,uint32_t,CountingCompare> upper(rb.pool());
+    g_compare_count = 0;
+    TEST_ASSERT_TRUE(rb.split(1234U, upper));
+    // Splitting compares along a single search path
+    TEST_ASSERT_TRUE(g_compare_count <= depth);
+    TEST_ASSERT_TRUE(checkRbTree(rb));
+    TEST_ASSERT_TRUE(checkRbTree(upper));
+
+    // Joining compares only the extreme items
+    g_compare_count = 0;
+    TEST_ASSERT_TRUE(rb.join(upper));
+    TEST_ASSERT_EQUAL_UINT32(1U, g_compare_count);
+    TEST_ASSERT_EQUAL_UINT32(4096U, rb.size());
+    TEST_ASSERT_TRUE(checkRbTree(rb));
+}
+
+void test_split_invalid()
+{
+    RbTree<16U,int> rb;
+    RbTree<16U,int> other;
+    for (int i = 0; i < 16; i++) {
+        TEST_ASSERT_TRUE(rb.insert(i));
+    }
+
+    // Trees which do not share a pool cannot exchange nodes
+    TEST_ASSERT_FALSE(rb.split(8, other));
+    TEST_ASSERT_TRUE(other.insert(100));
+    TEST_ASSERT_FALSE(rb.join(other));
+
+    // The receiving tree must be empty
+    PooledRbTree<16U,int> upper(rb.pool());
+    TEST_ASSERT_TRUE(rb.split(12, upper));
+    TEST_ASSERT_FALSE(rb.split(8, upper));
+    TEST_ASSERT_FALSE(rb.split(8, rb));
+    TEST_ASSERT_FALSE(rb.join(rb));
+    TEST_ASSERT_TRUE(checkRange(rb, 0, 12));
+    TEST_ASSERT_TRUE(checkRange(upper, 12, 16));
+}
+
+void test_join_append()
+{
+    RbTree<128U,int> rb;
+    PooledRbTree<128U,int> upper(rb.pool());
+    for (int i = 0; i < 8; i++) {
+        TEST_ASSERT_TRUE(rb.insert(i));
+    }
+    for (int i = 8; i < 128; i++) {
+        TEST_ASSERT_TRUE(upper.insert(i));
+    }
+
+    TEST_ASSERT_TRUE(rb.join(upper));
+    TEST_ASSERT_TRUE(checkRbTree(rb));
+    TEST_ASSERT_TRUE(checkRange(rb, 0, 128));
+    TEST_ASSERT_TRUE(checkRange(upper, 0, 0));
+}
+
+void test_join_prepend()
+{
+    RbTree<128U,int> rb;
+    PooledRbTree<128U,int> lower(rb.pool());
+    for (int i = 100; i < 128; i++) {
+        TEST_ASSERT_TRUE(rb.insert(i));
+    }
+    for (int i = 0; i < 100; i++) {
+        TEST_ASSERT_TRUE(lower.insert(i));
+    }
+
+    TEST_ASSERT_TRUE(rb.join(lower));
+    TEST_ASSERT_TRUE(checkRbTree(rb));
+    TEST_ASSERT_TRUE(checkRange(rb, 0, 128));
+    TEST_ASSERT_TRUE(checkRange(lower, 0, 0));
+}
+
+void test_join_empty()
+{
+    RbTree<16U,int> rb;
+    PooledRbTree<16U,int> other(rb.pool());
+
+    TEST_ASSERT_TRUE(rb.join(other));
+    TEST_ASSERT_TRUE(checkRange(rb, 0, 0));
+
+    for (int i = 0; i < 16; i++) {
+        TEST_ASSERT_TRUE(other.insert(i));
+    }
+    TEST_ASSERT_TRUE(rb.join(other));
+    TEST_ASSERT_TRUE(checkRange(rb, 0, 16));
+    TEST_ASSERT_TRUE(checkRange(other, 0, 0));
+
+    TEST_ASSERT_TRUE(rb.join(other));
+    TEST_ASSERT_TRUE(checkRange(rb, 0, 16));
+}
+
+void test_join_overlap()
+{
+    RbTree<16U,int> rb;
+    PooledRbTree<16U,int> other(rb.pool());
+    for (int i = 0; i < 8; i++) {
+        TEST_ASSERT_TRUE(rb.insert(i * 2));
+        TEST_ASSERT_TRUE(other.insert((i * 2) + 1));
+    }
+
+    TEST_ASSERT_FALSE(rb.join(other));
+    TEST_ASSERT_EQUAL_UINT32(8U, rb.size());
+    TEST_ASSERT_EQUAL_UINT32(8U, other.size());
+
+    // Touching ranges are disjoint enough: equal items may sit on either side
+    RbTree<16U,int> low;
+    PooledRbTree<16U,int> high(low.pool());
+    TEST_ASSERT_TRUE(low.insert(1));
+    TEST_ASSERT_TRUE(low.insert(5));
+    TEST_ASSERT_TRUE(high.insert(5));
+    TEST_ASSERT_TRUE(high.insert(9));
+    TEST_ASSERT_TRUE(low.join(high));
+    TEST_ASSERT_EQUAL_UINT32(4U, low.size());
+}
+
+void test_fuzzy_split_join()
+{
+    constexpr int kNumItems = 1024;
+    using Tree = PooledRbTree<kNumItems,int,util::ThreeWayCompare,util::Identity,SubtreeSize>;
+
+    unsigned int seed = time(nullptr);
+#ifdef FUZZ_SEED
+    seed = FUZZ_SEED;
+#endif
+    srand(seed);
+    std::cout << "Fuzz seed: " << seed << std::endl;
+
+    RbTree<kNumItems,int,util::ThreeWayCompare,util::Identity,SubtreeSize> rb;
+    for (int i = 0; i < kNumItems; i++) {
+        TEST_ASSERT_TRUE(rb.insert((i * 389) % kNumItems));
+    }
+
+    Tree upper(rb.pool());
+    for (int round = 0; round < 256; round++) {
+        const int key = (rand() % (kNumItems + 2)) - 1;
+        TEST_ASSERT_TRUE(rb.split(key, upper));
+
+        const int cut = util::min(util::max(key, 0), kNumItems);
+        TEST_ASSERT_TRUE(checkRbTree(rb));
+        TEST_ASSERT_TRUE(checkRbTree(upper));
+        TEST_ASSERT_TRUE(checkRange(rb, 0, cut));
+        TEST_ASSERT_TRUE(checkRange(upper, cut, kNumItems));
+
+        bool ok = true;
+        checkCounts(rb.m_root, ok);
+        checkCounts(upper.m_root, ok);
+        TEST_ASSERT_TRUE(ok);
+
+        // Rejoin from either side
+        if ((round % 2) == 0) {
+            TEST_ASSERT_TRUE(rb.join(upper));
+        } else {
+            TEST_ASSERT_TRUE(upper.join(rb));
+            TEST_ASSERT_TRUE(upper.split(kNumItems, rb));
+            TEST_ASSERT_TRUE(rb.join(upper));
+        }
+        TEST_ASSERT_TRUE(checkRange(rb, 0, kNumItems));
+        checkCounts(rb.m_root, ok);
+        TEST_ASSERT_TRUE(ok);
+    }
+}
@@ -0,0 +1,276 @@
+/**
+ * @file      test_rb_tree_image.cpp
+ * @brief     This file contains tests for RbTreeImage.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+
+#include "unity.h"
+
+#include "junk/containers/rb_tree.h"
+#include "junk/containers/rb_tree_image.h"
+
+using namespace junk;
+
+/// A record keyed on its id, with padding between its fields.
+struct Record
+{
+    uint16_t id;
+    uint64_t payload;
+};
+
+struct RecordId
+{
+    const uint16_t& operator()(const Record& record) const
+    {
+        return record.id;
+    }
+};
+
+using RecordTree = RbTree<256U, Record, util::ThreeWayCompare, RecordId>;
+using RecordImage = RbTreeImage<Record, util::ThreeWayCompare, RecordId>;
+
+alignas(8) uint8_t g_buffer[RecordImage::imageSize(256U) + 64U];
+
+void test_empty_image();
+void test_write_open_search();
+void test_write_too_small();
+void test_relocate();
+void test_mmap_file();
+void test_reject_invalid();
+void test_reject_truncated();
+void test_reject_other_type();
+void test_reject_truncated_padding();
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_empty_image);
+    RUN_TEST(test_write_open_search);
+    RUN_TEST(test_write_too_small);
+    RUN_TEST(test_relocate);
+    RUN_TEST(test_mmap_file);
+    RUN_TEST(test_reject_invalid);
+    RUN_TEST(test_reject_truncated);
+    RUN_TEST(test_reject_other_type);
+    RUN_TEST(test_reject_truncated_padding);
+
+    return UNITY_END();
+}
+
+/// Fill a tree with ids 0, 3, 6, ... in a scrambled order.
+void fillTree(RecordTree& tree)
+{
+    for (uint16_t i = 0; i < 256U; i++) {
+        const uint16_t id = static_cast<uint16_t>(((i * 37U) % 256U) * 3U);
+        TEST_ASSERT_TRUE(tree.insert(Record{id, id * 1000ULL}));
+    }
+}
+
+/// Check that an open image holds exactly the items written by fillTree().
+void checkImage(const RecordImage& image)
+{
+    TEST_ASSERT_EQUAL_UINT32(256U, image.size());
+
+    for (uint16_t i = 0; i < 256U; i++) {
+        // Items are stored in order
+        TEST_ASSERT_EQUAL_UINT16(i * 3U, image.items()[i].id);
+
+        const Record* record = image.search(static_cast<uint16_t>(i * 3U));
+        TEST_ASSERT_NOT_NULL(record);
+        TEST_ASSERT_EQUAL_UINT16(i * 3U, record->id);
+        TEST_ASSERT_TRUE(record->payload == (i * 3000ULL));
+
+        TEST_ASSERT_NULL(image.search(static_cast<uint16_t>((i * 3U) + 1U)));
+    }
+    TEST_ASSERT_NULL(image.search(static_cast<uint16_t>(0xFFFFU)));
+}
+
+void test_empty_image()
+{
+    RecordTree tree;
+    RecordImage image;
+
+    TEST_ASSERT_NULL(image.search(static_cast<uint16_t>(0U)));
+
+    const size_t size = RecordImage::write(tree, g_buffer, sizeof(g_buffer));
+    TEST_ASSERT_EQUAL_UINT32(RecordImage::imageSize(0U), size);
+    TEST_ASSERT_TRUE(image.open(g_buffer, size));
+    TEST_ASSERT_EQUAL_UINT32(0U, image.size());
+    TEST_ASSERT_NULL(image.search(static_cast<uint16_t>(0U)));
+}
+
+void test_write_open_search()
+{
+    RecordTree tree;
+    fillTree(tree);
+
+    const size_t size = RecordImage::write(tree, g_buffer, sizeof(g_buffer));
+    TEST_ASSERT_EQUAL_UINT32(RecordImage::imageSize(256U), size);
+
+    RecordImage image;
+    TEST_ASSERT_TRUE(image.open(g_buffer, size));
+    checkImage(image);
+
+    // The image points into the buffer, nothing was copied
+    TEST_ASSERT_TRUE(reinterpret_cast<const uint8_t*>(image.items()) > g_buffer);
+    TEST_ASSERT_TRUE(reinterpret_cast<const uint8_t*>(image.items()) < (g_buffer + size));
+}
+
+void test_write_too_small()
+{
+    RecordTree tree;
+    fillTree(tree);
+
+    TEST_ASSERT_EQUAL_UINT32(0U, RecordImage::write(tree, g_buffer, RecordImage::imageSize(255U)));
+    TEST_ASSERT_EQUAL_UINT32(0U, RecordImage::write(tree, nullptr, sizeof(g_buffer)));
+}
+
+void test_relocate()
+{
+    RecordTree tree;
+    fillTree(tree);
+
+    const size_t size = RecordImage::write(tree, g_buffer, sizeof(g_buffer));
+
+    // Move the image to a different, suitably aligned address
+    alignas(8) static uint8_t moved[sizeof(g_buffer) + 64U];
+    std::memcpy(moved + 32U, g_buffer, size);
+    std::memset(g_buffer, 0, sizeof(g_buffer));
+
+    RecordImage image;
+    TEST_ASSERT_TRUE(image.open(moved + 32U, size));
+    checkImage(image);
+
+    // A misaligned copy cannot be used in place (the ranges overlap, hence memmove)
+    std::memmove(moved + 1U, moved + 32U, size);
+    TEST_ASSERT_FALSE(image.open(moved + 1U, size));
+    TEST_ASSERT_EQUAL_UINT32(0U, image.size());
+}
+
+void test_mmap_file()
+{
+    RecordTree tree;
+    fillTree(tree);
+    const size_t size = RecordImage::write(tree, g_buffer, sizeof(g_buffer));
+
+    std::FILE* file = std::tmpfile();
+    TEST_ASSERT_NOT_NULL(file);
+    TEST_ASSERT_EQUAL_UINT32(size, std::fwrite(g_buffer, 1, size, file));
+    TEST_ASSERT_EQUAL_INT(0, std::fflush(file));
+
+    void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileno(file), 0);
+    TEST_ASSERT_TRUE(mapped != MAP_FAILED);
+
+    RecordImage image;
+    TEST_ASSERT_TRUE(image.open(mapped, size));
+    checkImage(image);
+
+    TEST_ASSERT_EQUAL_INT(0, munmap(mapped, size));
+    std::fclose(file);
+}
+
+void test_reject_invalid()
+{
+    RecordTree tree;
+    fillTree(tree);
+    const size_t size = RecordImage::write(tree, g_buffer, sizeof(g_buffer));
+
+    RecordImage image;
+    TEST_ASSERT_FALSE(image.open(nullptr, size));
+
+    // Bad magic, as seen with the wrong byte order
+    g_buffer[0] ^= 0xFFU;
+    TEST_ASSERT_FALSE(image.open(g_buffer, size));
+    g_buffer[0] ^= 0xFFU;
+
+    // Unknown version
+    RbTreeImageHeader header;
+    std::memcpy(&header, g_buffer, sizeof(header));
+    header.version++;
+    std::memcpy(g_buffer, &header, sizeof(header));
+    TEST_ASSERT_FALSE(image.open(g_buffer, size));
+    header.version--;
+    std::memcpy(g_buffer, &header, sizeof(header));
+
+    TEST_ASSERT_TRUE(image.open(g_buffer, size));
+}
+
+void test_reject_truncated()
+{
+    RecordTree tree;
+    fillTree(tree);
+    const size_t size = RecordImage::write(tree, g_buffer, sizeof(g_buffer));
+
+    RecordImage image;
+    TEST_ASSERT_FALSE(image.open(g_buffer, sizeof(RbTreeImageHeader) - 1U));
+    TEST_ASSERT_FALSE(image.open(g_buffer, size - 1U));
+
+    // A corrupt count larger than the image
+    RbTreeImageHeader header;
+    std::memcpy(&header, g_buffer, sizeof(header));
+    header.count = 0xFFFFFFFFU;
+    std::memcpy(g_buffer, &header, sizeof(header));
+    TEST_ASSERT_FALSE(image.open(g_buffer, size));
+}
+
+void test_reject_other_type()
+{
+    RbTree<16U, uint32_t> tree;
+    for (uint32_t i = 0; i < 16U; i++) {
+        TEST_ASSERT_TRUE(tree.insert(i));
+    }
+    const size_t size = RbTreeImage<uint32_t>::write(tree, g_buffer, sizeof(g_buffer));
+
+    RbTreeImage<uint32_t> ints;
+    TEST_ASSERT_TRUE(ints.open(g_buffer, size));
+    TEST_ASSERT_NOT_NULL(ints.search(15U));
+
+    // An image of a different item type is rejected
+    RecordImage records;
+    TEST_ASSERT_FALSE(records.open(g_buffer, size));
+}
+
+/// An over-aligned item, padded away from the header in an image.
+struct alignas(16) Wide
+{
+    uint32_t id;
+};
+
+struct WideId
+{
+    const uint32_t& operator()(const Wide& wide) const
+    {
+        return wide.id;
+    }
+};
+
+using WideImage = RbTreeImage<Wide, util::ThreeWayCompare, WideId>;
+
+void test_reject_truncated_padding()
+{
+    RbTree<4U, Wide, util::ThreeWayCompare, WideId> tree;
+    TEST_ASSERT_TRUE(tree.insert(Wide{1U}));
+    TEST_ASSERT_TRUE(tree.insert(Wide{2U}));
+
+    alignas(16) static uint8_t buffer[WideImage::imageSize(2U)];
+    const size_t size = WideImage::write(tree, buffer, sizeof(buffer));
+    TEST_ASSERT_EQUAL_UINT32(sizeof(buffer), size);
+
+    // The header fits but the padding before the items does not
+    WideImage image;
+    TEST_ASSERT_FALSE(image.open(buffer, sizeof(RbTreeImageHeader)));
+    TEST_ASSERT_EQUAL_UINT32(0U, image.size());
+
+    TEST_ASSERT_TRUE(image.open(buffer, size));
+    TEST_ASSERT_EQUAL_UINT32(2U, image.size());
+    TEST_ASSERT_NOT_NULL(image.search(2U));
+}
@@ -0,0 +1,214 @@
+/**
+ * @file      test_sliding_window.cpp
+ * @brief     This file contains tests for SlidingWindow.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+#include "unity.h"
+
+#include "junk/containers/sliding_window.h"
+
+using namespace junk;
+
+void test_empty();
+void test_filling();
+void test_sliding();
+void test_duplicates();
+void test_wide_sum();
+void test_index_segments();
+void test_clear();
+void test_compare();
+void test_fuzz();
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_empty);
+    RUN_TEST(test_filling);
+    RUN_TEST(test_sliding);
+    RUN_TEST(test_duplicates);
+    RUN_TEST(test_wide_sum);
+    RUN_TEST(test_index_segments);
+    RUN_TEST(test_clear);
+    RUN_TEST(test_compare);
+    RUN_TEST(test_fuzz);
+
+    return UNITY_END();
+}
+
+void test_empty()
+{
+    SlidingWindow<int32_t, 4> uut;
+
+    TEST_ASSERT_TRUE(uut.isEmpty());
+    TEST_ASSERT_FALSE(uut.isFull());
+    TEST_ASSERT_EQUAL_UINT32(0, uut.size());
+    TEST_ASSERT_EQUAL_UINT32(4, uut.capacity());
+    TEST_ASSERT_EQUAL_INT32(0, uut.sum());
+}
+
+void test_filling()
+{
+    SlidingWindow<int32_t, 4> uut;
+
+    uut.push(5);
+    TEST_ASSERT_EQUAL_INT32(5, uut.sum());
+    TEST_ASSERT_EQUAL_INT32(5, uut.min());
+    TEST_ASSERT_EQUAL_INT32(5, uut.max());
+
+    uut.push(-3);
+    uut.push(8);
+    TEST_ASSERT_EQUAL_UINT32(3, uut.size());
+    TEST_ASSERT_EQUAL_INT32(10, uut.sum());
+    TEST_ASSERT_EQUAL_INT32(-3, uut.min());
+    TEST_ASSERT_EQUAL_INT32(8, uut.max());
+}
+
+void test_sliding()
+{
+    SlidingWindow<int32_t, 3> uut;
+    const int32_t samples[8] = {4, 1, 7, 3, 2, 9, 0, 5};
+    const int32_t sums[8] = {4, 5, 12, 11, 12, 14, 11, 14};
+    const int32_t mins[8] = {4, 1, 1, 1, 2, 2, 0, 0};
+    const int32_t maxs[8] = {4, 4, 7, 7, 7, 9, 9, 9};
+
+    for (size_t i = 0; i < 8; i++) {
+        uut.push(samples[i]);
+        TEST_ASSERT_EQUAL_INT32(sums[i], uut.sum());
+        TEST_ASSERT_EQUAL_INT32(mins[i], uut.min());
+        TEST_ASSERT_EQUAL_INT32(maxs[i], uut.max());
+    }
+    TEST_ASSERT_TRUE(uut.isFull());
+    TEST_ASSERT_EQUAL_UINT32(3, uut.size());
+}
+
+void test_duplicates()
+{
+    SlidingWindow<int32_t, 3> uut;
+
+    // Both 2s are the minimum, dropping the first must leave the second
+    uut.push(2);
+    uut.push(2);
+    uut.push(5);
+    TEST_ASSERT_EQUAL_INT32(2, uut.min());
+    uut.push(6);
+    TEST_ASSERT_EQUAL_INT32(2, uut.min());
+    uut.push(7);
+    TEST_ASSERT_EQUAL_INT32(5, uut.min());
+    TEST_ASSERT_EQUAL_INT32(7, uut.max());
+}
+
+void test_wide_sum()
+{
+    SlidingWindow<uint8_t, 16, uint32_t> uut;
+
+    for (uint32_t i = 0; i < 40; i++) {
+        uut.push(250U);
+    }
+    TEST_ASSERT_EQUAL_UINT32(16U * 250U, uut.sum());
+}
+
+void test_index_segments()
+{
+    SlidingWindow<uint32_t, 4> uut;
+
+    for (uint32_t i = 0; i < 7; i++) {
+        uut.push(i);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(3, uut.at(0));
+    TEST_ASSERT_EQUAL_UINT32(6, uut.at(3));
+    TEST_ASSERT_EQUAL_UINT32(6, uut.atBack(0));
+    TEST_ASSERT_EQUAL_UINT32(4, uut.atBack(2));
+
+    Span<const uint32_t> first;
+    Span<const uint32_t> second;
+    uut.segments(first, second);
+    TEST_ASSERT_EQUAL_UINT32(4, first.length() + second.length());
+    TEST_ASSERT_EQUAL_UINT32(3, first[0]);
+    TEST_ASSERT_EQUAL_UINT32(6, second[second.length() - 1U]);
+}
+
+void test_clear()
+{
+    SlidingWindow<int32_t, 4> uut;
+
+    for (int32_t i = 0; i < 6; i++) {
+        uut.push(i);
+    }
+    uut.clear();
+    TEST_ASSERT_TRUE(uut.isEmpty());
+    TEST_ASSERT_EQUAL_INT32(0, uut.sum());
+
+    uut.push(-1);
+    TEST_ASSERT_EQUAL_INT32(-1, uut.sum());
+    TEST_ASSERT_EQUAL_INT32(-1, uut.min());
+    TEST_ASSERT_EQUAL_INT32(-1, uut.max());
+}
+
+/// Orders samples by magnitude.
+struct AbsCompare
+{
+    int operator()(int32_t a, int32_t b) const
+    {
+        const int32_t abs_a = (a < 0) ? -a : a;
+        const int32_t abs_b = (b < 0) ? -b : b;
+        return (abs_a < abs_b) ? -1 : ((abs_a > abs_b) ? 1 : 0);
+    }
+};
+
+void test_compare()
+{
+    SlidingWindow<int32_t, 3, int32_t, AbsCompare> uut;
+
+    uut.push(-9);
+    uut.push(2);
+    uut.push(-4);
+    TEST_ASSERT_EQUAL_INT32(2, uut.min());
+    TEST_ASSERT_EQUAL_INT32(-9, uut.max());
+    uut.push(1);
+    TEST_ASSERT_EQUAL_INT32(1, uut.min());
+    TEST_ASSERT_EQUAL_INT32(-4, uut.max());
+}
+
+void test_fuzz()
+{
+#ifdef FUZZ_SEED
+    uint32_t seed = FUZZ_SEED;
+#else
+    uint32_t seed = std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+    std::cout << "Fuzz seed: " << seed << std::endl;
+    std::srand(seed);
+
+    SlidingWindow<int32_t, 13> uut;
+    int32_t history[20000];
+
+    for (size_t n = 0; n < 20000U; n++) {
+        // A narrow range, so there are plenty of equal samples
+        history[n] = (std::rand() % 21) - 10;
+        uut.push(history[n]);
+
+        const size_t first = (n >= 12U) ? (n - 12U) : 0;
+        int32_t sum = 0;
+        int32_t min = history[first];
+        int32_t max = history[first];
+        for (size_t i = first; i <= n; i++) {
+            sum += history[i];
+            min = util::min(min, history[i]);
+            max = util::max(max, history[i]);
+        }
+
+        TEST_ASSERT_EQUAL_UINT32(n + 1U - first, uut.size());
+        TEST_ASSERT_EQUAL_INT32(sum, uut.sum());
+        TEST_ASSERT_EQUAL_INT32(min, uut.min());
+        TEST_ASSERT_EQUAL_INT32(max, uut.max());
+    }
+}
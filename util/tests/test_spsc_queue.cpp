@@ -0,0 +1,234 @@
+/**
+ * @file      test_spsc_queue.cpp
+ * @brief     This file contains tests for SpscQueue.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include "unity.h"
+#include "tracked.h"
+
+#include "junk/containers/spsc_queue.h"
+
+using namespace junk;
+
+void test_empty();
+void test_full();
+void test_drain();
+void test_wrap();
+void test_peek();
+void test_emplace();
+void test_move_only_type();
+void test_destructs();
+void test_alignment();
+void test_two_threads();
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_empty);
+    RUN_TEST(test_full);
+    RUN_TEST(test_drain);
+    RUN_TEST(test_wrap);
+    RUN_TEST(test_peek);
+    RUN_TEST(test_emplace);
+    RUN_TEST(test_move_only_type);
+    RUN_TEST(test_destructs);
+    RUN_TEST(test_alignment);
+    RUN_TEST(test_two_threads);
+
+    return UNITY_END();
+}
+
+void test_empty()
+{
+    SpscQueue<uint32_t, 8> uut;
+
+    TEST_ASSERT_EQUAL_UINT32(0, uut.size());
+    TEST_ASSERT_EQUAL_UINT32(8, uut.capacity());
+    TEST_ASSERT_TRUE(uut.isEmpty());
+    TEST_ASSERT_FALSE(uut.isFull());
+
+    uint32_t item = 0;
+    TEST_ASSERT_FALSE(uut.dequeue(item));
+}
+
+void test_full()
+{
+    SpscQueue<uint32_t, 8> uut;
+
+    for (uint8_t i = 0; i < 8; i++) {
+        TEST_ASSERT_EQUAL_UINT32(i, uut.size());
+        TEST_ASSERT_TRUE(uut.enqueue(i));
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(8, uut.size());
+    TEST_ASSERT_TRUE(uut.isFull());
+    TEST_ASSERT_FALSE(uut.enqueue(8U));
+}
+
+void test_drain()
+{
+    SpscQueue<uint32_t, 8> uut;
+
+    for (uint8_t i = 0; i < 8; i++) {
+        TEST_ASSERT_TRUE(uut.enqueue(i));
+    }
+
+    for (uint8_t i = 0; i < 8; i++) {
+        TEST_ASSERT_EQUAL_UINT32((size_t)(8-i), uut.size());
+        uint32_t item = 0;
+        TEST_ASSERT_TRUE(uut.dequeue(item));
+        TEST_ASSERT_EQUAL_UINT32(i, item);
+    }
+
+    TEST_ASSERT(uut.isEmpty());
+}
+
+void test_wrap()
+{
+    SpscQueue<uint32_t, 5> uut;
+
+    // Keep the queue partly full so both indices wrap several times at different offsets
+    uint32_t next_in = 0;
+    uint32_t next_out = 0;
+    for (uint8_t i = 0; i < 3; i++) {
+        TEST_ASSERT_TRUE(uut.enqueue(next_in++));
+    }
+    for (uint8_t i = 0; i < 24; i++) {
+        TEST_ASSERT_TRUE(uut.enqueue(next_in++));
+        TEST_ASSERT_TRUE(uut.enqueue(next_in++));
+        TEST_ASSERT_TRUE(uut.isFull());
+
+        uint32_t item = 0;
+        TEST_ASSERT_TRUE(uut.dequeue(item));
+        TEST_ASSERT_EQUAL_UINT32(next_out++, item);
+        TEST_ASSERT_TRUE(uut.dequeue(item));
+        TEST_ASSERT_EQUAL_UINT32(next_out++, item);
+        TEST_ASSERT_EQUAL_UINT32(3, uut.size());
+    }
+}
+
+void test_peek()
+{
+    SpscQueue<uint32_t, 8> uut;
+
+    uint32_t item = 0;
+    TEST_ASSERT_FALSE(uut.peek(item));
+
+    for (uint8_t i = 0; i < 8; i++) {
+        TEST_ASSERT_TRUE(uut.enqueue(i));
+
+        TEST_ASSERT_TRUE(uut.peek(item));
+        TEST_ASSERT_EQUAL_UINT32(i, item);
+        TEST_ASSERT_EQUAL_UINT32(1, uut.size());
+
+        TEST_ASSERT_TRUE(uut.dequeue(item));
+        TEST_ASSERT_EQUAL_UINT32(i, item);
+    }
+}
+
+void test_emplace()
+{
+    class Stuff
+    {
+    public:
+        Stuff(uint32_t a_, uint8_t b_) : a(a_), b(b_) {};
+
+        uint32_t a;
+        uint8_t b;
+    };
+
+    SpscQueue<Stuff, 8> uut;
+
+    for (uint8_t i = 0; i < 8; i++) {
+        TEST_ASSERT_TRUE(uut.emplace(1234U, i));
+
+        Stuff s(0U,0U);
+        TEST_ASSERT_TRUE(uut.dequeue(s));
+        TEST_ASSERT_EQUAL_UINT32(1234U, s.a);
+        TEST_ASSERT_EQUAL_UINT32(i, s.b);
+    }
+}
+
+void test_move_only_type()
+{
+    SpscQueue<std::unique_ptr<uint32_t>, 4> uut;
+
+    std::unique_ptr<uint32_t> in(new uint32_t(1234U));
+    TEST_ASSERT_TRUE(uut.enqueue(std::move(in)));
+    TEST_ASSERT_NULL(in.get());
+
+    std::unique_ptr<uint32_t> out;
+    TEST_ASSERT_TRUE(uut.dequeue(out));
+    TEST_ASSERT_NOT_NULL(out.get());
+    TEST_ASSERT_EQUAL_UINT32(1234U, *out);
+}
+
+int32_t g_live = 0;
+
+void test_destructs()
+{
+    g_live = 0;
+    {
+        SpscQueue<Tracked, 4> uut;
+        for (uint8_t i = 0; i < 4; i++) {
+            TEST_ASSERT_TRUE(uut.emplace());
+        }
+        TEST_ASSERT_EQUAL_INT32(4, g_live);
+
+        Tracked out;
+        TEST_ASSERT_TRUE(uut.dequeue(out));
+        TEST_ASSERT_EQUAL_INT32(4, g_live);
+    }
+    TEST_ASSERT_EQUAL_INT32(0, g_live);
+}
+
+void test_alignment()
+{
+    static SpscQueue<uint8_t, 16> uut;
+
+    // The whole queue is padded out to whole cache lines, one for each index and the storage
+    TEST_ASSERT_EQUAL_UINT32(0, alignof(SpscQueue<uint8_t, 16>) % util::kCacheLineSize);
+    TEST_ASSERT_TRUE(sizeof(uut) >= (3U * util::kCacheLineSize));
+}
+
+void test_two_threads()
+{
+    constexpr uint32_t kNumItems = 200000U;
+
+    static SpscQueue<uint32_t, 64> uut;
+    std::atomic<uint32_t> failures {0};
+
+    std::thread consumer([&]() {
+        uint32_t expected = 0;
+        while (expected < kNumItems) {
+            uint32_t item = 0;
+            if (uut.dequeue(item)) {
+                if (item != expected) {
+                    failures++;
+                }
+                expected++;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    for (uint32_t i = 0; i < kNumItems; i++) {
+        while (!uut.enqueue(i)) {
+            std::this_thread::yield();
+        }
+    }
+
+    consumer.join();
+
+    TEST_ASSERT_EQUAL_UINT32(0, failures.load());
+    TEST_ASSERT_TRUE(uut.isEmpty());
+}
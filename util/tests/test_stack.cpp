@@ -7,6 +7,11 @@
  */
 
 #include "unity.h"
+#include "tracked.h"
+
+// Mock JUNK_TRAP
+#define JUNK_TRAP(f,l) g_junk_assert_trap = true
+bool g_junk_assert_trap = false;
 
 #include "junk/containers/stack.h"
 
@@ -19,6 +24,9 @@ void test_overwrite();
 void test_peek();
 void test_push_move();
 void test_emplace();
+void test_top();
+void test_try_pop();
+void test_consume();
 void test_trivial_type();
 void test_pod_type();
 void test_non_pod_type();
@@ -35,6 +43,9 @@ int main(int argc, char** argv)
     RUN_TEST(test_peek);
     RUN_TEST(test_push_move);
     RUN_TEST(test_emplace);
+    RUN_TEST(test_top);
+    RUN_TEST(test_try_pop);
+    RUN_TEST(test_consume);
     RUN_TEST(test_trivial_type);
     RUN_TEST(test_pod_type);
     RUN_TEST(test_non_pod_type);
@@ -129,6 +140,9 @@ void test_push_move()
     class Moveable
     {
     public:
+        Moveable() = default;
+        Moveable(Moveable&& m) : a(m.a) { m.a = 0; }
+
         Moveable& operator =(Moveable&& m)
         {
             a = m.a;
@@ -176,6 +190,73 @@ void test_emplace()
     }
 }
 
+void test_top()
+{
+    Stack<uint32_t, 4> uut;
+
+    g_junk_assert_trap = false;
+    uut.top();
+    TEST_ASSERT_TRUE(g_junk_assert_trap);
+    g_junk_assert_trap = false;
+
+    uut.push(1U);
+    uut.push(2U);
+    TEST_ASSERT_EQUAL_UINT32(2, uut.top());
+
+    // The reference is to the item on the stack
+    uut.top() = 20U;
+    const Stack<uint32_t, 4>& const_uut = uut;
+    TEST_ASSERT_EQUAL_UINT32(20, const_uut.top());
+    TEST_ASSERT_EQUAL_UINT32(2, uut.size());
+    TEST_ASSERT_FALSE(g_junk_assert_trap);
+}
+
+void test_try_pop()
+{
+    struct NoDefault
+    {
+        explicit NoDefault(uint32_t a_) : a(a_) {};
+        uint32_t a;
+    };
+
+    Stack<NoDefault, 4> uut;
+    TEST_ASSERT_FALSE(uut.tryPop().hasValue());
+
+    for (uint32_t i = 0; i < 4; i++) {
+        uut.emplace(i);
+    }
+    for (uint32_t i = 0; i < 4; i++) {
+        Optional<NoDefault> item = uut.tryPop();
+        TEST_ASSERT_TRUE(item.hasValue());
+        TEST_ASSERT_EQUAL_UINT32(3U - i, item->a);
+    }
+    TEST_ASSERT_TRUE(uut.isEmpty());
+    TEST_ASSERT_FALSE(uut.tryPop());
+}
+
+int32_t g_live = 0;
+
+void test_consume()
+{
+    g_live = 0;
+    {
+        Stack<Tracked, 4> uut;
+        uint32_t seen = 0;
+
+        TEST_ASSERT_FALSE(uut.consume([&](Tracked& t) { seen = t.value; }));
+        TEST_ASSERT_EQUAL_UINT32(0, seen);
+
+        uut.emplace(7U);
+        uut.emplace(8U);
+        TEST_ASSERT_EQUAL_INT32(2, g_live);
+        TEST_ASSERT_TRUE(uut.consume([&](Tracked& t) { seen = t.value; }));
+        TEST_ASSERT_EQUAL_UINT32(8, seen);
+        TEST_ASSERT_EQUAL_INT32(1, g_live);
+        TEST_ASSERT_EQUAL_UINT32(7, uut.top().value);
+    }
+    TEST_ASSERT_EQUAL_INT32(0, g_live);
+}
+
 void test_trivial_type()
 {
     Stack<uint32_t, 1> uut;
@@ -0,0 +1,39 @@
+/**
+ * @file      tracked.h
+ * @brief     This file contains the live instance counting fixture shared by the container tests.
+ * @author    Liam Bucci <liam.bucci@gmail.com>
+ * @date      2026-10-18
+ * @copyright Copyright (c) 2026 Liam Bucci. See included LICENSE file.
+ */
+
+#ifndef TRACKED_H
+#define TRACKED_H
+
+#include <cstdint>
+
+/// The number of Tracked instances alive. Each test defines it once and resets it before use.
+extern int32_t g_live;
+
+/**
+ * @brief An item which counts its live instances in g_live.
+ *
+ * Every constructor increments g_live and the destructor decrements it, so a container which leaks
+ * or double destructs items leaves g_live non-zero once it goes out of scope.
+ */
+struct Tracked
+{
+    Tracked() : value(0) { g_live++; }
+    Tracked(uint32_t v) : value(v) { g_live++; }
+    Tracked(const Tracked& t) : value(t.value) { g_live++; }
+    Tracked(Tracked&& t) : value(t.value) { g_live++; }
+    ~Tracked() { g_live--; }
+    Tracked& operator =(const Tracked& t) = default;
+    Tracked& operator =(Tracked&& t) = default;
+
+    bool operator <(const Tracked& t) const { return value < t.value; }
+    bool operator ==(const Tracked& t) const { return value == t.value; }
+
+    uint32_t value;
+};
+
+#endif // TRACKED_H